@@ -0,0 +1,38 @@
+/**
+ * @file Companion.h
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Polynomial roots, fast QR algorithm on companion matrices.
+ * @date 2024-12-17
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ * The companion matrix is kept factored as A = QR, Q being a descending
+ * sequence of core transformations and R, unitary plus rank one, a pair of
+ * sequences of core transformations. A QR step only refactors neighbouring
+ * cores, so that every step costs O(N) and the whole matrix O(N) memory.
+ * 
+ * A core transformation is a 2x2 unitary block acting on two consecutive rows,
+ * stored column-major as four Complex numbers.
+ */
+
+#ifndef NAQRA_COMPANION_H
+#define NAQRA_COMPANION_H
+
+// Matrices.
+#include "./Matrix.h"
+
+
+// Constants.
+
+#ifndef CMP0
+
+// Deflation tolerance on the cores' subdiagonal entries.
+#define CMP0 1.0E-15
+#endif
+
+
+// Roots.
+
+Natural Rts_CvCvtN_N(const Complex*, Complex*, const Natural);
+
+#endif
@@ -16,6 +16,9 @@
 #include <stdlib.h>
 #include <stdio.h>
 
+// Allocations.
+#include "./Memory.h"
+
 // Math.
 #ifndef _USE_MATH_DEFINES
 #define _USE_MATH_DEFINES
@@ -193,6 +196,54 @@ static inline Complex M_CR_C(const Complex C0, const Real R0) { return vmulq_f64
  */
 static inline Complex D_CR_C(const Complex C0, const Real R0) { return vdivq_f64(C0, vdupq_n_f64(R0)); }
 
+// Complex fused arithmetic, Armv8.3-A complex instructions.
+
+#ifndef FCM0
+
+// FCMA kernels' target.
+#define FCM0 __attribute__((target("arch=armv8.3-a")))
+#endif
+
+/**
+ * @brief Fused Multiply-Add [Fma].
+ * 
+ * @param C0 Complex Number [C].
+ * @param C1 Complex Number [C].
+ * @param C2 Complex Number [C].
+ * @return Complex Complex Number [C], C0 + C1 * C2.
+ */
+FCM0 static inline Complex Fma_CCC_C(const Complex C0, const Complex C1, const Complex C2) { return vcmlaq_rot90_f64(vcmlaq_f64(C0, C1, C2), C1, C2); }
+
+/**
+ * @brief Fused Multiply-Add [Fma].
+ * 
+ * @param C0 Complex Number [C].
+ * @param C1 Conjugate Complex Number [Ccj].
+ * @param C2 Complex Number [C].
+ * @return Complex Complex Number [C], C0 + conj(C1) * C2.
+ */
+FCM0 static inline Complex Fma_CCcjC_C(const Complex C0, const Complex C1, const Complex C2) { return vcmlaq_rot270_f64(vcmlaq_f64(C0, C1, C2), C1, C2); }
+
+/**
+ * @brief Fused Multiply-Subtract [Fms].
+ * 
+ * @param C0 Complex Number [C].
+ * @param C1 Complex Number [C].
+ * @param C2 Complex Number [C].
+ * @return Complex Complex Number [C], C0 - C1 * C2.
+ */
+FCM0 static inline Complex Fms_CCC_C(const Complex C0, const Complex C1, const Complex C2) { return vcmlaq_rot270_f64(vcmlaq_rot180_f64(C0, C1, C2), C1, C2); }
+
+/**
+ * @brief Fused Multiply-Subtract [Fms].
+ * 
+ * @param C0 Complex Number [C].
+ * @param C1 Conjugate Complex Number [Ccj].
+ * @param C2 Complex Number [C].
+ * @return Complex Complex Number [C], C0 - conj(C1) * C2.
+ */
+FCM0 static inline Complex Fms_CCcjC_C(const Complex C0, const Complex C1, const Complex C2) { return vcmlaq_rot90_f64(vcmlaq_rot180_f64(C0, C1, C2), C1, C2); }
+
 // Complex methods.
 
 /**
@@ -224,13 +275,13 @@ static inline Complex Sq_C_C(const Complex C0) {
  */
 [[nodiscard]] static inline Complex* Nrt_C_Cv(const Complex C0, const Natural N0) {
     register Natural N1 = 0;
-    register Complex* Cv0 = (Complex*) calloc(N0, sizeof(Complex));
+    register Complex* Cv0 = (Complex*) Calc_NN_P(N0, sizeof(Complex));
 
     const register Real R0 = vgetq_lane_f64(C0, 0), R1 = vgetq_lane_f64(C0, 1); // C0.
     const register Real R2 = 2.0 * M_PI / (Real) N0;
 
     register Real R3 = R0 * R0 + R1 * R1; R3 = pow(R3, 0.5 / (Real) N0);
-    register Real R4 = atan2(R1, R0); if(R4 < 0.0) R4 += M_PI; R4 /= (Real) N0;
+    register Real R4 = atan2(R1, R0); if(R4 < 0.0) R4 += 2.0 * M_PI; R4 /= (Real) N0;
 
     for(; N1 < N0; ++N1, R4 += R2)
         Cv0[N1] = C_RR_C(R3 * cos(R4), R3 * sin(R4));
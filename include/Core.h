@@ -0,0 +1,63 @@
+/**
+ * @file Core.h
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Out-of-core Hessenberg reduction.
+ * @date 2024-12-16
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ * The matrix lives in memory when it fits the budget. Otherwise, it lives in an
+ * unlinked scratch file, complex column-major, and is streamed through memory
+ * one panel of columns at a time, the next panel being read ahead while the
+ * current one is processed. The scratch file is reduced to band Hessenberg
+ * form, once streamed per panel, the band being chased down to Hessenberg form
+ * in compact storage.
+ */
+
+#ifndef NAQRA_CORE_H
+#define NAQRA_CORE_H
+
+// Binary format.
+#include "./Format.h"
+
+
+// Constants.
+
+#ifndef CRE0
+
+// Default memory budget, bytes.
+#define CRE0 ((size_t) 1 << 30)
+#endif
+
+
+// Panels.
+
+// File-backed square matrix.
+typedef struct {
+
+    // Scratch file descriptor, -1 in memory.
+    int I0;
+
+    // Rows and Columns.
+    Natural N0;
+
+    // Columns per panel.
+    Natural N1;
+
+    // Bandwidth, subdiagonals.
+    Natural N2;
+
+    // Matrix in memory, NULL for the scratch file.
+    Complex* Cm0;
+
+} Panels;
+
+[[nodiscard]] Panels* Opn_SN_Pnl(const char*, const size_t);
+void Cls_Pnl_0(Panels*);
+
+// Hessenberg form.
+
+bool Hsn_Pnl_B(Panels*);
+[[nodiscard]] Complex* Cpt_Pnl_Chc(Panels*);
+
+#endif
@@ -0,0 +1,90 @@
+/**
+ * @file Format.h
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Binary matrix format.
+ * @date 2024-12-15
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ * A 64-byte header, little-endian, followed by the entries at offset 64.
+ * Complex column-major files are mapped straight into memory.
+ * 
+ * Matrix Market files are mapped and parsed in parallel chunks, symmetric,
+ * skew-symmetric and Hermitian storage being expanded to full storage.
+ */
+
+#ifndef NAQRA_FORMAT_H
+#define NAQRA_FORMAT_H
+
+// Fixed width integers.
+#include <stdint.h>
+
+// Matrices.
+#include "./Matrix.h"
+
+
+// Constants.
+
+#define FMT0 "NAQRAMTX" // Magic.
+#define FMT1 1 // Version.
+#define FMT2 64 // Entries' offset, bytes.
+
+#ifndef MTX0
+
+// Minimum bytes per Matrix Market chunk.
+#define MTX0 (1 << 16)
+#endif
+
+
+// Entries.
+
+#define ELM_COMPLEX 0 // Complex, two float64.
+#define ELM_REAL 1 // Real, float64.
+
+// Storage order.
+
+#define ORD_COLUMN 0 // Column-major.
+#define ORD_ROW 1 // Row-major.
+
+
+// Header.
+
+// File header.
+typedef struct {
+
+    // Magic, FMT0.
+    char S0[8];
+
+    // Version, FMT1.
+    uint64_t N0;
+
+    // Entries, ELM_*.
+    uint64_t N1;
+
+    // Storage order, ORD_*.
+    uint64_t N2;
+
+    // Structure, STR_* flags.
+    uint64_t N3;
+
+    // Rows.
+    uint64_t N4;
+
+    // Columns.
+    uint64_t N5;
+
+    // Reserved, zero.
+    uint64_t N6;
+
+} Format;
+
+_Static_assert(sizeof(Format) == FMT2, "Header exceeds the entries' offset.");
+
+// Files.
+
+[[nodiscard]] Complex* Ld_IFmtt_Cm(const int, Format*);
+[[nodiscard]] Complex* Ld_SFmtt_Cm(const char*, Format*);
+Natural Sv_SFmtCm_N(const char*, const Format*, const Complex*);
+[[nodiscard]] Complex* Mtx_SFmttN_Cm(const char*, Format*, const Natural);
+
+#endif
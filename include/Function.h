@@ -0,0 +1,77 @@
+/**
+ * @file Function.h
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Matrix functions, blocked Schur-Parlett.
+ * @date 2024-12-21
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ * A = Q T Q^H comes from the usual Hessenberg form and QR algorithm, the
+ * transformations being accumulated. Eigenvalues closer than FNC0 are
+ * clustered and moved next to each other by swaps of the Schur form, so that
+ * f(T) follows from Taylor series on the diagonal blocks and from the block
+ * Parlett recurrence, through triangular Sylvester equations, above them.
+ * The decomposition does not depend on f and serves any number of functions,
+ * clusters too wide for f's radius of convergence being split on a copy.
+ */
+
+#ifndef NAQRA_FUNCTION_H
+#define NAQRA_FUNCTION_H
+
+// Matrices.
+#include "./Matrix.h"
+
+
+// Constants.
+
+#ifndef FNC0
+
+// Clustering distance.
+#define FNC0 1.0E-1
+#endif
+
+#ifndef FNC1
+
+// Taylor series' terms, at most.
+#define FNC1 256
+#endif
+
+#ifndef FNC2
+
+// Taylor series' tolerance, relative.
+#define FNC2 1.0E-16
+#endif
+
+#ifndef FNC3
+
+// Clusters' radius, at most, relative to min(1, r), r being the radius of convergence at their mean.
+#define FNC3 5.0E-1
+#endif
+
+
+// Scalar function callback, point and order k, returning the k-th Taylor coefficient f^(k)(z) / k!.
+typedef Complex (*Taylor)(const Complex, const Natural);
+
+// Radius of convergence callback, point, returning the radius of f's Taylor series there, INFINITY for entire functions.
+typedef Real (*Radius)(const Complex);
+
+// Scalar functions.
+
+Complex Exp_CN_C(const Complex, const Natural);
+Complex Log_CN_C(const Complex, const Natural);
+Real Exp_C_R(const Complex);
+Real Log_C_R(const Complex);
+
+// Schur form.
+
+void Sch_CqtCqtN_0(Complex*, Complex*, const Natural);
+Natural Cls_CutCqtNvtN_N(Complex*, Complex*, Natural*, const Natural);
+bool Fit_CuNvRdNN_B(const Complex*, const Natural*, const Radius, const Natural, const Natural);
+Natural Spl_CutCqtNvtRdNN_N(Complex*, Complex*, Natural*, const Radius, const Natural, const Natural);
+
+// Matrix functions.
+
+Natural Fnc_CuNvTyCutNN_N(const Complex*, const Natural*, const Taylor, Complex*, const Natural, const Natural);
+void Sim_CqCqtN_0(const Complex*, Complex*, const Natural);
+
+#endif
@@ -0,0 +1,75 @@
+/**
+ * @file Generic.h
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Type-generic kernels, real and complex, single and double precision.
+ * @date 2024-12-20
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ * The kernels are written once, in src/Kernels.h, and instantiated by
+ * src/NAQRA_Generic.c for every scalar type, each with its own packed inner
+ * loops. Names follow the usual convention with a "g" suffix on the
+ * abbreviation and the type letters L of the instance, Lr being its real
+ * counterpart:
+ * 
+ *  - Dotg_LvLvN_L, dot product, x * conj(y).
+ *  - N2g_LvN_Lr, Euclidean norm.
+ *  - Mag_LvtLvLN_0, multiply-add.
+ *  - Hslg_LqtLvNN_0, Hsrg_LqtLvNN_0, Householder products.
+ *  - Gvlg_LhsnqtLLNN_0, Gvrhrg_LhsnqtLLNN_0, Givens products on Hessenberg
+ *    matrices.
+ *  - Qrg_LqtLvtN_0, Householder QR.
+ * 
+ * with L being R, Rs, C or Cs. The baseline vector kernels, the Householder
+ * and Givens products of NAQRA_Matrix.c and NAQRA_Single.c, and the real
+ * Hessenberg reduction are built on them.
+ */
+
+#ifndef NAQRA_GENERIC_H
+#define NAQRA_GENERIC_H
+
+// Single precision.
+#include "./Single.h"
+
+
+// Types.
+
+typedef float32x4_t Reals4; // Real numbers, single precision (quadruple).
+
+
+// Names.
+
+#define GNR0(A, B, C, D, E, F, G) A ## B ## C ## D ## E ## F ## G
+#define GNR1(A, B, C, D, E, F, G) GNR0(A, B, C, D, E, F, G) // Expanded.
+
+#define GNR_DOT(L, Lr) GNR1(Dotg_, L, v, L, vN_, L, )
+#define GNR_N2(L, Lr) GNR1(N2g_, L, vN_, Lr, , , )
+#define GNR_MA(L, Lr) GNR1(Mag_, L, vt, L, v, L, N_0)
+#define GNR_HSL(L, Lr) GNR1(Hslg_, L, qt, L, vNN_0, , )
+#define GNR_HSR(L, Lr) GNR1(Hsrg_, L, qt, L, vNN_0, , )
+#define GNR_GVL(L, Lr) GNR1(Gvlg_, L, hsnqt, L, L, NN_0, )
+#define GNR_GVR(L, Lr) GNR1(Gvrhrg_, L, hsnqt, L, L, NN_0, )
+#define GNR_QR(L, Lr) GNR1(Qrg_, L, qt, L, vtN_0, , )
+
+// Selection, on the entries' type.
+#define GNR_GENERIC(F, X) _Generic(*(X), Real: F(R, R), Reals: F(Rs, Rs), Complex: F(C, R), Complexs: F(Cs, Rs))
+
+
+// Declarations.
+
+#define GNR_DECLARE(T, U, L, Lr) \
+    T GNR_DOT(L, Lr)(const T*, const T*, const Natural); \
+    U GNR_N2(L, Lr)(const T*, const Natural); \
+    void GNR_MA(L, Lr)(T*, const T*, const T, const Natural); \
+    void GNR_HSL(L, Lr)(T*, const T*, const Natural, const Natural); \
+    void GNR_HSR(L, Lr)(T*, const T*, const Natural, const Natural); \
+    void GNR_GVL(L, Lr)(T*, const T, const T, const Natural, const Natural); \
+    void GNR_GVR(L, Lr)(T*, const T, const T, const Natural, const Natural); \
+    void GNR_QR(L, Lr)(T*, T*, const Natural);
+
+GNR_DECLARE(Real, Real, R, R)
+GNR_DECLARE(Reals, Reals, Rs, Rs)
+GNR_DECLARE(Complex, Real, C, R)
+GNR_DECLARE(Complexs, Reals, Cs, Rs)
+
+#endif
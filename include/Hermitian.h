@@ -0,0 +1,102 @@
+/**
+ * @file Hermitian.h
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Hermitian matrices, packed lower triangle, and real tridiagonal matrices.
+ * @date 2024-12-09
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ * Packed storage keeps the lower triangle column by column, N(N + 1) / 2 entries.
+ * Band storage keeps, for bandwidth B, 2B entries per column from the diagonal
+ * downwards, the lower half being room for the bulges.
+ */
+
+#ifndef NAQRA_HERMITIAN_H
+#define NAQRA_HERMITIAN_H
+
+// Matrices.
+#include "./Matrix.h"
+
+
+// Constants.
+
+#ifndef BND0
+
+// Bandwidth of the two-stage tridiagonal form.
+#define BND0 32
+#endif
+
+#ifndef BSC0
+
+// Bisection and refinement steps per eigenvalue.
+#define BSC0 128
+#endif
+
+#ifndef TRD0
+
+// Minimum size for the two-stage tridiagonal form.
+#define TRD0 512
+#endif
+
+#ifndef UPD0
+
+// Deflation and residual tolerance of rank-one updates, relative.
+#define UPD0 1.0E-15
+#endif
+
+
+// Packed storage.
+
+/**
+ * @brief Packed index [Pk].
+ * 
+ * @param N0 Row [N], N0 >= N1.
+ * @param N1 Column [N].
+ * @param N2 Rows and Columns [N].
+ * @return Natural Index [N].
+ */
+static inline Natural Pk_NNN_N(const Natural N0, const Natural N1, const Natural N2) { return N1 * (2 * N2 - N1 - 1) / 2 + N0; }
+
+// Band storage.
+
+/**
+ * @brief Band index [Bd].
+ * 
+ * @param N0 Row [N], N1 <= N0 < N1 + 2 * N2.
+ * @param N1 Column [N].
+ * @param N2 Bandwidth [N].
+ * @return Natural Index [N].
+ */
+static inline Natural Bd_NNN_N(const Natural N0, const Natural N1, const Natural N2) { return 2 * N2 * N1 + N0 - N1; }
+
+// Tridiagonal form.
+
+void Trd_ChptRvtRvtN_0(Complex*, Real*, Real*, const Natural);
+
+// Two-stage tridiagonal form.
+
+void Bnd_ChptChbtNN_0(Complex*, Complex*, const Natural, const Natural);
+Natural Chs_ChbtCvtNNNN_N(Complex*, Complex*, const Natural, const Natural, const Natural, const Natural);
+void Dgs_ChbRvtRvtNN_0(const Complex*, Real*, Real*, const Natural, const Natural);
+void Trd_ChbtRvtRvtNN_0(Complex*, Real*, Real*, const Natural, const Natural);
+
+// Tridiagonal eigenvalues.
+
+void Eig_RvtRvtN_0(Real*, Real*, const Natural);
+
+// Subset eigenvalues.
+
+Natural Stc_RvRvRN_N(const Real*, const Real*, const Real, const Natural);
+void Grs_RvRvRvtN_0(const Real*, const Real*, Real*, const Natural);
+void Sbs_RvRvRvtNNN_0(const Real*, const Real*, Real*, const Natural, const Natural, const Natural);
+
+// Eigen-decomposition.
+
+void Dcm_ChptCmtRvtN_0(Complex*, Complex*, Real*, const Natural);
+
+// Rank-one updates.
+
+void Upd_RvtCmRCvN_0(Real*, const Complex*, const Real, const Complex*, const Natural);
+void Upd_RvtCmtRCvN_0(Real*, Complex*, const Real, const Complex*, const Natural);
+
+#endif
@@ -19,6 +19,39 @@
 // Matrices.
 #include "./Matrix.h"
 
+// Multithreading.
+#include "./Parallel.h"
+
+// Single precision.
+#include "./Single.h"
+
+// Hermitian matrices.
+#include "./Hermitian.h"
+
+// Real matrices.
+#include "./Real.h"
+
+// Sparse matrices.
+#include "./Sparse.h"
+
+// Binary format.
+#include "./Format.h"
+
+// Out-of-core reduction.
+#include "./Core.h"
+
+// Polynomial roots.
+#include "./Companion.h"
+
+// Pseudospectra.
+#include "./Pseudospectra.h"
+
+// Matrix functions.
+#include "./Function.h"
+
+// Type-generic kernels.
+#include "./Generic.h"
+
 
 // Complex.
 
@@ -48,6 +81,9 @@ typedef struct {
     // Size.
     Natural N0;
 
+    // Structure, STR_* flags of the path taken by Eigenvalues.
+    Natural N1;
+
 } Vector;
 
 /**
@@ -63,10 +99,11 @@ typedef struct {
 
     const register Natural N0 = size;
 
-    Vector* V0 = (Vector*) malloc(sizeof(Vector));
+    Vector* V0 = (Vector*) Alc_NN_P(1, sizeof(Vector));
 
-    V0->Cv0 = (Complex*) calloc(N0, sizeof(Complex));
+    V0->Cv0 = (Complex*) Calc_NN_P(N0, sizeof(Complex));
     V0->N0 = N0;
+    V0->N1 = STR_GENERAL;
 
     return V0;
 }
@@ -77,8 +114,8 @@ typedef struct {
  * @param vector Vector.
  */
 static inline void FreeVector(Vector* vector) {
-    free(vector->Cv0);
-    free(vector);
+    Fr_P_0(vector->Cv0);
+    Fr_P_0(vector);
 }
 
 /**
@@ -149,9 +186,9 @@ typedef struct {
     assert(N1 > 0);
     #endif
 
-    Matrix* M0 = (Matrix*) malloc(sizeof(Matrix));
+    Matrix* M0 = (Matrix*) Alc_NN_P(1, sizeof(Matrix));
 
-    M0->Cm0 = (Complex*) calloc(N0 * N1, sizeof(Complex));
+    M0->Cm0 = (Complex*) Calc_NN_P(N0 * N1, sizeof(Complex));
     M0->N0 = N0;
     M0->N1 = N1;
 
@@ -164,8 +201,8 @@ typedef struct {
  * @param matrix Matrix.
  */
 static inline void FreeMatrix(Matrix* matrix) {
-    free(matrix->Cm0);
-    free(matrix);
+    Fr_P_0(matrix->Cm0);
+    Fr_P_0(matrix);
 }
 
 /**
@@ -210,9 +247,367 @@ static inline void SetMatrixAt(Matrix* matrix, const Natural row, const Natural
 }
 
 
+// Hermitian matrices.
+
+// Complex hermitian matrix, packed lower triangle.
+typedef struct {
+
+    // Entries.
+    Complex* Chp0;
+
+    // Rows and Columns.
+    Natural N0;
+
+} HermitianMatrix;
+
+/**
+ * @brief Hermitian matrix constructor.
+ * 
+ * @param size Matrix's rows and columns.
+ * @return HermitianMatrix* Hermitian matrix.
+ */
+[[nodiscard]] static inline HermitianMatrix* NewHermitianMatrix(const Natural size) {
+    #ifndef NDEBUG // Integrity check.
+    assert(size > 0);
+    #endif
+
+    const register Natural N0 = size;
+
+    HermitianMatrix* H0 = (HermitianMatrix*) Alc_NN_P(1, sizeof(HermitianMatrix));
+
+    H0->Chp0 = (Complex*) Calc_NN_P(N0 * (N0 + 1) / 2, sizeof(Complex));
+    H0->N0 = N0;
+
+    return H0;
+}
+
+/**
+ * @brief Hermitian matrix destructor.
+ * 
+ * @param matrix Hermitian matrix.
+ */
+static inline void FreeHermitianMatrix(HermitianMatrix* matrix) {
+    Fr_P_0(matrix->Chp0);
+    Fr_P_0(matrix);
+}
+
+/**
+ * @brief Hermitian matrix getter.
+ * 
+ * @param matrix Hermitian matrix.
+ * @param row Row index.
+ * @param column Column index.
+ * @return Complex Complex number.
+ */
+static inline Complex GetHermitianMatrixAt(const HermitianMatrix* matrix, const Natural row, const Natural column) {
+    const register Natural N0 = row;
+    const register Natural N1 = column;
+
+    #ifndef NDEBUG // Integrity check.
+    assert(N0 < matrix->N0);
+    assert(N1 < matrix->N0);
+    #endif
+
+    return N0 >= N1 ? matrix->Chp0[Pk_NNN_N(N0, N1, matrix->N0)] : Cj_C_C(matrix->Chp0[Pk_NNN_N(N1, N0, matrix->N0)]);
+}
+
+/**
+ * @brief Hermitian matrix setter, the symmetric entry is implied.
+ * 
+ * @param matrix Hermitian matrix.
+ * @param row Row index.
+ * @param column Column index.
+ * @param complex Complex number, real on the diagonal.
+ */
+static inline void SetHermitianMatrixAt(HermitianMatrix* matrix, const Natural row, const Natural column, const Complex complex) {
+    const register Natural N0 = row;
+    const register Natural N1 = column;
+    const register Complex C0 = complex;
+
+    #ifndef NDEBUG // Integrity check.
+    assert(N0 < matrix->N0);
+    assert(N1 < matrix->N0);
+    assert(N0 != N1 || fabs(vgetq_lane_f64(C0, 1)) <= TOL0);
+    #endif
+
+    if(N0 >= N1)
+        matrix->Chp0[Pk_NNN_N(N0, N1, matrix->N0)] = C0;
+    else
+        matrix->Chp0[Pk_NNN_N(N1, N0, matrix->N0)] = Cj_C_C(C0);
+}
+
+// Hermitian eigen-decomposition, for rank-one updates.
+typedef struct {
+
+    // Eigenvalues, ascending.
+    Real* Rv0;
+
+    // Eigenvectors, by column.
+    Complex* Cm0;
+
+    // Rows and Columns.
+    Natural N0;
+
+} HermitianDecomposition;
+
+/**
+ * @brief Hermitian decomposition destructor.
+ * 
+ * @param decomposition Hermitian decomposition.
+ */
+static inline void FreeHermitianDecomposition(HermitianDecomposition* decomposition) {
+    Fr_P_0(decomposition->Rv0);
+    Fr_P_0(decomposition->Cm0);
+    Fr_P_0(decomposition);
+}
+
+
+// Sparse matrices.
+
+// Complex sparse matrix, compressed sparse rows.
+typedef struct {
+
+    // Entries.
+    Complex* Cv0;
+
+    // Row pointers.
+    Natural* Nv0;
+
+    // Column indices.
+    Natural* Nv1;
+
+    // Rows and Columns.
+    Natural N0;
+
+    // Entries' count.
+    Natural N1;
+
+} SparseMatrix;
+
+/**
+ * @brief Sparse matrix constructor, row pointers and column indices are to be filled.
+ * 
+ * @param size Matrix's rows and columns.
+ * @param entries Matrix's stored entries.
+ * @return SparseMatrix* Sparse matrix.
+ */
+[[nodiscard]] static inline SparseMatrix* NewSparseMatrix(const Natural size, const Natural entries) {
+    #ifndef NDEBUG // Integrity check.
+    assert(size > 0);
+    assert(entries > 0);
+    #endif
+
+    const register Natural N0 = size;
+    const register Natural N1 = entries;
+
+    SparseMatrix* S0 = (SparseMatrix*) Alc_NN_P(1, sizeof(SparseMatrix));
+
+    S0->Cv0 = (Complex*) Calc_NN_P(N1, sizeof(Complex));
+    S0->Nv0 = (Natural*) Calc_NN_P(N0 + 1, sizeof(Natural));
+    S0->Nv1 = (Natural*) Calc_NN_P(N1, sizeof(Natural));
+    S0->N0 = N0;
+    S0->N1 = N1;
+
+    return S0;
+}
+
+/**
+ * @brief Sparse matrix destructor.
+ * 
+ * @param matrix Sparse matrix.
+ */
+static inline void FreeSparseMatrix(SparseMatrix* matrix) {
+    Fr_P_0(matrix->Cv0);
+    Fr_P_0(matrix->Nv0);
+    Fr_P_0(matrix->Nv1);
+    Fr_P_0(matrix);
+}
+
+
+
+// Solvers.
+
+// Warm-started solver, for sequences of nearby matrices.
+typedef struct {
+
+    // Previous eigenvalues, by deflation index.
+    Complex* Cv0;
+
+    // Rows and Columns.
+    Natural N0;
+
+    // Solved matrices.
+    Natural N1;
+
+} Solver;
+
+/**
+ * @brief Solver constructor.
+ * 
+ * @param size Matrices' rows and columns.
+ * @return Solver* Solver.
+ */
+[[nodiscard]] static inline Solver* NewSolver(const Natural size) {
+    #ifndef NDEBUG // Integrity check.
+    assert(size > 0);
+    #endif
+
+    Solver* S0 = (Solver*) Alc_NN_P(1, sizeof(Solver));
+
+    S0->Cv0 = (Complex*) Calc_NN_P(size, sizeof(Complex));
+    S0->N0 = size;
+    S0->N1 = 0;
+
+    return S0;
+}
+
+/**
+ * @brief Solver destructor.
+ * 
+ * @param solver Solver.
+ */
+static inline void FreeSolver(Solver* solver) {
+    Fr_P_0(solver->Cv0);
+    Fr_P_0(solver);
+}
+
+
+// Pseudospectra.
+
+// Pseudospectrum, smallest singular values of zI - A on a grid.
+typedef struct {
+
+    // Smallest singular values, column-major, rows along the imaginary axis.
+    Real* Rm0;
+
+    // Lower left corner.
+    Complex C0;
+
+    // Upper right corner.
+    Complex C1;
+
+    // Rows.
+    Natural N0;
+
+    // Columns.
+    Natural N1;
+
+    // Status, STS_*, the values being NaN unless STS_CONVERGED.
+    Natural N2;
+
+} Pseudospectrum;
+
+/**
+ * @brief Pseudospectrum destructor.
+ * 
+ * @param pseudospectrum Pseudospectrum.
+ */
+static inline void FreePseudospectrum(Pseudospectrum* pseudospectrum) {
+    Fr_P_0(pseudospectrum->Rm0);
+    Fr_P_0(pseudospectrum);
+}
+
+
+// Matrix functions.
+
+// Schur decomposition A = Q T Q^H, clustered, for matrix functions.
+typedef struct {
+
+    // Schur form, upper triangular.
+    Complex* Cm0;
+
+    // Schur vectors, by column.
+    Complex* Cm1;
+
+    // Clusters' boundaries on the diagonal.
+    Natural* Nv0;
+
+    // Rows and Columns.
+    Natural N0;
+
+    // Clusters.
+    Natural N1;
+
+} SchurDecomposition;
+
+/**
+ * @brief Schur decomposition destructor.
+ * 
+ * @param decomposition Schur decomposition.
+ */
+static inline void FreeSchurDecomposition(SchurDecomposition* decomposition) {
+    Fr_P_0(decomposition->Cm0);
+    Fr_P_0(decomposition->Cm1);
+    Fr_P_0(decomposition->Nv0);
+    Fr_P_0(decomposition);
+}
+
+// Files.
+
+[[nodiscard]] Matrix* LoadMatrix(const char*, Natural*);
+Natural SaveMatrix(const char*, const Matrix*, const Natural);
+[[nodiscard]] Matrix* ReadMatrixMarket(const char*, Natural*);
+
+
 // Eigenvalues.
 
 [[nodiscard]] Vector* Eigenvalues(const Matrix*);
+Natural StreamEigenvalues(const Matrix*, const Deflation, void*, const Budget*);
+[[nodiscard]] Vector* BudgetEigenvalues(const Matrix*, const Budget*, Natural*);
+Natural OutOfCoreEigenvalues(const char*, const size_t, const Deflation, void*, const Budget*);
+[[nodiscard]] Vector* SolverEigenvalues(Solver*, const Matrix*, Natural*);
+[[nodiscard]] Vector* SingleEigenvalues(const Matrix*);
+[[nodiscard]] Vector* MixedEigenvalues(const Matrix*, Natural*);
+[[nodiscard]] Vector* HermitianEigenvalues(const HermitianMatrix*);
+[[nodiscard]] Vector* HermitianEigenvaluesIndex(const HermitianMatrix*, const Natural, const Natural);
+[[nodiscard]] Vector* HermitianEigenvaluesRange(const HermitianMatrix*, const Real, const Real);
+[[nodiscard]] HermitianDecomposition* NewHermitianDecomposition(const HermitianMatrix*);
+[[nodiscard]] Vector* UpdatedHermitianEigenvalues(const HermitianDecomposition*, const Real, const Vector*);
+void UpdateHermitianDecomposition(HermitianDecomposition*, const Real, const Vector*);
+void LowRankUpdateHermitianDecomposition(HermitianDecomposition*, const Real*, const Matrix*);
+[[nodiscard]] Vector* SparseEigenvalues(const SparseMatrix*, const Natural, const Natural, Natural*);
+[[nodiscard]] Vector* OperatorEigenvalues(const Operator, void*, const Natural, const Natural, const Natural, Natural*);
+
+
+// Polynomial roots.
+
+[[nodiscard]] Vector* Roots(const Vector*);
+
+
+// Pseudospectra.
+
+[[nodiscard]] Pseudospectrum* Pseudospectra(const Matrix*, const Complex, const Complex, const Natural, const Natural);
+Natural SavePseudospectrum(const char*, const Pseudospectrum*);
+
+
+// Matrix functions.
+
+[[nodiscard]] SchurDecomposition* NewSchurDecomposition(const Matrix*);
+[[nodiscard]] Vector* SchurEigenvalues(const SchurDecomposition*);
+[[nodiscard]] Matrix* MatrixFunction(const SchurDecomposition*, const Taylor, const Radius, Natural*);
+[[nodiscard]] Matrix* MatrixExponential(const SchurDecomposition*, Natural*);
+[[nodiscard]] Matrix* MatrixLogarithm(const SchurDecomposition*, Natural*);
+
+
+// Spectral estimates.
+
+[[nodiscard]] Vector* SpectralBounds(const Matrix*);
+Real SpectralRadiusBound(const Matrix*);
+[[nodiscard]] Vector* DominantEigenvalues(const Matrix*, const Natural, const Real, const Natural);
+[[nodiscard]] Vector* SparseDominantEigenvalues(const SparseMatrix*, const Natural, const Real, const Natural);
+[[nodiscard]] Vector* OperatorDominantEigenvalues(const Operator, void*, const Natural, const Natural, const Real, const Natural);
+
+
+// Type-generic kernels, on Real, Reals, Complex and Complexs arrays.
+
+#define DotProduct(x, y, n) GNR_GENERIC(GNR_DOT, x)((x), (y), (n))
+#define EuclideanNorm(x, n) GNR_GENERIC(GNR_N2, x)((x), (n))
+#define MultiplyAdd(y, x, a, n) GNR_GENERIC(GNR_MA, y)((y), (x), (a), (n))
+#define HouseholderLeft(a, v, n, m) GNR_GENERIC(GNR_HSL, a)((a), (v), (n), (m))
+#define HouseholderRight(a, v, n, m) GNR_GENERIC(GNR_HSR, a)((a), (v), (n), (m))
+#define GivensLeft(a, c, s, n, k) GNR_GENERIC(GNR_GVL, a)((a), (c), (s), (n), (k))
+#define GivensRight(a, c, s, n, k) GNR_GENERIC(GNR_GVR, a)((a), (c), (s), (n), (k))
+#define HouseholderQR(a, v, n) GNR_GENERIC(GNR_QR, a)((a), (v), (n))
 
 
 // Output.
@@ -11,9 +11,144 @@
 #ifndef NAQRA_MATRIX_H
 #define NAQRA_MATRIX_H
 
+// Booleans.
+#include <stdbool.h>
+
+// Atomics.
+#include <stdatomic.h>
+
+// Time.
+#include <time.h>
+
 // Vectors.
 #include "./Vector.h"
 
+// Tuning.
+#include "./Tuning.h"
+
+// Constants.
+
+#ifndef HSL0
+
+// Short vectors' cutoff in Householder products, at least 4.
+#define HSL0 4
+#endif
+
+#ifndef SEQ0
+
+// Rotations per block in Givens sequences.
+#define SEQ0 32
+#endif
+
+#ifndef RFN0
+
+// Refinement steps.
+#define RFN0 3
+#endif
+
+#ifndef RFN1
+
+// Refinement window, relative.
+#define RFN1 1.0E-3
+#endif
+
+#ifndef RFN2
+
+// Clustering window, relative.
+#define RFN2 1.0E-2
+#endif
+
+#ifndef RFN3
+
+// Refinement steps for clusters, at most.
+#define RFN3 8
+#endif
+
+#ifndef EXC0
+
+// Steps without deflation before an exceptional shift.
+#define EXC0 10
+#endif
+
+// Structure.
+
+#define STR_GENERAL 0 // No structure.
+#define STR_UPPER 1 // Upper triangular.
+#define STR_LOWER 2 // Lower triangular.
+#define STR_HESSENBERG 4 // Upper Hessenberg.
+#define STR_REAL 8 // Real entries.
+#define STR_HERMITIAN 16 // Hermitian.
+#define STR_REDUCIBLE 32 // Block upper triangular, split into blocks.
+
+// Deflation callback, index, eigenvalue, iterations and data, returning false to cancel.
+typedef bool (*Deflation)(const Natural, const Complex, const Natural, void*);
+
+// Status.
+
+#define STS_CONVERGED 0 // Every eigenvalue converged.
+#define STS_ITERATIONS 1 // Iterations' limit reached.
+#define STS_DEADLINE 2 // Time limit reached.
+#define STS_CANCELLED 3 // Cancelled.
+#define STS_FAILED 4 // Input or scratch file unavailable.
+
+// Budget, limits of the QR algorithm.
+typedef struct {
+
+    // Time limit in seconds, 0 for none.
+    Real R0;
+
+    // Maximum iterations, 0 for ITM0.
+    Natural N0;
+
+    // Cancellation flag, NULL for none.
+    const atomic_bool* B0;
+
+} Budget;
+
+/**
+ * @brief Time [Tm].
+ * 
+ * @return Real Real Number [R], seconds.
+ */
+static inline Real Tm_0_R(void) {
+    struct timespec T0;
+    timespec_get(&T0, TIME_UTC);
+
+    return (Real) T0.tv_sec + 1.0E-9 * (Real) T0.tv_nsec;
+}
+
+/**
+ * @brief Budget check [Chk].
+ * 
+ * @param Bg0 Budget [Bg], NULL for ITM0 only.
+ * @param R0 Real Number [R], starting time.
+ * @param N0 Iterations [N].
+ * @return Natural Status [N], STS_CONVERGED while within the budget.
+ */
+static inline Natural Chk_BgRN_N(const Budget* Bg0, const Real R0, const Natural N0) {
+    if(N0 >= (Bg0 != NULL && Bg0->N0 > 0 && Bg0->N0 < ITM0 ? Bg0->N0 : ITM0)) return STS_ITERATIONS;
+    if(Bg0 == NULL) return STS_CONVERGED;
+
+    if(Bg0->B0 != NULL && atomic_load_explicit(Bg0->B0, memory_order_relaxed)) return STS_CANCELLED;
+    if(Bg0->R0 > 0.0 && Tm_0_R() - R0 >= Bg0->R0) return STS_DEADLINE;
+
+    return STS_CONVERGED;
+}
+
+// Compact Hessenberg storage, column j holding rows 0 to j + 1.
+
+/**
+ * @brief Compact index [Cx].
+ * 
+ * @param N0 Row [N], N0 <= N1 + 1.
+ * @param N1 Column [N].
+ * @return Natural Index [N].
+ */
+static inline Natural Cx_NN_N(const Natural N0, const Natural N1) { return N1 * (N1 + 3) / 2 + N0; }
+
+void Cpt_ChsnqtN_0(Complex*, const Natural);
+void Xpd_ChctN_0(Complex*, const Natural);
+
 // Householder products.
 
 void Hsl_CqtCvNN_0(Complex*, const Complex*, const Natural, const Natural);
@@ -22,16 +157,54 @@ void Hsr_CqtCvNN_0(Complex*, const Complex*, const Natural, const Natural);
 // Givens products.
 
 void Gvl_ChsnqtCCNN_0(Complex*, const Complex, const Complex, const Natural, const Natural);
+void Gvl_ChsnqtCCNNNN_0(Complex*, const Complex, const Complex, const Natural, const Natural, const Natural, const Natural);
 void Gvrhr_ChsnqtCCNN_0(Complex*, const Complex, const Complex, const Natural, const Natural);
+void Gvrhr_ChsnqtCCNNNN_0(Complex*, const Complex, const Complex, const Natural, const Natural, const Natural, const Natural);
+
+// Givens sequences.
+
+void Gvsl_ChsnqtCvNNNNNN_0(Complex*, const Complex*, const Natural, const Natural, const Natural, const Natural, const Natural, const Natural);
+void Gvsrhr_ChsnqtCvNNNNN_0(Complex*, const Complex*, const Natural, const Natural, const Natural, const Natural, const Natural);
+void Gvsl_ChctCvNNNNN_0(Complex*, const Complex*, const Natural, const Natural, const Natural, const Natural, const Natural);
+void Gvsrhr_ChctCvNNNN_0(Complex*, const Complex*, const Natural, const Natural, const Natural, const Natural);
 
 // Hessenberg form.
 
 void Hsn_CqtN_0(Complex*, const Natural);
+void Hsn_CqtCqtN_0(Complex*, Complex*, const Natural);
 
 // QR algorithm.
 
 [[nodiscard]] Complex* Eig_CCCC_C(const Complex, const Complex, const Complex, const Complex);
+void Qrs_ChsnqtCvtCNN_0(Complex*, Complex*, const Complex, const Natural, const Natural);
 void Eig_ChsnqtN_0(Complex *, const Natural);
+void Eig_ChsnqtCqtN_0(Complex*, Complex*, const Natural);
+void Qrs_ChctCvtCNN_0(Complex*, Complex*, const Complex, const Natural, const Natural);
+void Eig_ChctN_0(Complex*, const Natural);
+Natural Eig_ChsnqtDfPBgN_N(Complex*, const Deflation, void*, const Budget*, const Natural);
+Natural Eig_ChctDfPBgN_N(Complex*, const Deflation, void*, const Budget*, const Natural);
+Natural Eig_ChctCvtDfPBgN_N(Complex*, Complex*, const Deflation, void*, const Budget*, const Natural);
+
+// Warm start.
+
+void Wrm_CvtCN_0(Complex*, const Complex, const Natural);
+
+// Refinement.
+
+void Slv_ChsnqtCvtN_0(Complex*, Complex*, const Natural);
+Natural Rfn_ChsnqCvtBvtN_N(const Complex*, Complex*, bool*, const Natural);
+
+// Products.
+
+void Mv_CmCvCvtNN_0(const Complex*, const Complex*, Complex*, const Natural, const Natural);
+
+// Spectral bounds.
+
+Real Grs_CqRvtN_R(const Complex*, Real*, const Natural);
+
+// Structure.
+
+Natural Str_CqNvtN_N(const Complex*, Natural*, const Natural);
 
 // Output.
 
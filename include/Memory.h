@@ -0,0 +1,69 @@
+/**
+ * @file Memory.h
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Aligned allocations.
+ * @date 2024-12-06
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ * Every allocation is aligned to ALN0 bytes. Large blocks are mapped directly
+ * and, optionally, backed by huge pages. No NUMA placement is attempted: pages
+ * land wherever they are first written, threads not being pinned.
+ */
+
+#ifndef NAQRA_MEMORY_H
+#define NAQRA_MEMORY_H
+
+// Base.
+#include <stddef.h>
+
+
+// Constants.
+
+#ifndef ALN0
+
+// Alignment, bytes.
+#define ALN0 64
+#endif
+
+#ifndef MMP0
+
+// Minimum mapped allocation, bytes.
+#define MMP0 (1 << 21)
+#endif
+
+
+// Huge pages.
+
+#define HGP_NONE 0 // Regular pages.
+#define HGP_TRANSPARENT 1 // Transparent huge pages, advised.
+#define HGP_EXPLICIT 2 // Explicit huge pages, transparent as fallback.
+
+
+// Allocator.
+
+// Custom allocator, NULL hooks restore the default one.
+typedef struct {
+
+    // Allocation.
+    void* (*Alc)(size_t);
+
+    // Release.
+    void (*Fr)(void*);
+
+} Allocator;
+
+void Sa_A_0(const Allocator);
+void Hgp_N_0(const size_t);
+
+// Allocations.
+
+[[nodiscard]] void* Alc_NN_P(const size_t, const size_t);
+[[nodiscard]] void* Calc_NN_P(const size_t, const size_t);
+void Fr_P_0(void*);
+
+// Mappings.
+
+[[nodiscard]] void* Adp_PN_P(void*, const size_t);
+
+#endif
@@ -0,0 +1,57 @@
+/**
+ * @file Parallel.h
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Multithreaded QR sweeps, bulge chasing and bisection.
+ * @date 2024-12-02
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef NAQRA_PARALLEL_H
+#define NAQRA_PARALLEL_H
+
+// Matrices.
+#include "./Matrix.h"
+#include "./Hermitian.h"
+
+
+// Constants.
+
+#ifndef PAR0
+
+// Minimum active size for multithreaded sweeps.
+#define PAR0 256
+#endif
+
+#ifndef BLK0
+
+// Columns (rows) per block in multithreaded sweeps.
+#define BLK0 32
+#endif
+
+
+// Threads.
+
+Natural Thr_0_N(void);
+
+// Copy.
+
+void Cp_CmtCmNN_0(Complex*, const Complex*, const Natural, const Natural);
+
+// QR algorithm.
+
+void Eig_ChctNN_0(Complex*, const Natural, const Natural);
+Natural Eig_ChctDfPBgNN_N(Complex*, const Deflation, void*, const Budget*, const Natural, const Natural);
+Natural Eig_ChctCvtDfPBgNN_N(Complex*, Complex*, const Deflation, void*, const Budget*, const Natural, const Natural);
+void Eig_ChsnqtNN_0(Complex*, const Natural, const Natural);
+
+// Tridiagonal form.
+
+void Trd_ChbtRvtRvtNNN_0(Complex*, Real*, Real*, const Natural, const Natural, const Natural);
+
+// Subset eigenvalues.
+
+void Sbs_RvRvRvtNNNN_0(const Real*, const Real*, Real*, const Natural, const Natural, const Natural, const Natural);
+
+#endif
@@ -0,0 +1,49 @@
+/**
+ * @file Pseudospectra.h
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Pseudospectra, smallest singular values on the Schur form.
+ * @date 2024-12-19
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ * The matrix is reduced once to its upper triangular Schur form T, as
+ * sigma_min(zI - A) = sigma_min(zI - T). At every point z, inverse Lanczos
+ * iterates on ((zI - T)^H (zI - T))^-1 through two triangular solves, O(N^2)
+ * per iteration instead of the O(N^3) of a singular value decomposition.
+ */
+
+#ifndef NAQRA_PSEUDOSPECTRA_H
+#define NAQRA_PSEUDOSPECTRA_H
+
+// Matrices.
+#include "./Matrix.h"
+
+// Tridiagonal eigenvalues.
+#include "./Hermitian.h"
+
+
+// Constants.
+
+#ifndef PSD0
+
+// Inverse Lanczos tolerance, relative.
+#define PSD0 1.0E-8
+#endif
+
+#ifndef PSD1
+
+// Inverse Lanczos iterations.
+#define PSD1 64
+#endif
+
+
+// Schur form.
+
+Natural Sch_CqtN_N(Complex*, const Natural);
+
+// Smallest singular values.
+
+Real Smn_CuCN_R(const Complex*, const Complex, const Natural);
+void Psd_CuCvRvtNNN_0(const Complex*, const Complex*, Real*, const Natural, const Natural, const Natural);
+
+#endif
@@ -0,0 +1,55 @@
+/**
+ * @file Real.h
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Real matrices, column-major storage, real arithmetic.
+ * @date 2024-12-13
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * Complex conjugate pairs are handled through Francis double shifts.
+ */
+
+#ifndef NAQRA_REAL_H
+#define NAQRA_REAL_H
+
+// Booleans.
+#include <stdbool.h>
+
+// Complex numbers.
+#include "./Complex.h"
+
+
+// Constants.
+
+#ifndef RQR0
+
+// Double shifted steps per eigenvalue before giving up.
+#define RQR0 60
+#endif
+
+#ifndef RQR1
+
+// Steps between exceptional shifts.
+#define RQR1 10
+#endif
+
+#ifndef RQR2
+
+// Unit roundoff, relative deflation threshold.
+#define RQR2 0x1.0p-52
+#endif
+
+
+// Balancing.
+
+void Bln_RqtN_0(Real*, const Natural);
+
+// Hessenberg form.
+
+void Hsn_RqtN_0(Real*, const Natural);
+
+// QR algorithm.
+
+bool Eig_RhsnqtCvtN_B(Real*, Complex*, const Natural);
+
+#endif
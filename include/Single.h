@@ -0,0 +1,178 @@
+/**
+ * @file Single.h
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Single precision complex numbers, vectors and matrices.
+ * @date 2024-12-04
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ * Kernels work on pairs of complex numbers, packed in a single register.
+ */
+
+#ifndef NAQRA_SINGLE_H
+#define NAQRA_SINGLE_H
+
+// Matrices.
+#include "./Matrix.h"
+
+
+// Types.
+
+typedef float32_t Reals; // Real numbers, single precision.
+typedef float32x2_t Complexs; // Complex numbers, single precision.
+typedef float32x4_t Complexs2; // Complex numbers, single precision (pair).
+
+
+// Constants.
+
+#ifndef TOLs0
+
+// Relative deflation tolerance, single precision.
+#define TOLs0 1.0E-6
+#endif
+
+
+// Conversions.
+
+/**
+ * @brief Demote [Dm].
+ * 
+ * @param C0 Complex Number [C].
+ * @return Complexs Single Complex Number [Cs].
+ */
+static inline Complexs Dm_C_Cs(const Complex C0) { return vcvt_f32_f64(C0); }
+
+/**
+ * @brief Promote [Pm].
+ * 
+ * @param Cs0 Single Complex Number [Cs].
+ * @return Complex Complex Number [C].
+ */
+static inline Complex Pm_Cs_C(const Complexs Cs0) { return vcvt_f64_f32(Cs0); }
+
+// Pairs.
+
+/**
+ * @brief Load [Ld].
+ * 
+ * @param Csv0 Single Complex Vector [Csv], two entries.
+ * @return Complexs2 Single Complex Pair [Cs2].
+ */
+static inline Complexs2 Ld_Csv_Cs2(const Complexs* Csv0) { return vcombine_f32(Csv0[0], Csv0[1]); }
+
+/**
+ * @brief Store [St].
+ * 
+ * @param Csvt0 Single Complex Vector [Csv], Target [t], two entries.
+ * @param Cs20 Single Complex Pair [Cs2].
+ */
+static inline void St_CsvtCs2_0(Complexs* Csvt0, const Complexs2 Cs20) { Csvt0[0] = vget_low_f32(Cs20); Csvt0[1] = vget_high_f32(Cs20); }
+
+/**
+ * @brief Duplicate [Dp].
+ * 
+ * @param Cs0 Single Complex Number [Cs].
+ * @return Complexs2 Single Complex Pair [Cs2].
+ */
+static inline Complexs2 Dp_Cs_Cs2(const Complexs Cs0) { return vcombine_f32(Cs0, Cs0); }
+
+/**
+ * @brief Sum [Sm].
+ * 
+ * @param Cs20 Single Complex Pair [Cs2].
+ * @return Complexs Single Complex Number [Cs].
+ */
+static inline Complexs Sm_Cs2_Cs(const Complexs2 Cs20) { return vadd_f32(vget_low_f32(Cs20), vget_high_f32(Cs20)); }
+
+/**
+ * @brief Conjugate [Cj].
+ * 
+ * @param Cs20 Single Complex Pair [Cs2].
+ * @return Complexs2 Single Complex Pair [Cs2].
+ */
+static inline Complexs2 Cj_Cs2_Cs2(const Complexs2 Cs20) { const register Complexs2 Cs21 = {1.0f, -1.0f, 1.0f, -1.0f}; return vmulq_f32(Cs20, Cs21); }
+
+/**
+ * @brief Multiply [M].
+ * 
+ * @param Cs20 Single Complex Pair [Cs2].
+ * @param Cs21 Single Complex Pair [Cs2].
+ * @return Complexs2 Single Complex Pair [Cs2].
+ */
+static inline Complexs2 M_Cs2Cs2_Cs2(const Complexs2 Cs20, const Complexs2 Cs21) {
+    const register Complexs2 Cs22 = {-1.0f, 1.0f, -1.0f, 1.0f};
+
+    const register Complexs2 Cs23 = vtrn1q_f32(Cs21, Cs21); // Real parts.
+    const register Complexs2 Cs24 = vtrn2q_f32(Cs21, Cs21); // Imaginary parts.
+
+    return vfmaq_f32(vmulq_f32(Cs20, Cs23), vmulq_f32(vrev64q_f32(Cs20), Cs22), Cs24);
+}
+
+/**
+ * @brief Multiply [M].
+ * 
+ * @param Cs20 Single Complex Pair [Cs2].
+ * @param Cs21 Conjugate Single Complex Pair [Cs2cj].
+ * @return Complexs2 Single Complex Pair [Cs2].
+ */
+static inline Complexs2 M_Cs2Cs2cj_Cs2(const Complexs2 Cs20, const Complexs2 Cs21) { return M_Cs2Cs2_Cs2(Cs20, Cj_Cs2_Cs2(Cs21)); }
+
+/**
+ * @brief Multiply [M].
+ * 
+ * @param Cs20 Conjugate Single Complex Pair [Cs2cj].
+ * @param Cs21 Single Complex Pair [Cs2].
+ * @return Complexs2 Single Complex Pair [Cs2].
+ */
+static inline Complexs2 M_Cs2cjCs2_Cs2(const Complexs2 Cs20, const Complexs2 Cs21) { return M_Cs2Cs2_Cs2(Cj_Cs2_Cs2(Cs20), Cs21); }
+
+
+// Vectors.
+
+// Copy.
+
+void Cp_CsvtCsvN_0(Complexs*, const Complexs*, const Natural);
+void Dm_CsvtCvN_0(Complexs*, const Complex*, const Natural);
+void Pm_CvtCsvN_0(Complex*, const Complexs*, const Natural);
+
+// Complex-Real arithmetic.
+
+void M_CsvRs_0(Complexs*, const Reals, const Natural);
+void D_CsvRs_0(Complexs*, const Reals, const Natural);
+
+// Dot product.
+
+Complexs Dot_CsrvCscvN_Cs(const Complexs*, const Complexs*, const Natural);
+
+// Norms.
+
+Reals N2_CsvN_Rs(const Complexs*, const Natural);
+void Nz2_CsvN_0(Complexs*, const Natural);
+
+
+// Matrices.
+
+// Householder products.
+
+void Hsl_CsqtCsvNN_0(Complexs*, const Complexs*, const Natural, const Natural);
+void Hsr_CsqtCsvNN_0(Complexs*, const Complexs*, const Natural, const Natural);
+
+// Givens products.
+
+void Gvl_CshsnqtCsCsNN_0(Complexs*, const Complexs, const Complexs, const Natural, const Natural);
+void Gvrhr_CshsnqtCsCsNN_0(Complexs*, const Complexs, const Complexs, const Natural, const Natural);
+
+// Hessenberg form.
+
+void Hsn_CsqtN_0(Complexs*, const Natural);
+
+// QR algorithm.
+
+void Qrs_CshsnqtCsvtCsNN_0(Complexs*, Complexs*, const Complexs, const Natural, const Natural);
+void Eig_CshsnqtN_0(Complexs*, const Natural);
+
+// Output.
+
+void Pn_CsmNN_0(const Complexs*, const Natural, const Natural);
+
+#endif
@@ -0,0 +1,63 @@
+/**
+ * @file Sparse.h
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Matrix-free eigensolvers and compressed sparse row matrices.
+ * @date 2024-12-12
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ * Operators are only known through their action on vectors.
+ */
+
+#ifndef NAQRA_SPARSE_H
+#define NAQRA_SPARSE_H
+
+// Matrices.
+#include "./Matrix.h"
+
+
+// Constants.
+
+#ifndef KRY0
+
+// Relative residual of converged Ritz values.
+#define KRY0 1.0E-10
+#endif
+
+#ifndef KRY1
+
+// Maximum restarts.
+#define KRY1 1000
+#endif
+
+#ifndef RBK0
+
+// Rows per block in basis updates.
+#define RBK0 256
+#endif
+
+
+// Ordering.
+
+#define SRT_MAGNITUDE 0 // Largest magnitude first.
+#define SRT_REAL 1 // Largest real part first.
+
+
+// Operators.
+
+// Mat-vec callback, writes A x into its second argument.
+typedef void (*Operator)(const Complex*, Complex*, void*);
+
+// Compressed sparse row product.
+
+void Mv_CvNvNvCvCvtN_0(const Complex*, const Natural*, const Natural*, const Complex*, Complex*, const Natural);
+
+// Implicitly restarted Arnoldi.
+
+Natural Ira_OpPCvtNNNN_N(const Operator, void*, Complex*, const Natural, const Natural, const Natural, const Natural);
+
+// Block power iteration.
+
+Natural Bpw_OpPCvtRNNN_N(const Operator, void*, Complex*, const Real, const Natural, const Natural, const Natural);
+
+#endif
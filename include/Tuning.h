@@ -0,0 +1,78 @@
+/**
+ * @file Tuning.h
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Runtime tuning profile.
+ * @date 2024-12-14
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ * Block sizes and thresholds start from their compile-time defaults and are
+ * overridden at load time by the profile at NAQRA_TUNING, or ~/.naqra.
+ */
+
+#ifndef NAQRA_TUNING_H
+#define NAQRA_TUNING_H
+
+// Complex numbers.
+#include "./Complex.h"
+
+
+// Constants.
+
+#ifndef ATN0
+
+// Runs per candidate in autotuning.
+#define ATN0 3
+#endif
+
+#ifndef ATN1
+
+// QR iterations per autotuning run.
+#define ATN1 64
+#endif
+
+#ifndef ATN2
+
+// Autotuning size.
+#define ATN2 192
+#endif
+
+
+// Tuning.
+
+// Tuning profile.
+typedef struct {
+
+    // Short vectors' cutoff in Householder products, HSL0.
+    Natural N0;
+
+    // Rotations per block in Givens sequences, SEQ0.
+    Natural N1;
+
+    // Minimum active size for multithreaded sweeps, PAR0.
+    Natural N2;
+
+    // Columns (rows) per block in multithreaded sweeps, BLK0.
+    Natural N3;
+
+    // Bandwidth of the two-stage tridiagonal form, BND0.
+    Natural N4;
+
+    // Minimum size for the two-stage tridiagonal form, TRD0.
+    Natural N5;
+
+} Tuning;
+
+Tuning Tn_0_Tn(void);
+void St_Tn_0(const Tuning);
+
+// Profiles.
+
+Natural Ld_S_N(const char*);
+Natural Sv_S_N(const char*);
+
+// Autotuning.
+
+Tuning Atn_0_Tn(void);
+
+#endif
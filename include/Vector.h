@@ -14,6 +14,16 @@
 // Complex numbers.
 #include "./Complex.h"
 
+
+// Kernels.
+
+#define KRN_BASELINE 0 // Armv8-A.
+#define KRN_FCMA 1 // Armv8.3-A, complex instructions.
+
+// Kernels.
+
+Natural Krn_0_N(void);
+
 // Copy.
 
 void Cp_CvtCvN_0(Complex*, const Complex*, Natural);
@@ -23,6 +33,10 @@ void Cp_CvtCvN_0(Complex*, const Complex*, Natural);
 void M_CvR_0(Complex* , const Real, const Natural);
 void D_CvR_0(Complex* , const Real, const Natural);
 
+// Complex-Complex arithmetic.
+
+void Ma_CvtCvCN_0(Complex*, const Complex*, const Complex, const Natural);
+
 // Dot product.
 
 Complex Dot_CrvCcvN_C(const Complex*, const Complex*, const Natural);
@@ -0,0 +1,112 @@
+/**
+ * @file Daemon.h
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief naqra-daemon protocol, shared by the daemon and its load generator.
+ * @date 2024-12-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ * Requests are a Request record followed by a matrix in the binary format of
+ * include/Format.h, header and entries. With REQ_SHARED the matrix is instead
+ * written to a memfd whose descriptor travels along the record, SCM_RIGHTS,
+ * and is mapped by the daemon. The memfd must carry F_SEAL_SHRINK and
+ * F_SEAL_WRITE, otherwise the request fails.
+ * 
+ * Replies are a Reply record followed by the converged eigenvalues, two
+ * float64 each, in any order across the requests of a connection.
+ */
+
+#ifndef NAQRA_DAEMON_H
+#define NAQRA_DAEMON_H
+
+// Fixed width integers.
+#include <stdint.h>
+
+// Interface.
+#include "../include/Interface.h"
+
+
+// Constants.
+
+#define DMN0 "/tmp/naqra.sock" // Default socket, overridden by NAQRA_SOCKET.
+
+#ifndef DMN1
+
+// Maximum requests per batch.
+#define DMN1 64
+#endif
+
+#ifndef DMN2
+
+// Largest size coalesced into batches.
+#define DMN2 128
+#endif
+
+#ifndef DMN3
+
+// Pending connections.
+#define DMN3 64
+#endif
+
+
+// Request flags.
+
+#define REQ_INLINE 0 // Matrix on the stream.
+#define REQ_SHARED 1 // Matrix in a sealed memfd.
+
+
+// Records.
+
+// Request record.
+typedef struct {
+
+    // Tag, echoed in the reply.
+    uint64_t N0;
+
+    // Flags, REQ_*.
+    uint64_t N1;
+
+} Request;
+
+// Reply record.
+typedef struct {
+
+    // Tag.
+    uint64_t N0;
+
+    // Status, STS_*.
+    uint64_t N1;
+
+    // Eigenvalues, converged ones only unless STS_CONVERGED.
+    uint64_t N2;
+
+    // Batch size.
+    uint64_t N3;
+
+    // Queueing, nanoseconds.
+    uint64_t N4;
+
+    // Solution, nanoseconds.
+    uint64_t N5;
+
+    // Service, receipt to reply, nanoseconds.
+    uint64_t N6;
+
+    // Reserved, zero.
+    uint64_t N7;
+
+} Reply;
+
+_Static_assert(sizeof(Reply) == 64, "Unexpected reply record size.");
+
+/**
+ * @brief Socket path [Sck].
+ * 
+ * @return const char* Path, NAQRA_SOCKET or DMN0.
+ */
+static inline const char* Sck_0_S(void) {
+    const char* S0 = getenv("NAQRA_SOCKET");
+    return S0 != NULL && *S0 != '\0' ? S0 : DMN0;
+}
+
+#endif
@@ -0,0 +1,296 @@
+/**
+ * @file Kernels.h
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Type-generic kernels' template, see include/Generic.h.
+ * @date 2024-12-20
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ * Included by NAQRA_Generic.c once per type, without include guard, after
+ * defining:
+ * 
+ *  - GNR_T, GNR_U, GNR_W, scalar, real and packed types.
+ *  - GNR_K, scalars per packed register.
+ *  - GNR_L, GNR_LR, type letters.
+ *  - GNR_LD, GNR_ST, GNR_BC, GNR_Z, GNR_AD, GNR_MLB, GNR_FMB, GNR_FMJ,
+ *    GNR_SQ, GNR_SM, GNR_RSM, packed load, store, broadcast, zero, sum,
+ *    product, multiply-add, conjugate multiply-add, squares' multiply-add,
+ *    horizontal sum and real horizontal sum.
+ *  - GNR_ZERO, GNR_ADD, GNR_SUB, GNR_NEG, GNR_MUL, GNR_MLJ, GNR_CJM, GNR_CJ,
+ *    GNR_SCL, GNR_SQA, GNR_PHS, GNR_SQRT, scalar zero, sum, difference,
+ *    negation, products x * y, x * conj(y) and conj(x) * y, conjugate,
+ *    real scaling, squared modulus, phase and square root.
+ * 
+ * Every one of them is undefined at the end.
+ */
+
+// Dot product.
+
+/**
+ * @brief Dot product [Dotg], generated.
+ * 
+ * @param Gv0 Vector [Gv].
+ * @param Gv1 Vector [Gv], conjugated.
+ * @param N0 Entries [N].
+ * @return GNR_T Scalar [G].
+ */
+GNR_T GNR_DOT(GNR_L, GNR_LR)(const GNR_T* Gv0, const GNR_T* Gv1, const Natural N0) {
+    register Natural N1 = 0;
+    register GNR_W W0 = GNR_Z, W1 = GNR_Z;
+
+    for(; N1 + 2 * GNR_K <= N0; N1 += 2 * GNR_K) {
+        W0 = GNR_FMJ(W0, GNR_LD(Gv0 + N1), GNR_LD(Gv1 + N1));
+        W1 = GNR_FMJ(W1, GNR_LD(Gv0 + N1 + GNR_K), GNR_LD(Gv1 + N1 + GNR_K));
+    }
+
+    for(; N1 + GNR_K <= N0; N1 += GNR_K)
+        W0 = GNR_FMJ(W0, GNR_LD(Gv0 + N1), GNR_LD(Gv1 + N1));
+
+    register GNR_T G0 = GNR_SM(GNR_AD(W0, W1));
+
+    for(; N1 < N0; ++N1)
+        G0 = GNR_ADD(G0, GNR_MLJ(Gv0[N1], Gv1[N1]));
+
+    return G0;
+}
+
+// Norms.
+
+/**
+ * @brief Euclidean norm [N2g], generated.
+ * 
+ * @param Gv0 Vector [Gv].
+ * @param N0 Entries [N].
+ * @return GNR_U Real scalar [Gr].
+ */
+GNR_U GNR_N2(GNR_L, GNR_LR)(const GNR_T* Gv0, const Natural N0) {
+    register Natural N1 = 0;
+    register GNR_W W0 = GNR_Z, W1 = GNR_Z;
+
+    for(; N1 + 2 * GNR_K <= N0; N1 += 2 * GNR_K) {
+        W0 = GNR_SQ(W0, GNR_LD(Gv0 + N1));
+        W1 = GNR_SQ(W1, GNR_LD(Gv0 + N1 + GNR_K));
+    }
+
+    for(; N1 + GNR_K <= N0; N1 += GNR_K)
+        W0 = GNR_SQ(W0, GNR_LD(Gv0 + N1));
+
+    register GNR_U Gr0 = GNR_RSM(GNR_AD(W0, W1));
+
+    for(; N1 < N0; ++N1)
+        Gr0 += GNR_SQA(Gv0[N1]);
+
+    return GNR_SQRT(Gr0);
+}
+
+// Multiply-Add.
+
+/**
+ * @brief Multiply-Add [Mag], generated.
+ * 
+ * @param Gvt0 Vector [Gv], Target [t].
+ * @param Gv0 Vector [Gv].
+ * @param G0 Scalar [G].
+ * @param N0 Entries [N].
+ */
+void GNR_MA(GNR_L, GNR_LR)(GNR_T* Gvt0, const GNR_T* Gv0, const GNR_T G0, const Natural N0) {
+    register Natural N1 = 0;
+    const register GNR_W W0 = GNR_BC(G0);
+
+    for(; N1 + 2 * GNR_K <= N0; N1 += 2 * GNR_K) {
+        GNR_ST(Gvt0 + N1, GNR_FMB(GNR_LD(Gvt0 + N1), GNR_LD(Gv0 + N1), W0));
+        GNR_ST(Gvt0 + N1 + GNR_K, GNR_FMB(GNR_LD(Gvt0 + N1 + GNR_K), GNR_LD(Gv0 + N1 + GNR_K), W0));
+    }
+
+    for(; N1 + GNR_K <= N0; N1 += GNR_K)
+        GNR_ST(Gvt0 + N1, GNR_FMB(GNR_LD(Gvt0 + N1), GNR_LD(Gv0 + N1), W0));
+
+    for(; N1 < N0; ++N1)
+        Gvt0[N1] = GNR_ADD(Gvt0[N1], GNR_MUL(Gv0[N1], G0));
+}
+
+// Householder products.
+
+/**
+ * @brief Householder Left [Hslg], generated, (I - 2vv^H) A.
+ * 
+ * @param Gqt0 Square Matrix [Gq], Target [t].
+ * @param Gv0 Vector [Gv], unit, its last N1 entries only being read.
+ * @param N0 Rows and Columns [N].
+ * @param N1 Entries [N].
+ */
+void GNR_HSL(GNR_L, GNR_LR)(GNR_T* Gqt0, const GNR_T* Gv0, const Natural N0, const Natural N1) {
+    const register Natural N2 = N0 - N1;
+
+    for(register Natural N3 = 0; N3 < N0; ++N3) {
+        GNR_T* Gv1 = Gqt0 + N3 * N0 + N2;
+        GNR_MA(GNR_L, GNR_LR)(Gv1, Gv0 + N2, GNR_SCL(GNR_DOT(GNR_L, GNR_LR)(Gv1, Gv0 + N2, N1), -2.0), N1);
+    }
+}
+
+/**
+ * @brief Householder Right [Hsrg], generated, A (I - 2vv^H).
+ * 
+ * @param Gqt0 Square Matrix [Gq], Target [t].
+ * @param Gv0 Vector [Gv], unit, its last N1 entries only being read.
+ * @param N0 Rows and Columns [N].
+ * @param N1 Entries [N].
+ */
+void GNR_HSR(GNR_L, GNR_LR)(GNR_T* Gqt0, const GNR_T* Gv0, const Natural N0, const Natural N1) {
+    register Natural N2 = 0, N3;
+    const register Natural N4 = N0 - N1;
+
+    for(; N2 + GNR_K <= N0; N2 += GNR_K) { // Packed rows.
+        register GNR_W W0 = GNR_Z;
+
+        for(N3 = N4; N3 < N0; ++N3)
+            W0 = GNR_FMB(W0, GNR_LD(Gqt0 + N3 * N0 + N2), GNR_BC(Gv0[N3]));
+
+        for(N3 = N4; N3 < N0; ++N3)
+            GNR_ST(Gqt0 + N3 * N0 + N2, GNR_FMB(GNR_LD(Gqt0 + N3 * N0 + N2), W0, GNR_BC(GNR_SCL(GNR_CJ(Gv0[N3]), -2.0))));
+    }
+
+    for(; N2 < N0; ++N2) { // Last rows.
+        register GNR_T G0 = GNR_ZERO;
+
+        for(N3 = N4; N3 < N0; ++N3)
+            G0 = GNR_ADD(G0, GNR_MUL(Gqt0[N3 * N0 + N2], Gv0[N3]));
+
+        for(N3 = N4; N3 < N0; ++N3)
+            Gqt0[N3 * N0 + N2] = GNR_ADD(Gqt0[N3 * N0 + N2], GNR_MUL(G0, GNR_SCL(GNR_CJ(Gv0[N3]), -2.0)));
+    }
+}
+
+// Givens products.
+
+/**
+ * @brief Givens Left [Gvlg], generated, rows N1 and N1 + 1, columns N1 + 1 onwards.
+ * 
+ * @param Ghsnqt0 Hessenberg Square Matrix [Ghsnq], Target [t].
+ * @param G0 Scalar [G], cosine.
+ * @param G1 Scalar [G], sine.
+ * @param N0 Rows and Columns [N].
+ * @param N1 Index [N].
+ */
+void GNR_GVL(GNR_L, GNR_LR)(GNR_T* Ghsnqt0, const GNR_T G0, const GNR_T G1, const Natural N0, const Natural N1) {
+    for(register Natural N2 = (N1 + 1) * N0 + N1; N2 < N0 * N0; N2 += N0) { // Strided, scalar.
+        const register GNR_T G2 = Ghsnqt0[N2];
+        const register GNR_T G3 = Ghsnqt0[N2 + 1];
+
+        Ghsnqt0[N2] = GNR_ADD(GNR_CJM(G0, G2), GNR_CJM(G1, G3));
+        Ghsnqt0[N2 + 1] = GNR_SUB(GNR_MUL(G0, G3), GNR_MUL(G1, G2));
+    }
+}
+
+/**
+ * @brief Hermitian Givens Right [Gvrhrg], generated, columns N1 and N1 + 1, rows up to N1 + 1.
+ * 
+ * @param Ghsnqt0 Hessenberg Square Matrix [Ghsnq], Target [t].
+ * @param G0 Scalar [G], cosine.
+ * @param G1 Scalar [G], sine.
+ * @param N0 Rows and Columns [N].
+ * @param N1 Index [N].
+ */
+void GNR_GVR(GNR_L, GNR_LR)(GNR_T* Ghsnqt0, const GNR_T G0, const GNR_T G1, const Natural N0, const Natural N1) {
+    GNR_T* Gv0 = Ghsnqt0 + N1 * N0; // Column N1.
+    GNR_T* Gv1 = Gv0 + N0; // Column N1 + 1.
+    register Natural N2 = 0;
+
+    const register GNR_W W0 = GNR_BC(G0), W1 = GNR_BC(G1);
+    const register GNR_W W2 = GNR_BC(GNR_CJ(G0)), W3 = GNR_BC(GNR_NEG(GNR_CJ(G1)));
+
+    for(; N2 + GNR_K <= N1 + 2; N2 += GNR_K) {
+        const register GNR_W W4 = GNR_LD(Gv0 + N2);
+        const register GNR_W W5 = GNR_LD(Gv1 + N2);
+
+        GNR_ST(Gv0 + N2, GNR_FMB(GNR_MLB(W4, W0), W5, W1));
+        GNR_ST(Gv1 + N2, GNR_FMB(GNR_MLB(W5, W2), W4, W3));
+    }
+
+    for(; N2 < N1 + 2; ++N2) {
+        const register GNR_T G2 = Gv0[N2];
+        const register GNR_T G3 = Gv1[N2];
+
+        Gv0[N2] = GNR_ADD(GNR_MUL(G2, G0), GNR_MUL(G3, G1));
+        Gv1[N2] = GNR_SUB(GNR_MLJ(G3, G0), GNR_MLJ(G2, G1));
+    }
+}
+
+// QR factorization.
+
+/**
+ * @brief Householder QR [Qrg], generated.
+ * 
+ * Q is the product of the reflectors I - 2vv^H, in order. The k-th unit
+ * vector v has its leading entry in Gvt0[k] and the others below the
+ * diagonal of the k-th column, R being above.
+ * 
+ * @param Gqt0 Square Matrix [Gq], Target [t], reflectors and R.
+ * @param Gvt0 Vector [Gv], Target [t], reflectors' leading entries.
+ * @param N0 Rows and Columns [N].
+ */
+void GNR_QR(GNR_L, GNR_LR)(GNR_T* Gqt0, GNR_T* Gvt0, const Natural N0) {
+    register Natural N1, N2, N3;
+
+    for(N1 = 0; N1 < N0; ++N1) {
+        GNR_T* Gv0 = Gqt0 + N1 * (N0 + 1); // Column's lower part.
+        N2 = N0 - N1;
+
+        const register GNR_U Gr0 = GNR_N2(GNR_L, GNR_LR)(Gv0, N2);
+
+        if(Gr0 == 0.0) { // Reduced column.
+            Gvt0[N1] = GNR_ZERO;
+            continue;
+        }
+
+        // Householder vector, any phase for a zero leading entry.
+
+        const register GNR_T G0 = GNR_PHS(Gv0[0]);
+        Gv0[0] = GNR_ADD(Gv0[0], GNR_SCL(G0, Gr0));
+
+        const register GNR_U Gr1 = GNR_N2(GNR_L, GNR_LR)(Gv0, N2);
+
+        for(N3 = 0; N3 < N2; ++N3) // Normalization.
+            Gv0[N3] = GNR_SCL(Gv0[N3], 1.0 / Gr1);
+
+        // Householder products.
+
+        for(N3 = N1 + 1; N3 < N0; ++N3) {
+            GNR_T* Gv1 = Gqt0 + N3 * N0 + N1;
+            GNR_MA(GNR_L, GNR_LR)(Gv1, Gv0, GNR_SCL(GNR_DOT(GNR_L, GNR_LR)(Gv1, Gv0, N2), -2.0), N2);
+        }
+
+        Gvt0[N1] = Gv0[0];
+        Gv0[0] = GNR_SCL(G0, -Gr0);
+    }
+}
+
+#undef GNR_T
+#undef GNR_U
+#undef GNR_W
+#undef GNR_K
+#undef GNR_L
+#undef GNR_LR
+#undef GNR_LD
+#undef GNR_ST
+#undef GNR_BC
+#undef GNR_Z
+#undef GNR_AD
+#undef GNR_MLB
+#undef GNR_FMB
+#undef GNR_FMJ
+#undef GNR_SQ
+#undef GNR_SM
+#undef GNR_RSM
+#undef GNR_ZERO
+#undef GNR_ADD
+#undef GNR_SUB
+#undef GNR_NEG
+#undef GNR_MUL
+#undef GNR_MLJ
+#undef GNR_CJM
+#undef GNR_CJ
+#undef GNR_SCL
+#undef GNR_SQA
+#undef GNR_PHS
+#undef GNR_SQRT
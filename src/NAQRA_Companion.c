@@ -0,0 +1,427 @@
+/**
+ * @file NAQRA_Companion.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief include/Companion.h implementation.
+ * @date 2024-12-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "../include/Companion.h"
+
+// Core transformations.
+
+/**
+ * @brief Givens core [Gv], first column along (C0, C1).
+ *
+ * @param Cgt0 Core [Cg], Target [t].
+ * @param C0 Complex Number [C].
+ * @param C1 Complex Number [C].
+ */
+static inline void Gv_CgtCC_0(Complex* Cgt0, const Complex C0, const Complex C1) {
+    const register Real R0 = hypot(N2_C_R(C0), N2_C_R(C1));
+
+    if(R0 == 0.0) {
+        Cgt0[0] = Cgt0[3] = C_R_C(1.0);
+        Cgt0[1] = Cgt0[2] = C_R_C(0.0);
+        return;
+    }
+
+    Cgt0[0] = D_CR_C(C0, R0);
+    Cgt0[1] = D_CR_C(C1, R0);
+    Cgt0[2] = M_CR_C(Cj_C_C(Cgt0[1]), -1.0);
+    Cgt0[3] = Cj_C_C(Cgt0[0]);
+}
+
+/**
+ * @brief Conjugate transpose [Ct].
+ *
+ * @param Cgt0 Core [Cg], Target [t].
+ */
+static inline void Ct_Cgt_0(Complex* Cgt0) {
+    const register Complex C0 = Cgt0[1];
+
+    Cgt0[0] = Cj_C_C(Cgt0[0]);
+    Cgt0[1] = Cj_C_C(Cgt0[2]);
+    Cgt0[2] = Cj_C_C(C0);
+    Cgt0[3] = Cj_C_C(Cgt0[3]);
+}
+
+/**
+ * @brief Reversal [Rv], rows and columns swapped, turning a top core into a bottom one.
+ *
+ * @param Cgt0 Core [Cg], Target [t].
+ */
+static inline void Rv_Cgt_0(Complex* Cgt0) {
+    register Complex C0 = Cgt0[0]; Cgt0[0] = Cgt0[3]; Cgt0[3] = C0;
+    C0 = Cgt0[1]; Cgt0[1] = Cgt0[2]; Cgt0[2] = C0;
+}
+
+/**
+ * @brief Left product [Ml], rows N0 and N0 + 1 of a 3x3 matrix.
+ *
+ * @param Cg0 Core [Cg].
+ * @param Cmt0 Complex Matrix [Cm], Target [t], 3x3.
+ * @param N0 Row [N].
+ * @param B0 Boolean [B], conjugate transpose of the core.
+ */
+static inline void Ml_CgCmtNB_0(const Complex* Cg0, Complex* Cmt0, const Natural N0, const bool B0) {
+    for(register Natural N1 = 0; N1 < 3; ++N1) {
+        const register Complex C0 = Cmt0[3 * N1 + N0], C1 = Cmt0[3 * N1 + N0 + 1];
+
+        if(B0) {
+            Cmt0[3 * N1 + N0] = A_CC_C(M_CcjC_C(Cg0[0], C0), M_CcjC_C(Cg0[1], C1));
+            Cmt0[3 * N1 + N0 + 1] = A_CC_C(M_CcjC_C(Cg0[2], C0), M_CcjC_C(Cg0[3], C1));
+        } else {
+            Cmt0[3 * N1 + N0] = A_CC_C(M_CC_C(Cg0[0], C0), M_CC_C(Cg0[2], C1));
+            Cmt0[3 * N1 + N0 + 1] = A_CC_C(M_CC_C(Cg0[1], C0), M_CC_C(Cg0[3], C1));
+        }
+    }
+}
+
+/**
+ * @brief Left product [Mlh], Cgt1 = Cg0^H Cgt1.
+ *
+ * @param Cg0 Core [Cg].
+ * @param Cgt1 Core [Cg], Target [t].
+ */
+static inline void Mlh_CgCgt_0(const Complex* Cg0, Complex* Cgt1) {
+    for(register Natural N0 = 0; N0 < 4; N0 += 2) {
+        const register Complex C0 = Cgt1[N0], C1 = Cgt1[N0 + 1];
+
+        Cgt1[N0] = A_CC_C(M_CcjC_C(Cg0[0], C0), M_CcjC_C(Cg0[1], C1));
+        Cgt1[N0 + 1] = A_CC_C(M_CcjC_C(Cg0[2], C0), M_CcjC_C(Cg0[3], C1));
+    }
+}
+
+/**
+ * @brief Right product [Mr], Cgt0 = Cgt0 Cg1.
+ *
+ * @param Cgt0 Core [Cg], Target [t].
+ * @param Cg1 Core [Cg].
+ */
+static inline void Mr_CgtCg_0(Complex* Cgt0, const Complex* Cg1) {
+    for(register Natural N0 = 0; N0 < 2; ++N0) {
+        const register Complex C0 = Cgt0[N0], C1 = Cgt0[N0 + 2];
+
+        Cgt0[N0] = A_CC_C(M_CC_C(C0, Cg1[0]), M_CC_C(C1, Cg1[1]));
+        Cgt0[N0 + 2] = A_CC_C(M_CC_C(C0, Cg1[2]), M_CC_C(C1, Cg1[3]));
+    }
+}
+
+/**
+ * @brief Turnover [Trn], X Y Z = Z' X' Y'.
+ *
+ * X and Z act on the top pair of three rows, Y on the bottom one. On exit X'
+ * still acts on the top pair, Y' and Z' on the bottom one.
+ *
+ * @param Cgt0 Core [Cg], Target [t], X.
+ * @param Cgt1 Core [Cg], Target [t], Y.
+ * @param Cgt2 Core [Cg], Target [t], Z.
+ */
+static void Trn_CgtCgtCgt_0(Complex* Cgt0, Complex* Cgt1, Complex* Cgt2) {
+    Complex Cm0[9] = {Cgt2[0], Cgt2[1], C_R_C(0.0), Cgt2[2], Cgt2[3], C_R_C(0.0), C_R_C(0.0), C_R_C(0.0), C_R_C(1.0)};
+
+    Ml_CgCmtNB_0(Cgt1, Cm0, 1, false);
+    Ml_CgCmtNB_0(Cgt0, Cm0, 0, false);
+
+    Gv_CgtCC_0(Cgt2, Cm0[1], Cm0[2]); // Z', bottom.
+    Ml_CgCmtNB_0(Cgt2, Cm0, 1, true);
+
+    Gv_CgtCC_0(Cgt0, Cm0[0], Cm0[1]); // X', top.
+    Ml_CgCmtNB_0(Cgt0, Cm0, 0, true);
+
+    // Leading phase into X'.
+    const register Complex C0 = Nzd2_C_C(Cm0[0]);
+
+    Cgt0[0] = M_CC_C(Cgt0[0], C0);
+    Cgt0[1] = M_CC_C(Cgt0[1], C0);
+
+    // Y', the trailing block, kept unitary.
+    const register Real R0 = hypot(N2_C_R(Cm0[4]), N2_C_R(Cm0[5]));
+    const register Complex C1 = Nzd2_C_C(S_CC_C(M_CC_C(Cm0[4], Cm0[8]), M_CC_C(Cm0[7], Cm0[5])));
+
+    Cgt1[0] = D_CR_C(Cm0[4], R0);
+    Cgt1[1] = D_CR_C(Cm0[5], R0);
+    Cgt1[2] = M_CC_C(C1, M_CR_C(Cj_C_C(Cgt1[1]), -1.0));
+    Cgt1[3] = M_CC_C(C1, Cj_C_C(Cgt1[0]));
+}
+
+/**
+ * @brief Turnover [Trnr], reversed, X Y Z = Z' X' Y' with X and Z on the bottom pair.
+ *
+ * @param Cgt0 Core [Cg], Target [t], X.
+ * @param Cgt1 Core [Cg], Target [t], Y.
+ * @param Cgt2 Core [Cg], Target [t], Z.
+ */
+static void Trnr_CgtCgtCgt_0(Complex* Cgt0, Complex* Cgt1, Complex* Cgt2) {
+    Rv_Cgt_0(Cgt0); Rv_Cgt_0(Cgt1); Rv_Cgt_0(Cgt2);
+    Trn_CgtCgtCgt_0(Cgt0, Cgt1, Cgt2);
+    Rv_Cgt_0(Cgt0); Rv_Cgt_0(Cgt1); Rv_Cgt_0(Cgt2);
+}
+
+/**
+ * @brief Descending product's entry [Dsc], G_N0 ... G_{N1 - 1}.
+ *
+ * @param Cg0 Core sequence [Cg].
+ * @param N0 First core [N].
+ * @param N1 Last core [N], excluded.
+ * @param N2 Row [N].
+ * @param N3 Column [N].
+ * @return Complex Complex Number [C].
+ */
+static inline Complex Dsc_CgNNNN_C(const Complex* Cg0, const Natural N0, const Natural N1, const Natural N2, const Natural N3) {
+    if(N2 > N3 + 1) return C_R_C(0.0);
+    if(N2 == N3 + 1) return Cg0[4 * N3 + 1];
+
+    register Complex C0 = N2 > N0 ? Cg0[4 * (N2 - 1) + 3] : C_R_C(1.0);
+
+    for(register Natural N4 = N2; N4 < N3; ++N4)
+        C0 = M_CC_C(C0, Cg0[4 * N4 + 2]);
+
+    return N3 < N1 ? M_CC_C(C0, Cg0[4 * N3]) : C0;
+}
+
+// Companion matrices.
+
+// Factored companion matrix, A = QR, C R = B + e_0 y^T on one more row.
+typedef struct {
+
+    // Q, descending, N0 - 1 cores.
+    Complex* Cg0;
+
+    // B, descending, N0 cores.
+    Complex* Cg1;
+
+    // C, descending, N0 cores.
+    Complex* Cg2;
+
+    // Rows and Columns.
+    Natural N0;
+
+} Companion;
+
+/**
+ * @brief Entry of R [Ent], N1 - N0 <= 2.
+ *
+ * Row N0 + 1 of C R matches B's, the rank-one term living in the first row.
+ *
+ * @param Cmp0 Companion [Cmp].
+ * @param N0 Row [N].
+ * @param N1 Column [N].
+ * @return Complex Complex Number [C].
+ */
+static Complex Ent_CmpNN_C(const Companion* Cmp0, const Natural N0, const Natural N1) {
+    register Complex C0 = C_R_C(0.0);
+
+    for(register Natural N2 = N0 + 1; N2 <= N1; ++N2)
+        C0 = A_CC_C(C0, M_CC_C(Dsc_CgNNNN_C(Cmp0->Cg2, N0 + 1, Cmp0->N0, N0 + 1, N2), Ent_CmpNN_C(Cmp0, N2, N1)));
+
+    C0 = S_CC_C(Dsc_CgNNNN_C(Cmp0->Cg1, 0, Cmp0->N0, N0 + 1, N1), M_CC_C(Cmp0->Cg2[4 * N0 + 3], C0));
+    return D_CC_C(C0, Cmp0->Cg2[4 * N0 + 1]);
+}
+
+/**
+ * @brief Entry of A [Ent], active rows N0 to N1.
+ *
+ * @param Cmp0 Companion [Cmp].
+ * @param N0 First active index [N].
+ * @param N1 Last active index [N].
+ * @param N2 Row [N].
+ * @param N3 Column [N], N3 - N2 <= 1.
+ * @return Complex Complex Number [C].
+ */
+static Complex Ent_CmpNNNN_C(const Companion* Cmp0, const Natural N0, const Natural N1, const Natural N2, const Natural N3) {
+    register Complex C0 = C_R_C(0.0);
+
+    for(register Natural N4 = N2 > N0 ? N2 - 1 : N0; N4 <= N3; ++N4)
+        C0 = A_CC_C(C0, M_CC_C(Dsc_CgNNNN_C(Cmp0->Cg0, N0, N1, N2, N4), Ent_CmpNN_C(Cmp0, N4, N3)));
+
+    return C0;
+}
+
+/**
+ * @brief Shifted QR step [Qrs], active rows N0 to N1.
+ *
+ * The bulge is passed through R, B's and C's cores in turn, and through Q,
+ * until it fuses into Q's last active core.
+ *
+ * @param Cmpt0 Companion [Cmp], Target [t].
+ * @param C0 Complex Number [C], Shift.
+ * @param N0 First active index [N].
+ * @param N1 Last active index [N].
+ */
+static void Qrs_CmptCNN_0(Companion* Cmpt0, const Complex C0, const Natural N0, const Natural N1) {
+    Complex* Cg0 = Cmpt0->Cg0;
+    Complex* Cg1 = Cmpt0->Cg1;
+    Complex* Cg2 = Cmpt0->Cg2;
+
+    Complex Cg3[4], Cg4[4], Cg5[4]; // Bulge, C's cores.
+
+    Gv_CgtCC_0(Cg3, S_CC_C(Ent_CmpNNNN_C(Cmpt0, N0, N1, N0, N0), C0), Ent_CmpNNNN_C(Cmpt0, N0, N1, N0 + 1, N0));
+    Mlh_CgCgt_0(Cg3, Cg0 + 4 * N0);
+
+    for(register Natural N2 = N0; N2 < N1; ++N2) {
+        Trn_CgtCgtCgt_0(Cg1 + 4 * N2, Cg1 + 4 * (N2 + 1), Cg3); // Through B.
+
+        for(register Natural N3 = 0; N3 < 4; ++N3) {
+            Cg4[N3] = Cg2[4 * (N2 + 1) + N3];
+            Cg5[N3] = Cg2[4 * N2 + N3];
+        }
+
+        Ct_Cgt_0(Cg4); Ct_Cgt_0(Cg5);
+        Trnr_CgtCgtCgt_0(Cg4, Cg5, Cg3); // Through C^H.
+        Ct_Cgt_0(Cg4); Ct_Cgt_0(Cg5);
+
+        for(register Natural N3 = 0; N3 < 4; ++N3) {
+            Cg2[4 * (N2 + 1) + N3] = Cg4[N3];
+            Cg2[4 * N2 + N3] = Cg5[N3];
+        }
+
+        if(N2 + 1 < N1)
+            Trn_CgtCgtCgt_0(Cg0 + 4 * N2, Cg0 + 4 * (N2 + 1), Cg3); // Through Q.
+        else
+            Mr_CgtCg_0(Cg0 + 4 * N2, Cg3); // Fusion.
+    }
+}
+
+/**
+ * @brief Eigenvalues [Eig], fast companion QR.
+ *
+ * The monic companion matrix is A = Z R, Z being the cyclic down-shift and R
+ * the identity but for its last column. On one more row, R = U + x e^T with U
+ * unitary, and C x = |x| e_0 defines C's cores while B = C U.
+ *
+ * A deflated core is left diagonal, its phases being moved into the active
+ * cores next to it when a step starts.
+ *
+ * @param Cv0 Complex Vector [Cv], coefficients, ascending, the last one nonzero.
+ * @param Cvt0 Complex Vector [Cv], Target [t], eigenvalues.
+ * @param N0 Degree [N], at least 2.
+ */
+static void Eig_CvCvtN_0(const Complex* Cv0, Complex* Cvt0, const Natural N0) {
+    Companion Cmp0 = {
+        .Cg0 = (Complex*) Alc_NN_P(4 * (N0 - 1), sizeof(Complex)),
+        .Cg1 = (Complex*) Alc_NN_P(4 * N0, sizeof(Complex)),
+        .Cg2 = (Complex*) Alc_NN_P(4 * N0, sizeof(Complex)),
+        .N0 = N0
+    };
+
+    register Natural N1, N2 = N0 - 1, N3 = 0, N4 = 0;
+    register Complex C0 = C_R_C(-1.0), C1; // x's tail.
+
+    for(N1 = 0; N1 + 1 < N0; ++N1) { // Cyclic down-shift.
+        Cmp0.Cg0[4 * N1] = Cmp0.Cg0[4 * N1 + 3] = C_R_C(0.0);
+        Cmp0.Cg0[4 * N1 + 1] = Cmp0.Cg0[4 * N1 + 2] = C_R_C(1.0);
+    }
+
+    for(N1 = N0; N1-- > 0;) { // C x = |x| e_0, x = -(a_1, ..., a_{N0 - 1}, a_0, 1).
+        C1 = M_CR_C(D_CC_C(Cv0[(N1 + 1) % N0], Cv0[N0]), -1.0);
+
+        Gv_CgtCC_0(Cmp0.Cg2 + 4 * N1, C1, C0);
+        C0 = C_R_C(hypot(N2_C_R(C1), N2_C_R(C0)));
+
+        Ct_Cgt_0(Cmp0.Cg2 + 4 * N1);
+        Cp_CvtCvN_0(Cmp0.Cg1 + 4 * N1, Cmp0.Cg2 + 4 * N1, 4);
+    }
+
+    // B = C U, U swapping the last two rows.
+    C0 = Cmp0.Cg1[4 * N0 - 4]; Cmp0.Cg1[4 * N0 - 4] = Cmp0.Cg1[4 * N0 - 2]; Cmp0.Cg1[4 * N0 - 2] = C0;
+    C0 = Cmp0.Cg1[4 * N0 - 3]; Cmp0.Cg1[4 * N0 - 3] = Cmp0.Cg1[4 * N0 - 1]; Cmp0.Cg1[4 * N0 - 1] = C0;
+
+    for(; N2 > 0 && N3 < ITM0; ++N3) {
+        register Natural N5 = N2; // First active index.
+        Complex* Cg0 = Cmp0.Cg0;
+
+        for(; N5 > 0; --N5) // Deflation.
+            if(N2_C_R(Cg0[4 * (N5 - 1) + 1]) <= CMP0) {
+                Cg0[4 * (N5 - 1) + 1] = Cg0[4 * (N5 - 1) + 2] = C_R_C(0.0);
+                Cg0[4 * (N5 - 1)] = Nzd2_C_C(Cg0[4 * (N5 - 1)]);
+                Cg0[4 * (N5 - 1) + 3] = Nzd2_C_C(Cg0[4 * (N5 - 1) + 3]);
+                break;
+            }
+
+        if(N5 == N2) { // Converged.
+            Cvt0[N2] = Ent_CmpNNNN_C(&Cmp0, 0, N0 - 1, N2, N2);
+
+            --N2;
+            N4 = 0;
+            continue;
+        }
+
+        if(N5 > 0) { // Phases in.
+            C0 = Cg0[4 * (N5 - 1) + 3];
+            Cg0[4 * N5] = M_CC_C(C0, Cg0[4 * N5]);
+            Cg0[4 * N5 + 2] = M_CC_C(C0, Cg0[4 * N5 + 2]);
+            Cg0[4 * (N5 - 1) + 3] = C_R_C(1.0);
+        }
+
+        if(N2 + 1 < N0) {
+            C0 = Cg0[4 * N2];
+            Cg0[4 * (N2 - 1) + 2] = M_CC_C(Cg0[4 * (N2 - 1) + 2], C0);
+            Cg0[4 * (N2 - 1) + 3] = M_CC_C(Cg0[4 * (N2 - 1) + 3], C0);
+            Cg0[4 * N2] = C_R_C(1.0);
+        }
+
+        const register Complex C2 = Ent_CmpNNNN_C(&Cmp0, N5, N2, N2 - 1, N2 - 1);
+        const register Complex C3 = Ent_CmpNNNN_C(&Cmp0, N5, N2, N2 - 1, N2);
+        const register Complex C4 = Ent_CmpNNNN_C(&Cmp0, N5, N2, N2, N2 - 1);
+        const register Complex C5 = Ent_CmpNNNN_C(&Cmp0, N5, N2, N2, N2);
+
+        if(++N4 % EXC0 == 0) // Exceptional shift.
+            C0 = A_CC_C(C5, C_R_C(0.75 * N2_C_R(C4)));
+        else { // Wilkinson's shift.
+            register Complex* Cv1 = Eig_CCCC_C(C2, C3, C4, C5);
+            C0 = N2_C_R(S_CC_C(Cv1[0], C5)) <= N2_C_R(S_CC_C(Cv1[1], C5)) ? Cv1[0] : Cv1[1];
+            Fr_P_0(Cv1);
+        }
+
+        Qrs_CmptCNN_0(&Cmp0, C0, N5, N2);
+    }
+
+    for(N1 = 0; N1 <= N2; ++N1) // Last eigenvalue, diagonal ones past ITM0 steps.
+        Cvt0[N1] = Ent_CmpNNNN_C(&Cmp0, 0, N0 - 1, N1, N1);
+
+    Fr_P_0(Cmp0.Cg0);
+    Fr_P_0(Cmp0.Cg1);
+    Fr_P_0(Cmp0.Cg2);
+}
+
+// Roots.
+
+/**
+ * @brief Roots [Rts].
+ *
+ * Zero roots are split off first, and binomials z^m - c go through the closed
+ * form of Nrt_C_Cv. Every other polynomial goes through the fast companion QR
+ * algorithm, O(N^2) time and O(N) memory.
+ *
+ * @param Cv0 Complex Vector [Cv], coefficients, ascending powers.
+ * @param Cvt0 Complex Vector [Cv], Target [t], roots, at least N0 - 1 entries.
+ * @param N0 Coefficients [N].
+ * @return Natural Roots [N], the degree.
+ */
+Natural Rts_CvCvtN_N(const Complex* Cv0, Complex* Cvt0, const Natural N0) {
+    register Natural N1 = N0, N2 = 0, N3;
+
+    while(N1 > 0 && N2_C_R(Cv0[N1 - 1]) == 0.0) --N1; // Leading zeros.
+    if(N1 < 2) return 0;
+
+    for(; N2 + 1 < N1 && N2_C_R(Cv0[N2]) == 0.0; ++N2) // Zero roots.
+        Cvt0[N2] = C_R_C(0.0);
+
+    if(N2 + 1 == N1) return N1 - 1;
+
+    for(N3 = N2 + 1; N3 + 1 < N1 && N2_C_R(Cv0[N3]) == 0.0; ++N3);
+
+    if(N3 + 1 == N1) { // Binomial.
+        register Complex* Cv1 = Nrt_C_Cv(M_CR_C(D_CC_C(Cv0[N2], Cv0[N1 - 1]), -1.0), N1 - N2 - 1);
+
+        Cp_CvtCvN_0(Cvt0 + N2, Cv1, N1 - N2 - 1);
+        Fr_P_0(Cv1);
+    } else
+        Eig_CvCvtN_0(Cv0 + N2, Cvt0 + N2, N1 - N2 - 1);
+
+    return N1 - 1;
+}
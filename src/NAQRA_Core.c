@@ -0,0 +1,656 @@
+/**
+ * @file NAQRA_Core.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief include/Core.h implementation.
+ * @date 2024-12-16
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE // pread, pwrite and mkstemp.
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "../include/Core.h"
+
+// Input and output.
+
+/**
+ * @brief Transfer [Io], whole columns between the scratch file and a panel.
+ * 
+ * @param Pnl0 Panels [Pnl].
+ * @param Cm0 Complex Matrix [Cm], the panel.
+ * @param N0 First column [N].
+ * @param N1 Last column, excluded [N].
+ * @param B0 Write, read otherwise.
+ * @return bool Success.
+ */
+static bool Io_PnlCmNNB_B(const Panels* Pnl0, Complex* Cm0, const Natural N0, const Natural N1, const bool B0) {
+    const register size_t N2 = (N1 - N0) * Pnl0->N0 * sizeof(Complex); // Bytes.
+    const register off_t O0 = (off_t) (FMT2 + N0 * Pnl0->N0 * sizeof(Complex)); // Offset.
+    register size_t N3 = 0;
+    register ssize_t I0;
+
+    for(; N3 < N2; N3 += (size_t) I0)
+        if((I0 = B0 ? pwrite(Pnl0->I0, (char*) Cm0 + N3, N2 - N3, O0 + (off_t) N3) : pread(Pnl0->I0, (char*) Cm0 + N3, N2 - N3, O0 + (off_t) N3)) <= 0) return false;
+
+    return true;
+}
+
+// Read-ahead task.
+typedef struct {
+
+    // Panels.
+    const Panels* Pnl0;
+
+    // Target panel.
+    Complex* Cmt0;
+
+    // First column.
+    Natural N0;
+
+    // Last column, excluded.
+    Natural N1;
+
+    // Success.
+    bool B0;
+
+} Ahead;
+
+/**
+ * @brief Read-ahead [Ahd].
+ * 
+ * @param P0 Read-ahead task.
+ * @return void* NULL.
+ */
+static void* Ahd_P_P(void* P0) {
+    Ahead* Ah0 = (Ahead*) P0;
+    Ah0->B0 = Io_PnlCmNNB_B(Ah0->Pnl0, Ah0->Cmt0, Ah0->N0, Ah0->N1, false);
+
+    return NULL;
+}
+
+// Panel visitor, panel, first column, last column excluded and data, returning true to write the panel back.
+typedef bool (*Visitor)(Complex*, const Natural, const Natural, void*);
+
+/**
+ * @brief Stream [Stm], columns N0 onwards, one panel at a time.
+ * 
+ * The next panel is read by a helper thread while the visitor works on the
+ * current one.
+ * 
+ * @param Pnl0 Panels [Pnl].
+ * @param Cmt0 Complex Matrix [Cm], Target [t], first buffer.
+ * @param Cmt1 Complex Matrix [Cm], Target [t], second buffer.
+ * @param N0 First column [N].
+ * @param Vs0 Visitor [Vs].
+ * @param P0 Visitor's data.
+ * @return bool Success.
+ */
+static bool Stm_PnlCmtCmtNVsP_B(const Panels* Pnl0, Complex* Cmt0, Complex* Cmt1, const Natural N0, const Visitor Vs0, void* P0) {
+    const register Natural N1 = Pnl0->N0, N2 = Pnl0->N1;
+    register Natural N3 = N0, N4;
+    register bool B0 = true, B1;
+
+    if(N0 >= N1) return true;
+
+    Ahead Ah0 = {.Pnl0 = Pnl0, .Cmt0 = Cmt0, .N0 = N0, .N1 = N0 + N2 < N1 ? N0 + N2 : N1, .B0 = false};
+    Ahead Ah1;
+    pthread_t Th0;
+
+    Ah0.B0 = Io_PnlCmNNB_B(Pnl0, Ah0.Cmt0, Ah0.N0, Ah0.N1, false);
+
+    for(; N3 < N1 && B0; N3 = N4, Ah0 = Ah1) {
+        N4 = Ah0.N1;
+
+        if(!(B0 = Ah0.B0)) break;
+
+        // Read-ahead.
+
+        Ah1 = (Ahead) {.Pnl0 = Pnl0, .Cmt0 = Ah0.Cmt0 == Cmt0 ? Cmt1 : Cmt0, .N0 = N4, .N1 = N4 + N2 < N1 ? N4 + N2 : N1, .B0 = true};
+
+        if((B1 = N4 < N1 && pthread_create(&Th0, NULL, Ahd_P_P, &Ah1) == 0) == false && N4 < N1)
+            Ahd_P_P(&Ah1); // Synchronous fallback.
+
+        if(Vs0(Ah0.Cmt0, N3, N4, P0) && !Io_PnlCmNNB_B(Pnl0, Ah0.Cmt0, N3, N4, true))
+            B0 = false;
+
+        if(B1) pthread_join(Th0, NULL);
+    }
+
+    return B0;
+}
+
+// Panels.
+
+/**
+ * @brief Open [Opn], copying a binary square matrix into memory or a scratch file.
+ * 
+ * A matrix fitting the memory budget is read into memory and never touches
+ * the disk. Otherwise, the scratch file is created in NAQRA_SCRATCH, or next
+ * to the source, and unlinked right away, its panels being as wide as the
+ * memory budget allows.
+ * 
+ * @param S0 Path, NULL or "-" for stdin, column-major.
+ * @param N0 Memory budget [N], bytes, 0 for CRE0.
+ * @return Panels* Panels [Pnl], NULL on failure.
+ */
+[[nodiscard]] Panels* Opn_SN_Pnl(const char* S0, const size_t N0) {
+    const register int I0 = S0 == NULL || strcmp(S0, "-") == 0 ? STDIN_FILENO : open(S0, O_RDONLY);
+    register Natural N1, N2, N3;
+    register ssize_t I1 = 0;
+    Format Fmt0;
+
+    if(I0 < 0) return NULL;
+
+    // Header.
+
+    for(N1 = 0; N1 < sizeof(Format); N1 += (Natural) I1)
+        if((I1 = read(I0, (char*) &Fmt0 + N1, sizeof(Format) - N1)) <= 0) break;
+
+    if(N1 < sizeof(Format) || memcmp(Fmt0.S0, FMT0, 8) != 0 || Fmt0.N0 != FMT1 || Fmt0.N1 > ELM_REAL || Fmt0.N2 != ORD_COLUMN ||
+        Fmt0.N4 == 0 || Fmt0.N4 != Fmt0.N5 || Fmt0.N4 > SIZE_MAX / 16 / Fmt0.N5) {
+        if(I0 != STDIN_FILENO) close(I0);
+        return NULL;
+    }
+
+    const register Natural N4 = (Natural) Fmt0.N4;
+    const register size_t N5 = N0 > 0 ? N0 : CRE0; // Budget.
+    const register bool B1 = N4 * N4 * sizeof(Complex) <= N5; // In memory.
+    register int I2 = -1;
+
+    // Scratch.
+
+    if(!B1) {
+        const char* S1 = getenv("NAQRA_SCRATCH");
+        char S2[4096];
+
+        if(S1 != NULL) snprintf(S2, sizeof(S2), "%s/naqra.XXXXXX", S1);
+        else if(I0 != STDIN_FILENO) snprintf(S2, sizeof(S2), "%s.XXXXXX", S0);
+        else snprintf(S2, sizeof(S2), "naqra.XXXXXX");
+
+        if((I2 = mkstemp(S2)) < 0) {
+            if(I0 != STDIN_FILENO) close(I0);
+            return NULL;
+        }
+
+        unlink(S2);
+    }
+
+    // Panels' width, eight panels: the panel, two stream buffers, V and A V
+    // for two panels' reflectors, and their coefficients.
+
+    N2 = B1 ? N4 : N5 / (8 * N4 * sizeof(Complex));
+
+    Panels* Pnl0 = (Panels*) Alc_NN_P(1, sizeof(Panels));
+    Complex* Cm0 = (Complex*) Alc_NN_P((N2 < 1 ? 1 : (N2 > N4 ? N4 : N2)) * N4, sizeof(Complex));
+
+    if(Pnl0 == NULL || Cm0 == NULL) {
+        if(I0 != STDIN_FILENO) close(I0);
+        if(I2 >= 0) close(I2);
+
+        Fr_P_0(Pnl0);
+        Fr_P_0(Cm0);
+        return NULL;
+    }
+
+    *Pnl0 = (Panels) {.I0 = I2, .N0 = N4, .N1 = N2 < 1 ? 1 : (N2 > N4 ? N4 : N2), .N2 = N4 - 1, .Cm0 = B1 ? Cm0 : NULL};
+
+    const Format Fmt1 = {.S0 = {'N', 'A', 'Q', 'R', 'A', 'M', 'T', 'X'}, .N0 = FMT1, .N1 = ELM_COMPLEX, .N2 = ORD_COLUMN, .N3 = Fmt0.N3, .N4 = N4, .N5 = N4, .N6 = 0};
+    register bool B0 = B1 || (pwrite(I2, &Fmt1, sizeof(Format), 0) == sizeof(Format) && ftruncate(I2, (off_t) (FMT2 + N4 * N4 * sizeof(Complex))) == 0);
+
+    // Copy, real entries being widened in place.
+
+    const register size_t N6 = Fmt0.N1 == ELM_COMPLEX ? sizeof(Complex) : sizeof(Real);
+
+    for(N1 = 0; N1 < N4 && B0; N1 += N2) {
+        N2 = N1 + Pnl0->N1 < N4 ? Pnl0->N1 : N4 - N1;
+
+        for(N3 = 0; N3 < N2 * N4 * N6; N3 += (Natural) I1)
+            if((I1 = read(I0, (char*) Cm0 + N3, N2 * N4 * N6 - N3)) <= 0) break;
+
+        if(!(B0 = N3 == N2 * N4 * N6)) break;
+
+        if(Fmt0.N1 == ELM_REAL)
+            for(N3 = N2 * N4; N3-- > 0;)
+                Cm0[N3] = C_R_C(((const Real*) Cm0)[N3]);
+
+        B0 = B1 || Io_PnlCmNNB_B(Pnl0, Cm0, N1, N1 + N2, true);
+    }
+
+    if(I0 != STDIN_FILENO) close(I0);
+    if(!B1) Fr_P_0(Cm0);
+
+    if(!B0) {
+        Cls_Pnl_0(Pnl0);
+        return NULL;
+    }
+
+    return Pnl0;
+}
+
+/**
+ * @brief Close [Cls], releasing the matrix or its scratch file.
+ * 
+ * @param Pnl0 Panels [Pnl].
+ */
+void Cls_Pnl_0(Panels* Pnl0) {
+    if(Pnl0->I0 >= 0) close(Pnl0->I0);
+
+    Fr_P_0(Pnl0->Cm0);
+    Fr_P_0(Pnl0);
+}
+
+// Band Hessenberg form.
+
+// Panel's reflectors, Q = I - V T V^H, acting on rows N2 onwards.
+typedef struct {
+
+    // Householder vectors, V.
+    Complex* Cm0;
+
+    // Products with the matrix, A V.
+    Complex* Cm1;
+
+    // Coefficients, T, upper triangular.
+    Complex* Cm2;
+
+    // First reflected row.
+    Natural N2;
+
+    // Reflectors.
+    Natural N3;
+
+} Reflectors;
+
+// Streamed update.
+typedef struct {
+
+    // Pending reflectors, right side only.
+    Reflectors* Rf0;
+
+    // Current reflectors, left side, A V being accumulated.
+    Reflectors* Rf1;
+
+    // Workspace.
+    Complex* Cv0;
+
+    // Workspace.
+    Complex* Cv1;
+
+    // Next panel.
+    Complex* Cmt0;
+
+    // Rows and Columns.
+    Natural N0;
+
+    // Columns per panel.
+    Natural N1;
+
+    // Next panel's first column.
+    Natural N2;
+
+    // Next panel's columns.
+    Natural N3;
+
+} Update;
+
+/**
+ * @brief Right [Rgt] update, column N0 of A Q, A V being complete.
+ * 
+ * @param Up0 Update [Up].
+ * @param Ccvt0 Complex Column Vector [Ccv], Target [t].
+ * @param N0 Column [N].
+ */
+static void Rgt_UpCcvtN_0(const Update* Up0, Complex* Ccvt0, const Natural N0) {
+    const Reflectors* Rf0 = Up0->Rf0;
+    const register Natural N1 = Up0->N0, N2 = Up0->N1, N3 = Rf0->N3;
+    register Natural N4, N5;
+    register Complex C0;
+
+    if(N0 < Rf0->N2) return; // Untouched column.
+
+    // A Q e = A e - (A V) T V^H e.
+
+    for(N4 = 0; N4 < N3; ++N4) {
+        for(N5 = N4, C0 = C_R_C(0.0); N5 < N3; ++N5)
+            C0 = A_CC_C(C0, M_CCcj_C(Rf0->Cm2[N5 * N2 + N4], Rf0->Cm0[N5 * N1 + N0]));
+
+        Up0->Cv0[N4] = C0;
+    }
+
+    for(N4 = 0; N4 < N3; ++N4)
+        Ma_CvtCvCN_0(Ccvt0, Rf0->Cm1 + N4 * N1, M_CR_C(Up0->Cv0[N4], -1.0), N1);
+}
+
+/**
+ * @brief Left [Lft] update, column N0 of Q^H A, A V being accumulated.
+ * 
+ * @param Up0 Update [Up].
+ * @param Ccvt0 Complex Column Vector [Ccv], Target [t].
+ * @param N0 Column [N].
+ */
+static void Lft_UpCcvtN_0(const Update* Up0, Complex* Ccvt0, const Natural N0) {
+    const Reflectors* Rf0 = Up0->Rf1;
+    const register Natural N1 = Up0->N0, N2 = Up0->N1, N3 = Rf0->N3, N4 = Rf0->N2;
+    register Natural N5, N6;
+    register Complex C0;
+
+    // Q^H x = x - V T^H V^H x.
+
+    for(N5 = 0; N5 < N3; ++N5)
+        Up0->Cv1[N5] = Dot_CrvCcvN_C(Ccvt0 + N4, Rf0->Cm0 + N5 * N1 + N4, N1 - N4);
+
+    for(N5 = 0; N5 < N3; ++N5) {
+        for(N6 = 0, C0 = C_R_C(0.0); N6 <= N5; ++N6)
+            C0 = A_CC_C(C0, M_CcjC_C(Rf0->Cm2[N5 * N2 + N6], Up0->Cv1[N6]));
+
+        Up0->Cv0[N5] = C0;
+    }
+
+    for(N5 = 0; N5 < N3; ++N5)
+        Ma_CvtCvCN_0(Ccvt0 + N4, Rf0->Cm0 + N5 * N1 + N4, M_CR_C(Up0->Cv0[N5], -1.0), N1 - N4);
+
+    // (A V) += (Q^H A e) e^T V.
+
+    for(N5 = 0; N5 < N3; ++N5)
+        Ma_CvtCvCN_0(Rf0->Cm1 + N5 * N1, Ccvt0, Rf0->Cm0[N5 * N1 + N0], N1);
+}
+
+/**
+ * @brief Update [Upd] visitor, trailing columns, the next panel being kept.
+ * 
+ * @param Cm0 Complex Matrix [Cm], panel.
+ * @param N0 First column [N].
+ * @param N1 Last column, excluded [N].
+ * @param P0 Update.
+ * @return bool True, but for the next panel, which is written back later.
+ */
+static bool Upd_CmNNP_B(Complex* Cm0, const Natural N0, const Natural N1, void* P0) {
+    Update* Up0 = (Update*) P0;
+    const register Natural N2 = Up0->N0;
+
+    for(register Natural N3 = N0; N3 < N1; ++N3) {
+        Rgt_UpCcvtN_0(Up0, Cm0 + (N3 - N0) * N2, N3);
+        Lft_UpCcvtN_0(Up0, Cm0 + (N3 - N0) * N2, N3);
+    }
+
+    if(N0 != Up0->N2) return true;
+
+    Cp_CvtCvN_0(Up0->Cmt0, Cm0, Up0->N3 * N2); // Next panel.
+
+    return false;
+}
+
+/**
+ * @brief Hessenberg form [Hsn], band first, in the scratch file.
+ * 
+ * Each panel's columns are QR factorized below the band, as wide as the
+ * panel. A single stream then applies the previous panel's reflectors from
+ * the right, A V being complete, and the current ones from the left, while
+ * accumulating their A V, so that the scratch file is streamed once per
+ * panel. The band is chased down to Hessenberg form by Cpt_Pnl_Chc. A
+ * matrix in memory is reduced to Hessenberg form right away.
+ * 
+ * @param Pnl0 Panels [Pnl].
+ * @return bool Success.
+ */
+bool Hsn_Pnl_B(Panels* Pnl0) {
+    const register Natural N0 = Pnl0->N0, N1 = Pnl0->N1;
+    register Natural N2, N3, N4, N5;
+
+    if(N0 < 3) return true;
+
+    if(Pnl0->Cm0 != NULL) { // In memory.
+        Hsn_CqtN_0(Pnl0->Cm0, N0);
+        Pnl0->N2 = 1;
+
+        return true;
+    }
+
+    Complex* Cm0 = (Complex*) Alc_NN_P(N0 * N1, sizeof(Complex)); // Panel.
+    Complex* Cm1 = (Complex*) Alc_NN_P(N0 * N1, sizeof(Complex)); // Stream buffer.
+    Complex* Cm2 = (Complex*) Alc_NN_P(N0 * N1, sizeof(Complex)); // Stream buffer.
+
+    Reflectors Rf0 = {.Cm0 = (Complex*) Alc_NN_P(N0 * N1, sizeof(Complex)), .Cm1 = (Complex*) Alc_NN_P(N0 * N1, sizeof(Complex)), .Cm2 = (Complex*) Calc_NN_P(N1 * N1, sizeof(Complex))};
+    Reflectors Rf1 = {.Cm0 = (Complex*) Alc_NN_P(N0 * N1, sizeof(Complex)), .Cm1 = (Complex*) Alc_NN_P(N0 * N1, sizeof(Complex)), .Cm2 = (Complex*) Calc_NN_P(N1 * N1, sizeof(Complex))};
+
+    Update Up0 = {.Rf0 = &Rf0, .Rf1 = &Rf1, .Cv0 = (Complex*) Alc_NN_P(N1, sizeof(Complex)), .Cv1 = (Complex*) Alc_NN_P(N1, sizeof(Complex)), .Cmt0 = Cm0, .N0 = N0, .N1 = N1};
+
+    register bool B0 = Cm0 != NULL && Cm1 != NULL && Cm2 != NULL && Rf0.Cm0 != NULL && Rf0.Cm1 != NULL && Rf0.Cm2 != NULL &&
+        Rf1.Cm0 != NULL && Rf1.Cm1 != NULL && Rf1.Cm2 != NULL && Up0.Cv0 != NULL && Up0.Cv1 != NULL;
+
+    B0 = B0 && Io_PnlCmNNB_B(Pnl0, Cm0, 0, N1, false);
+
+    for(N2 = 0; N2 < N0 && B0; N2 += N1) {
+        const register Natural N6 = N2 + N1 < N0 ? N1 : N0 - N2, N7 = N2 + N6; // Panel's columns and first reflected row.
+        Reflectors* Rf2 = Up0.Rf1;
+
+        // Pending reflectors.
+
+        for(N3 = 0; N3 < N6; ++N3)
+            Rgt_UpCcvtN_0(&Up0, Cm0 + N3 * N0, N2 + N3);
+
+        // QR factorization below the band.
+
+        Rf2->N2 = N7;
+        Rf2->N3 = 0;
+
+        for(N3 = 0; N3 < N6 && N7 + N3 + 1 < N0; ++N3) {
+            const register Natural N8 = N7 + N3, N9 = N0 - N8; // Row and entries.
+            Complex* Ccv0 = Cm0 + N3 * N0;
+            Complex* Cv0 = Rf2->Cm0 + N3 * N0;
+
+            // Householder vector.
+
+            memset(Cv0, 0, N8 * sizeof(Complex));
+            Cp_CvtCvN_0(Cv0 + N8, Ccv0 + N8, N9);
+
+            const register Real R0 = N2_CvN_R(Cv0 + N8, N9);
+
+            if(R0 != 0.0) {
+                // Direction, any phase for a zero leading entry.
+                Cv0[N8] = A_CC_C(Cv0[N8], M_CR_C(N2_C_R(Cv0[N8]) > 0.0 ? Nzd2_C_C(Cv0[N8]) : C_R_C(1.0), R0));
+                Nz2_CvN_0(Cv0 + N8, N9); // Normalization.
+
+                for(N4 = N3; N4 < N6; ++N4)
+                    Ma_CvtCvCN_0(Cm0 + N4 * N0 + N8, Cv0 + N8, M_CR_C(Dot_CrvCcvN_C(Cm0 + N4 * N0 + N8, Cv0 + N8, N9), -2.0), N9);
+
+                memset(Ccv0 + N8 + 1, 0, (N9 - 1) * sizeof(Complex)); // Zeroing.
+            }
+
+            // Coefficients, T e = [-2 T V^H v, 2].
+
+            for(N4 = 0; N4 < N3; ++N4)
+                Up0.Cv1[N4] = Dot_CrvCcvN_C(Cv0 + N7, Rf2->Cm0 + N4 * N0 + N7, N0 - N7);
+
+            for(N4 = 0; N4 < N3; ++N4) {
+                register Complex C0 = C_R_C(0.0);
+
+                for(N5 = N4; N5 < N3; ++N5)
+                    C0 = A_CC_C(C0, M_CC_C(Rf2->Cm2[N5 * N1 + N4], Up0.Cv1[N5]));
+
+                Rf2->Cm2[N3 * N1 + N4] = M_CR_C(C0, -2.0);
+            }
+
+            Rf2->Cm2[N3 * N1 + N3] = C_R_C(R0 != 0.0 ? 2.0 : 0.0);
+            ++Rf2->N3;
+        }
+
+        if(!(B0 = Io_PnlCmNNB_B(Pnl0, Cm0, N2, N7, true)) || N7 >= N0) break;
+
+        // Trailing update, the next panel being kept in memory.
+
+        memset(Rf2->Cm1, 0, Rf2->N3 * N0 * sizeof(Complex));
+
+        Up0.N2 = N7;
+        Up0.N3 = N7 + N1 < N0 ? N1 : N0 - N7;
+
+        B0 = Stm_PnlCmtCmtNVsP_B(Pnl0, Cm1, Cm2, N7, Upd_CmNNP_B, &Up0);
+
+        // Pending reflectors, the current ones.
+
+        Up0.Rf1 = Up0.Rf0;
+        Up0.Rf0 = Rf2;
+    }
+
+    if(B0) Pnl0->N2 = N1 < N0 - 1 ? N1 : N0 - 1; // Bandwidth.
+
+    Fr_P_0(Cm0);
+    Fr_P_0(Cm1);
+    Fr_P_0(Cm2);
+
+    Fr_P_0(Rf0.Cm0);
+    Fr_P_0(Rf0.Cm1);
+    Fr_P_0(Rf0.Cm2);
+    Fr_P_0(Rf1.Cm0);
+    Fr_P_0(Rf1.Cm1);
+    Fr_P_0(Rf1.Cm2);
+    Fr_P_0(Up0.Cv0);
+    Fr_P_0(Up0.Cv1);
+
+    return B0;
+}
+
+// Hessenberg form.
+
+/**
+ * @brief Chase [Chs], band Hessenberg to Hessenberg form, Givens rotations.
+ * 
+ * The bandwidth is lowered one subdiagonal at a time. Each entry on the
+ * outermost one is rotated away, the resulting one-entry bulge, right below
+ * the band, being chased down to the last row.
+ * 
+ * @param Cbt0 Complex Band Matrix [Cb], Target [t], column N holding rows up to N + N1 + 1.
+ * @param Nv0 Natural Vector [Nv], columns' offsets.
+ * @param N0 Rows and Columns [N].
+ * @param N1 Bandwidth [N].
+ */
+static void Chs_CbtNvNN_0(Complex* Cbt0, const Natural* Nv0, const Natural N0, const Natural N1) {
+    register Natural N2, N3, N4, N5, N6, N7;
+    register Complex C0, C1, C2, C3;
+    register Real R0;
+
+    for(N2 = N1; N2 > 1; --N2) // Bandwidth.
+        for(N3 = 0; N3 + N2 < N0; ++N3) // Outermost entry's column.
+            for(N4 = N3, N5 = N3 + N2 - 1; N5 + 1 < N0; N4 = N5, N5 += N2) { // Entry's column and rows N5, N5 + 1.
+                C0 = Cbt0[Nv0[N4] + N5];
+                C1 = Cbt0[Nv0[N4] + N5 + 1];
+
+                if(N2_C_R(C1) == 0.0) break; // No bulge.
+
+                R0 = hypot(N2_C_R(C0), N2_C_R(C1));
+                C0 = D_CR_C(C0, R0);
+                C1 = D_CR_C(C1, R0);
+
+                // Left, G = [C0^*, C1^*; -C1, C0], columns N4 onwards.
+
+                for(N6 = N4; N6 < N0; ++N6) {
+                    Complex* Cv0 = Cbt0 + Nv0[N6] + N5;
+                    C2 = Cv0[0];
+                    C3 = Cv0[1];
+
+                    Cv0[0] = A_CC_C(M_CcjC_C(C0, C2), M_CcjC_C(C1, C3));
+                    Cv0[1] = S_CC_C(M_CC_C(C0, C3), M_CC_C(C1, C2));
+                }
+
+                Cbt0[Nv0[N4] + N5 + 1] = C_R_C(0.0);
+
+                // Right, G^H, rows up to N5 + N2 + 1, the bulge's.
+
+                Complex* Cv0 = Cbt0 + Nv0[N5];
+                Complex* Cv1 = Cbt0 + Nv0[N5 + 1];
+                N7 = N5 + N2 + 2 < N0 ? N5 + N2 + 2 : N0;
+
+                for(N6 = 0; N6 < N7; ++N6) {
+                    C2 = Cv0[N6];
+                    C3 = Cv1[N6];
+
+                    Cv0[N6] = A_CC_C(M_CC_C(C0, C2), M_CC_C(C1, C3));
+                    Cv1[N6] = S_CC_C(M_CcjC_C(C0, C3), M_CcjC_C(C1, C2));
+                }
+            }
+}
+
+/**
+ * @brief Compact [Cpt] visitor, band columns into compact band storage.
+ * 
+ * @param Cm0 Complex Matrix [Cm], panel.
+ * @param N0 First column [N].
+ * @param N1 Last column, excluded [N].
+ * @param P0 Panels, compact band matrix and its columns' offsets.
+ * @return bool False, the panel being left untouched.
+ */
+static bool Cpt_CmNNP_B(Complex* Cm0, const Natural N0, const Natural N1, void* P0) {
+    const Panels* Pnl0 = *(const Panels**) P0;
+    Complex* Cbt0 = ((Complex**) P0)[1];
+    const Natural* Nv0 = ((const Natural**) P0)[2];
+    const register Natural N2 = Pnl0->N0, N3 = Pnl0->N2;
+
+    for(register Natural N4 = N0; N4 < N1; ++N4) {
+        const register Natural N5 = N4 + N3 + 1 < N2 ? N4 + N3 + 1 : N2; // Band's rows.
+
+        Cp_CvtCvN_0(Cbt0 + Nv0[N4], Cm0 + (N4 - N0) * N2, N5);
+        memset(Cbt0 + Nv0[N4] + N5, 0, (Nv0[N4 + 1] - Nv0[N4] - N5) * sizeof(Complex)); // Bulge's row.
+    }
+
+    return false;
+}
+
+/**
+ * @brief Compact [Cpt], reading the reduced form back in compact storage.
+ * 
+ * The band, with room for one more subdiagonal, is chased down to Hessenberg
+ * form in memory and packed in place. A matrix in memory is handed over.
+ * 
+ * @param Pnl0 Panels [Pnl], in band Hessenberg form.
+ * @return Complex* Complex Hessenberg Compact Matrix [Chc], NULL on failure.
+ */
+[[nodiscard]] Complex* Cpt_Pnl_Chc(Panels* Pnl0) {
+    const register Natural N0 = Pnl0->N0, N1 = Pnl0->N2 + 1; // Rows and Columns, room below the diagonal.
+    register Natural N2;
+    Complex* Chc0 = Pnl0->Cm0;
+
+    if(Chc0 != NULL) { // In memory.
+        Cpt_ChsnqtN_0(Chc0, N0);
+        Pnl0->Cm0 = NULL;
+
+        return Chc0;
+    }
+
+    // Columns' offsets.
+
+    Natural* Nv0 = (Natural*) Alc_NN_P(N0 + 1, sizeof(Natural));
+    if(Nv0 == NULL) return NULL;
+
+    for(N2 = 0, Nv0[0] = 0; N2 < N0; ++N2)
+        Nv0[N2 + 1] = Nv0[N2] + (N2 + N1 + 1 < N0 ? N2 + N1 + 1 : N0);
+
+    Chc0 = (Complex*) Alc_NN_P(Nv0[N0], sizeof(Complex));
+    Complex* Cm0 = (Complex*) Alc_NN_P(N0 * Pnl0->N1, sizeof(Complex)); // Stream buffer.
+    Complex* Cm1 = (Complex*) Alc_NN_P(N0 * Pnl0->N1, sizeof(Complex)); // Stream buffer.
+
+    void* P0[3] = {Pnl0, Chc0, Nv0};
+
+    if(Chc0 == NULL || Cm0 == NULL || Cm1 == NULL || !Stm_PnlCmtCmtNVsP_B(Pnl0, Cm0, Cm1, 0, Cpt_CmNNP_B, P0)) {
+        Fr_P_0(Chc0);
+        Chc0 = NULL;
+    } else {
+        Chs_CbtNvNN_0(Chc0, Nv0, N0, Pnl0->N2); // Hessenberg.
+
+        for(N2 = 0; N2 < N0; ++N2) // Packing.
+            memmove(Chc0 + Cx_NN_N(0, N2), Chc0 + Nv0[N2], (N2 + 2 < N0 ? N2 + 2 : N0) * sizeof(Complex));
+    }
+
+    Fr_P_0(Nv0);
+    Fr_P_0(Cm0);
+    Fr_P_0(Cm1);
+
+    return Chc0;
+}
@@ -0,0 +1,550 @@
+/**
+ * @file NAQRA_Format.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief include/Format.h implementation.
+ * @date 2024-12-15
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE // mmap.
+#endif
+
+#include <string.h>
+#include <strings.h>
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "../include/Format.h"
+
+// Checks.
+
+/**
+ * @brief Check [Chk], header.
+ * 
+ * @param Fmt0 Header [Fmt].
+ * @return Natural Entries' bytes [N], 0 if invalid.
+ */
+static Natural Chk_Fmt_N(const Format* Fmt0) {
+    if(memcmp(Fmt0->S0, FMT0, 8) != 0 || Fmt0->N0 != FMT1) return 0;
+    if(Fmt0->N1 > ELM_REAL || Fmt0->N2 > ORD_ROW) return 0;
+    if(Fmt0->N4 == 0 || Fmt0->N5 == 0 || Fmt0->N4 > SIZE_MAX / 16 / Fmt0->N5) return 0;
+
+    return (Natural) (Fmt0->N4 * Fmt0->N5 * (Fmt0->N1 == ELM_COMPLEX ? 16 : 8));
+}
+
+/**
+ * @brief Convert [Cv], into complex column-major entries.
+ * 
+ * @param Cmt0 Complex Matrix [Cm], Target [t].
+ * @param P0 Entries.
+ * @param Fmt0 Header [Fmt].
+ */
+static void Cv_CmtPFmt_0(Complex* Cmt0, const void* P0, const Format* Fmt0) {
+    const register Natural N0 = (Natural) Fmt0->N4, N1 = (Natural) Fmt0->N5;
+    const Real* Rv0 = (const Real*) P0;
+    register Natural N2, N3, N4;
+
+    for(N3 = 0; N3 < N1; ++N3)
+        for(N2 = 0; N2 < N0; ++N2) {
+            N4 = Fmt0->N2 == ORD_COLUMN ? N3 * N0 + N2 : N2 * N1 + N3; // Source.
+
+            Cmt0[N3 * N0 + N2] = Fmt0->N1 == ELM_COMPLEX ? C_RR_C(Rv0[2 * N4], Rv0[2 * N4 + 1]) : C_R_C(Rv0[N4]);
+        }
+}
+
+// Files.
+
+/**
+ * @brief Load [Ld], from a descriptor.
+ * 
+ * Regular files are mapped privately from offset 0, complex column-major
+ * ones without copies, the entries being released by Fr_P_0. Other files,
+ * streams and sockets, are read from their current offset and converted.
+ * The descriptor is left open.
+ * 
+ * @param I0 Descriptor.
+ * @param Fmtt0 Header [Fmt], Target [t].
+ * @return Complex* Complex Matrix [Cm], column-major, NULL on failure.
+ */
+[[nodiscard]] Complex* Ld_IFmtt_Cm(const int I0, Format* Fmtt0) {
+    register Natural N0, N1 = 0;
+    register ssize_t I1;
+    struct stat St0;
+
+    if(I0 < 0) return NULL;
+
+    // Header.
+
+    for(N0 = 0; N0 < sizeof(Format); N0 += (Natural) I1)
+        if((I1 = read(I0, (char*) Fmtt0 + N0, sizeof(Format) - N0)) <= 0) break;
+
+    if(N0 < sizeof(Format) || (N1 = Chk_Fmt_N(Fmtt0)) == 0) return NULL;
+
+    const register Natural N2 = (Natural) (Fmtt0->N4 * Fmtt0->N5); // Entries.
+    Complex* Cm0 = NULL;
+
+    if(fstat(I0, &St0) == 0 && S_ISREG(St0.st_mode)) { // Mapping.
+        if((Natural) St0.st_size < FMT2 + N1) return NULL;
+
+        void* P0 = mmap(NULL, FMT2 + N1, PROT_READ | PROT_WRITE, MAP_PRIVATE, I0, 0);
+
+        if(P0 == MAP_FAILED) return NULL;
+
+        if(ALN0 == FMT2 && Fmtt0->N1 == ELM_COMPLEX && Fmtt0->N2 == ORD_COLUMN) // Zero-copy.
+            return (Complex*) Adp_PN_P(P0, FMT2 + N1);
+
+        if((Cm0 = (Complex*) Alc_NN_P(N2, sizeof(Complex))) != NULL)
+            Cv_CmtPFmt_0(Cm0, (char*) P0 + FMT2, Fmtt0);
+
+        munmap(P0, FMT2 + N1);
+        return Cm0;
+    }
+
+    // Stream.
+
+    void* P1 = Alc_NN_P(N1, 1);
+
+    for(N0 = 0; P1 != NULL && N0 < N1; N0 += (Natural) I1)
+        if((I1 = read(I0, (char*) P1 + N0, N1 - N0)) <= 0) break;
+
+    if(P1 != NULL && N0 == N1 && (Cm0 = (Complex*) Alc_NN_P(N2, sizeof(Complex))) != NULL)
+        Cv_CmtPFmt_0(Cm0, P1, Fmtt0);
+
+    Fr_P_0(P1);
+    return Cm0;
+}
+
+/**
+ * @brief Load [Ld].
+ * 
+ * @param S0 Path, NULL or "-" for stdin.
+ * @param Fmtt0 Header [Fmt], Target [t].
+ * @return Complex* Complex Matrix [Cm], column-major, NULL on failure.
+ */
+[[nodiscard]] Complex* Ld_SFmtt_Cm(const char* S0, Format* Fmtt0) {
+    if(S0 == NULL || strcmp(S0, "-") == 0) return Ld_IFmtt_Cm(STDIN_FILENO, Fmtt0);
+
+    const register int I0 = open(S0, O_RDONLY);
+    if(I0 < 0) return NULL;
+
+    Complex* Cm0 = Ld_IFmtt_Cm(I0, Fmtt0);
+    close(I0);
+
+    return Cm0;
+}
+
+/**
+ * @brief Save [Sv], complex column-major entries.
+ * 
+ * @param S0 Path, NULL or "-" for stdout.
+ * @param Fmt0 Header [Fmt], rows, columns and structure.
+ * @param Cm0 Complex Matrix [Cm].
+ * @return Natural Written entries [N].
+ */
+Natural Sv_SFmtCm_N(const char* S0, const Format* Fmt0, const Complex* Cm0) {
+    FILE* F0 = S0 == NULL || strcmp(S0, "-") == 0 ? stdout : fopen(S0, "wb");
+    if(F0 == NULL) return 0;
+
+    Format Fmt1 = {.S0 = {0}, .N0 = FMT1, .N1 = ELM_COMPLEX, .N2 = ORD_COLUMN, .N3 = Fmt0->N3, .N4 = Fmt0->N4, .N5 = Fmt0->N5, .N6 = 0};
+    memcpy(Fmt1.S0, FMT0, 8);
+
+    register Natural N0 = 0;
+
+    if(fwrite(&Fmt1, sizeof(Format), 1, F0) == 1)
+        N0 = fwrite(Cm0, sizeof(Complex), (Natural) (Fmt1.N4 * Fmt1.N5), F0);
+
+    if(F0 == stdout) fflush(F0);
+    else fclose(F0);
+
+    return N0;
+}
+
+// Matrix Market.
+
+// Layouts.
+
+#define MTX_ARRAY 0
+#define MTX_COORDINATE 1
+
+// Values.
+
+#define VAL_REAL 0
+#define VAL_COMPLEX 1
+#define VAL_PATTERN 2
+
+// Symmetries.
+
+#define SYM_GENERAL 0
+#define SYM_SYMMETRIC 1
+#define SYM_SKEW 2
+#define SYM_HERMITIAN 3
+
+// Chunk, parsed by a single thread.
+typedef struct {
+
+    // Start and end.
+    const char* S0;
+    const char* S1;
+
+    // Matrix, full storage.
+    Complex* Cm0;
+
+    // Rows and Columns.
+    Natural N0, N1;
+
+    // Layout, values and symmetry.
+    Natural N2, N3, N4;
+
+    // Entries, counted first and then the index of the first one.
+    Natural N5;
+
+    // Phase, 0 for counting and 1 for parsing.
+    Natural N6;
+
+    // Failure.
+    Natural N7;
+
+} Chunk;
+
+/**
+ * @brief Skip [Sk], blanks.
+ * 
+ * @param S0 Start.
+ * @param S1 End.
+ * @return const char* First non-blank.
+ */
+static inline const char* Sk_SS_S(const char* S0, const char* S1) {
+    while(S0 < S1 && (*S0 == ' ' || *S0 == '\t' || *S0 == '\r')) ++S0;
+    return S0;
+}
+
+/**
+ * @brief Next line [Nx].
+ * 
+ * @param S0 Start.
+ * @param S1 End.
+ * @return const char* Next line's start.
+ */
+static inline const char* Nx_SS_S(const char* S0, const char* S1) {
+    const char* S2 = (const char*) memchr(S0, '\n', (size_t) (S1 - S0));
+    return S2 != NULL ? S2 + 1 : S1;
+}
+
+/**
+ * @brief Read [Rd], natural number.
+ * 
+ * @param S0 Start.
+ * @param S1 End.
+ * @param Nt0 Natural Number [N], Target [t].
+ * @return const char* End of the number, NULL if none.
+ */
+static inline const char* Rd_SSNt_S(const char* S0, const char* S1, Natural* Nt0) {
+    register Natural N0 = 0;
+    const char* S2 = S0 = Sk_SS_S(S0, S1);
+
+    for(; S0 < S1 && *S0 >= '0' && *S0 <= '9'; ++S0)
+        N0 = 10 * N0 + (Natural) (*S0 - '0');
+
+    *Nt0 = N0;
+    return S0 > S2 ? S0 : NULL;
+}
+
+/**
+ * @brief Read [Rd], real number.
+ * 
+ * Exact on Clinger's fast path, up to 19 digits and powers of ten up to 22,
+ * strtod otherwise.
+ * 
+ * @param S0 Start.
+ * @param S1 End.
+ * @param Rt0 Real Number [R], Target [t].
+ * @return const char* End of the number, NULL if none.
+ */
+static const char* Rd_SSRt_S(const char* S0, const char* S1, Real* Rt0) {
+    static const Real Rv0[23] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+    const char* S2 = S0 = Sk_SS_S(S0, S1); // Token.
+    register uint64_t N0 = 0; // Mantissa.
+    register Integer I0 = 0, I1 = 0, I2 = 1; // Exponent, digits, exponent's sign.
+    register Natural N1 = 0, N2 = 0; // Significant digits, inexact.
+    const register bool B0 = S0 < S1 && *S0 == '-';
+
+    if(S0 < S1 && (*S0 == '-' || *S0 == '+')) ++S0;
+
+    for(; S0 < S1 && *S0 >= '0' && *S0 <= '9'; ++S0, ++I1) { // Integer part.
+        if(N1 < 19) { N0 = 10 * N0 + (uint64_t) (*S0 - '0'); if(N0 > 0) ++N1; }
+        else { ++I0; N2 = 1; }
+    }
+
+    if(S0 < S1 && *S0 == '.') { // Fractional part.
+        for(++S0; S0 < S1 && *S0 >= '0' && *S0 <= '9'; ++S0, ++I1) {
+            if(N1 < 19) { N0 = 10 * N0 + (uint64_t) (*S0 - '0'); --I0; if(N0 > 0) ++N1; }
+            else N2 = 1;
+        }
+    }
+
+    if(I1 > 0 && S0 < S1 && (*S0 == 'e' || *S0 == 'E')) { // Exponent.
+        register Integer I3 = 0;
+        const char* S3 = S0++;
+
+        if(S0 < S1 && (*S0 == '-' || *S0 == '+')) I2 = *S0++ == '-' ? -1 : 1;
+
+        if(S0 < S1 && *S0 >= '0' && *S0 <= '9')
+            for(; S0 < S1 && *S0 >= '0' && *S0 <= '9'; ++S0)
+                I3 = I3 < 100000 ? 10 * I3 + (*S0 - '0') : I3;
+        else S0 = S3;
+
+        I0 += I2 * I3;
+    }
+
+    if(I1 > 0 && N2 == 0 && N0 < ((uint64_t) 1 << 53) && I0 >= -22 && I0 <= 22) { // Fast path.
+        const register Real R0 = I0 < 0 ? (Real) N0 / Rv0[-I0] : (Real) N0 * Rv0[I0];
+
+        *Rt0 = B0 ? -R0 : R0;
+        return S0;
+    }
+
+    // Slow path, strtod on a bounded copy.
+
+    char S4[128];
+    register Natural N3 = 0;
+
+    for(S0 = S2; S0 < S1 && N3 < sizeof(S4) - 1 && *S0 != ' ' && *S0 != '\t' && *S0 != '\r' && *S0 != '\n'; ++S0)
+        S4[N3++] = *S0;
+
+    S4[N3] = '\0';
+
+    char* S5;
+    *Rt0 = strtod(S4, &S5);
+
+    return S5 > S4 ? S2 + (S5 - S4) : NULL;
+}
+
+/**
+ * @brief Put [Put], an entry and its mirror.
+ * 
+ * @param Chk0 Chunk [Chk].
+ * @param N0 Row [N].
+ * @param N1 Column [N].
+ * @param C0 Complex Number [C].
+ */
+static inline void Put_ChkNNC_0(const Chunk* Chk0, const Natural N0, const Natural N1, const Complex C0) {
+    Chk0->Cm0[N1 * Chk0->N0 + N0] = C0;
+
+    if(N0 == N1 || Chk0->N4 == SYM_GENERAL) return;
+
+    Chk0->Cm0[N0 * Chk0->N0 + N1] = Chk0->N4 == SYM_SYMMETRIC ? C0 : Chk0->N4 == SYM_SKEW ? S_CC_C(C_R_C(0.0), C0) : Cj_C_C(C0);
+}
+
+/**
+ * @brief Parse [Prs], worker side.
+ * 
+ * @param P0 Chunk.
+ * @return void* NULL.
+ */
+static void* Prs_P_0(void* P0) {
+    Chunk* Chk0 = (Chunk*) P0;
+    const char* S0 = Chk0->S0, * S1 = Chk0->S1, * S2;
+
+    register Natural N0 = 0, N3 = Chk0->N4 == SYM_SKEW; // Entries, skew offset.
+    Natural N1 = 0, N2 = 0; // Row, column.
+    Real R0 = 1.0, R1 = 0.0;
+
+    if(Chk0->N6 == 0) { // Counting, array layout.
+        for(; S0 < S1; S0 = Nx_SS_S(S0, S1))
+            if((S2 = Sk_SS_S(S0, S1)) < S1 && *S2 != '\n' && *S2 != '%') ++N0;
+
+        Chk0->N5 = N0;
+        return NULL;
+    }
+
+    if(Chk0->N2 == MTX_ARRAY) { // First entry's position.
+        N0 = Chk0->N5;
+
+        if(Chk0->N4 == SYM_GENERAL) { N1 = N0 % Chk0->N0; N2 = N0 / Chk0->N0; }
+        else {
+            for(; N2 < Chk0->N1 && N0 >= Chk0->N0 - N2 - N3; ++N2)
+                N0 -= Chk0->N0 - N2 - N3;
+
+            N1 = N2 + N3 + N0;
+        }
+    }
+
+    for(; S0 < S1; S0 = Nx_SS_S(S0, S1)) {
+        if((S2 = Sk_SS_S(S0, S1)) == S1 || *S2 == '\n' || *S2 == '%') continue; // Blank lines, comments.
+
+        if(Chk0->N2 == MTX_COORDINATE) { // Indices.
+            if((S2 = Rd_SSNt_S(S2, S1, &N1)) == NULL || (S2 = Rd_SSNt_S(S2, S1, &N2)) == NULL) { Chk0->N7 = 1; return NULL; }
+            if(N1 == 0 || N2 == 0 || N1 > Chk0->N0 || N2 > Chk0->N1) { Chk0->N7 = 1; return NULL; }
+
+            --N1; --N2;
+        } else if(N2 >= Chk0->N1) { Chk0->N7 = 1; return NULL; }
+
+        if(Chk0->N3 != VAL_PATTERN && (S2 = Rd_SSRt_S(S2, S1, &R0)) == NULL) { Chk0->N7 = 1; return NULL; }
+        if(Chk0->N3 == VAL_COMPLEX && (S2 = Rd_SSRt_S(S2, S1, &R1)) == NULL) { Chk0->N7 = 1; return NULL; }
+
+        Put_ChkNNC_0(Chk0, N1, N2, C_RR_C(R0, R1));
+
+        if(Chk0->N2 == MTX_ARRAY && ++N1 == Chk0->N0) { // Next position.
+            ++N2;
+            N1 = Chk0->N4 == SYM_GENERAL ? 0 : N2 + N3;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Run [Run], chunks over a team.
+ * 
+ * Chunks whose thread cannot be created are parsed by the caller.
+ * 
+ * @param Chkv0 Chunks [Chk].
+ * @param N0 Chunks [N].
+ */
+static void Run_ChkvN_0(Chunk* Chkv0, const Natural N0) {
+    pthread_t* Th0 = N0 > 1 ? (pthread_t*) Alc_NN_P(N0 - 1, sizeof(pthread_t)) : NULL;
+    register Natural N1, N2;
+
+    for(N1 = 1; N1 < N0; ++N1)
+        if(pthread_create(Th0 + N1 - 1, NULL, Prs_P_0, Chkv0 + N1) != 0) break; // Smaller team.
+
+    for(N2 = N1; N2 < N0; ++N2) // Fallback.
+        Prs_P_0(Chkv0 + N2);
+
+    Prs_P_0(Chkv0);
+
+    for(N2 = 1; N2 < N1; ++N2)
+        pthread_join(Th0[N2 - 1], NULL);
+
+    Fr_P_0(Th0);
+}
+
+/**
+ * @brief Matrix Market [Mtx], parallel reader.
+ * 
+ * @param S0 Path.
+ * @param Fmtt0 Header [Fmt], Target [t], as for a complex column-major file.
+ * @param N0 Threads [N].
+ * @return Complex* Complex Matrix [Cm], column-major, NULL on failure.
+ */
+[[nodiscard]] Complex* Mtx_SFmttN_Cm(const char* S0, Format* Fmtt0, const Natural N0) {
+    const register int I0 = open(S0, O_RDONLY);
+    struct stat St0;
+
+    if(I0 < 0) return NULL;
+    if(fstat(I0, &St0) != 0 || St0.st_size == 0) { close(I0); return NULL; }
+
+    const register Natural N1 = (Natural) St0.st_size; // Bytes.
+    void* P0 = mmap(NULL, N1, PROT_READ, MAP_PRIVATE, I0, 0);
+    close(I0);
+
+    if(P0 == MAP_FAILED) return NULL;
+
+    #ifdef MADV_SEQUENTIAL
+    madvise(P0, N1, MADV_SEQUENTIAL);
+    #endif
+
+    const char* S1 = (const char*) P0, * S2 = S1 + N1, * S3;
+    Chunk Chk0 = {.S0 = NULL, .S1 = NULL, .Cm0 = NULL, .N5 = 0, .N6 = 1, .N7 = 0};
+    Complex* Cm0 = NULL;
+
+    // Banner.
+
+    char S4[256], S5[5][32];
+    register Natural N2 = (Natural) (Nx_SS_S(S1, S2) - S1), N3, N4, N5;
+
+    memcpy(S4, S1, N2 < sizeof(S4) - 1 ? N2 : sizeof(S4) - 1);
+    S4[N2 < sizeof(S4) - 1 ? N2 : sizeof(S4) - 1] = '\0';
+
+    if(sscanf(S4, "%31s %31s %31s %31s %31s", S5[0], S5[1], S5[2], S5[3], S5[4]) != 5 || strcmp(S5[0], "%%MatrixMarket") != 0 || strcasecmp(S5[1], "matrix") != 0) goto End;
+
+    if(strcasecmp(S5[2], "array") == 0) Chk0.N2 = MTX_ARRAY;
+    else if(strcasecmp(S5[2], "coordinate") == 0) Chk0.N2 = MTX_COORDINATE;
+    else goto End;
+
+    if(strcasecmp(S5[3], "real") == 0 || strcasecmp(S5[3], "integer") == 0) Chk0.N3 = VAL_REAL;
+    else if(strcasecmp(S5[3], "complex") == 0) Chk0.N3 = VAL_COMPLEX;
+    else if(strcasecmp(S5[3], "pattern") == 0 && Chk0.N2 == MTX_COORDINATE) Chk0.N3 = VAL_PATTERN;
+    else goto End;
+
+    if(strcasecmp(S5[4], "general") == 0) Chk0.N4 = SYM_GENERAL;
+    else if(strcasecmp(S5[4], "symmetric") == 0) Chk0.N4 = SYM_SYMMETRIC;
+    else if(strcasecmp(S5[4], "skew-symmetric") == 0) Chk0.N4 = SYM_SKEW;
+    else if(strcasecmp(S5[4], "hermitian") == 0 && Chk0.N3 == VAL_COMPLEX) Chk0.N4 = SYM_HERMITIAN;
+    else goto End;
+
+    // Sizes.
+
+    for(S1 = Nx_SS_S(S1, S2); S1 < S2 && ((S3 = Sk_SS_S(S1, S2)) == S2 || *S3 == '%' || *S3 == '\n'); S1 = Nx_SS_S(S1, S2));
+
+    if((S3 = Rd_SSNt_S(S1, S2, &Chk0.N0)) == NULL || Rd_SSNt_S(S3, S2, &Chk0.N1) == NULL) goto End;
+    if(Chk0.N0 == 0 || Chk0.N1 == 0 || (Chk0.N4 != SYM_GENERAL && Chk0.N0 != Chk0.N1)) goto End;
+
+    S1 = Nx_SS_S(S1, S2); // Entries.
+
+    if((Cm0 = (Complex*) Calc_NN_P(Chk0.N0 * Chk0.N1, sizeof(Complex))) == NULL) goto End;
+    Chk0.Cm0 = Cm0;
+
+    // Chunks, split at line boundaries.
+
+    N2 = (Natural) (S2 - S1) / MTX0 + 1;
+    if(N2 > N0) N2 = N0;
+    if(N2 == 0) N2 = 1;
+
+    Chunk* Chkv0 = (Chunk*) Alc_NN_P(N2, sizeof(Chunk));
+
+    for(N3 = 0, S3 = S1; N3 < N2; ++N3) {
+        Chkv0[N3] = Chk0;
+        Chkv0[N3].S0 = S3;
+        Chkv0[N3].S1 = N3 + 1 < N2 ? S1 + (S2 - S1) * (N3 + 1) / N2 : S2;
+
+        if(Chkv0[N3].S1 < S3) Chkv0[N3].S1 = S3;
+        if(Chkv0[N3].S1 > S1 && Chkv0[N3].S1 < S2 && Chkv0[N3].S1[-1] != '\n') Chkv0[N3].S1 = Nx_SS_S(Chkv0[N3].S1, S2);
+
+        S3 = Chkv0[N3].S1;
+    }
+
+    if(Chk0.N2 == MTX_ARRAY) { // Entries per chunk.
+        for(N3 = 0; N3 < N2; ++N3) Chkv0[N3].N6 = 0;
+        Run_ChkvN_0(Chkv0, N2);
+
+        for(N3 = 0, N4 = 0; N3 < N2; ++N3) {
+            N5 = Chkv0[N3].N5;
+            Chkv0[N3].N5 = N4;
+            Chkv0[N3].N6 = 1;
+            N4 += N5;
+        }
+
+        N5 = Chk0.N4 == SYM_GENERAL ? Chk0.N0 * Chk0.N1 : Chk0.N4 == SYM_SKEW ? Chk0.N0 * (Chk0.N0 - 1) / 2 : Chk0.N0 * (Chk0.N0 + 1) / 2;
+        if(N4 != N5) Chkv0[0].N7 = 1;
+    }
+
+    if(Chkv0[0].N7 == 0) Run_ChkvN_0(Chkv0, N2);
+
+    for(N3 = 0; N3 < N2; ++N3)
+        if(Chkv0[N3].N7 != 0) { Fr_P_0(Cm0); Cm0 = NULL; break; }
+
+    Fr_P_0(Chkv0);
+
+    if(Cm0 != NULL) { // Header.
+        memcpy(Fmtt0->S0, FMT0, 8);
+
+        Fmtt0->N0 = FMT1;
+        Fmtt0->N1 = Chk0.N3 == VAL_COMPLEX ? ELM_COMPLEX : ELM_REAL;
+        Fmtt0->N2 = ORD_COLUMN;
+        Fmtt0->N3 = (Chk0.N3 != VAL_COMPLEX ? STR_REAL : STR_GENERAL) | (Chk0.N4 == SYM_HERMITIAN || (Chk0.N4 == SYM_SYMMETRIC && Chk0.N3 != VAL_COMPLEX) ? STR_HERMITIAN : STR_GENERAL);
+        Fmtt0->N4 = Chk0.N0;
+        Fmtt0->N5 = Chk0.N1;
+        Fmtt0->N6 = 0;
+    }
+
+    End:
+    munmap(P0, N1);
+    return Cm0;
+}
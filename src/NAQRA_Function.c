@@ -0,0 +1,493 @@
+/**
+ * @file NAQRA_Function.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief include/Function.h implementation.
+ * @date 2024-12-21
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <math.h>
+#include "../include/Function.h"
+
+// Scalar functions.
+
+/**
+ * @brief Exponential [Exp], Taylor coefficient.
+ * 
+ * @param C0 Complex Number [C], point.
+ * @param N0 Order [N].
+ * @return Complex Complex Number [C], exp(z) / k!.
+ */
+Complex Exp_CN_C(const Complex C0, const Natural N0) {
+    register Real R0 = exp(vgetq_lane_f64(C0, 0));
+
+    for(register Natural N1 = 2; N1 <= N0; ++N1)
+        R0 /= (Real) N1;
+
+    return C_RR_C(R0 * cos(vgetq_lane_f64(C0, 1)), R0 * sin(vgetq_lane_f64(C0, 1)));
+}
+
+/**
+ * @brief Principal logarithm [Log], Taylor coefficient.
+ * 
+ * @param C0 Complex Number [C], point.
+ * @param N0 Order [N].
+ * @return Complex Complex Number [C], log(z) for k = 0, (-1)^(k - 1) / (k z^k) otherwise.
+ */
+Complex Log_CN_C(const Complex C0, const Natural N0) {
+    if(N0 == 0) return C_RR_C(log(N2_C_R(C0)), atan2(vgetq_lane_f64(C0, 1), vgetq_lane_f64(C0, 0)));
+
+    const register Complex C1 = D_CC_C(C_R_C(-1.0), C0);
+    register Complex C2 = C_R_C(-1.0 / (Real) N0);
+
+    for(register Natural N1 = 0; N1 < N0; ++N1)
+        C2 = M_CC_C(C2, C1);
+
+    return C2;
+}
+
+/**
+ * @brief Exponential [Exp], radius of convergence.
+ * 
+ * @param C0 Complex Number [C], point.
+ * @return Real Real Number [R], infinite, the exponential being entire.
+ */
+Real Exp_C_R([[maybe_unused]] const Complex C0) { return INFINITY; }
+
+/**
+ * @brief Principal logarithm [Log], radius of convergence.
+ * 
+ * @param C0 Complex Number [C], point.
+ * @return Real Real Number [R], distance to the closed negative real axis.
+ */
+Real Log_C_R(const Complex C0) { return vgetq_lane_f64(C0, 0) >= 0.0 ? N2_C_R(C0) : fabs(vgetq_lane_f64(C0, 1)); }
+
+// Schur form.
+
+/**
+ * @brief Schur form [Sch], Schur vectors accumulated.
+ * 
+ * Hessenberg input skips the reduction.
+ * 
+ * @param Cqt0 Complex Square Matrix [Cq], Target [t], upper triangular Schur form T on exit.
+ * @param Cqt1 Complex Square Matrix [Cq], Target [t], Schur vectors Q on exit, A = Q T Q^H.
+ * @param N0 Rows and Columns [N].
+ */
+void Sch_CqtCqtN_0(Complex* Cqt0, Complex* Cqt1, const Natural N0) {
+    Natural* Nv0 = (Natural*) Alc_NN_P(N0, sizeof(Natural)); // Splits, unused.
+    register Natural N1, N2;
+
+    for(N1 = 0; N1 < N0; ++N1) // Identity.
+        for(N2 = 0; N2 < N0; ++N2)
+            Cqt1[N1 * N0 + N2] = C_R_C(N1 == N2 ? 1.0 : 0.0);
+
+    if(N0 > 2 && !(Str_CqNvtN_N(Cqt0, Nv0, N0) & STR_HESSENBERG)) Hsn_CqtCqtN_0(Cqt0, Cqt1, N0); // Hessenberg.
+    if(N0 > 1) Eig_ChsnqtCqtN_0(Cqt0, Cqt1, N0); // Schur.
+
+    for(N1 = 0; N1 < N0; ++N1) // Zeroing.
+        for(N2 = N1 + 1; N2 < N0; ++N2)
+            Cqt0[N1 * N0 + N2] = C_R_C(0.0);
+
+    Fr_P_0(Nv0);
+}
+
+/**
+ * @brief Swap [Swp], adjacent diagonal entries of the Schur form.
+ * 
+ * A rotation taking (t, b - a) to (r, 0), t being the entry between them,
+ * exchanges a and b, the transformation being accumulated.
+ * 
+ * @param Cut0 Complex Upper Triangular Matrix [Cu], Target [t].
+ * @param Cqt0 Complex Square Matrix [Cq], Target [t], Schur vectors.
+ * @param N0 Index [N], entries N0 and N0 + 1.
+ * @param N1 Rows and Columns [N].
+ */
+static void Swp_CutCqtNN_0(Complex* Cut0, Complex* Cqt0, const Natural N0, const Natural N1) {
+    const register Complex C0 = Cut0[N0 * (N1 + 1)], C1 = Cut0[(N0 + 1) * (N1 + 1)];
+    const register Complex C2 = Cut0[(N0 + 1) * N1 + N0];
+    const register Complex C3 = S_CC_C(C1, C0);
+
+    const register Real R0 = N2_C_R(C2), R1 = N2_C_R(C3);
+    const register Real R2 = hypot(R0, R1);
+
+    // Cosine and sine.
+
+    const register Real R3 = R0 / R2;
+    const register Complex C4 = R0 > 0.0 ? D_CR_C(M_CCcj_C(Nzd2_C_C(C2), C3), R2) : Nzd2_C_C(Cj_C_C(C3));
+    register Natural N2;
+
+    for(N2 = N0 + 2; N2 < N1; ++N2) { // Rows.
+        const register Complex C5 = Cut0[N2 * N1 + N0], C6 = Cut0[N2 * N1 + N0 + 1];
+
+        Cut0[N2 * N1 + N0] = A_CC_C(M_CR_C(C5, R3), M_CC_C(C4, C6));
+        Cut0[N2 * N1 + N0 + 1] = S_CC_C(M_CR_C(C6, R3), M_CcjC_C(C4, C5));
+    }
+
+    for(N2 = 0; N2 < N0; ++N2) { // Columns.
+        const register Complex C5 = Cut0[N0 * N1 + N2], C6 = Cut0[(N0 + 1) * N1 + N2];
+
+        Cut0[N0 * N1 + N2] = A_CC_C(M_CR_C(C5, R3), M_CCcj_C(C6, C4));
+        Cut0[(N0 + 1) * N1 + N2] = S_CC_C(M_CR_C(C6, R3), M_CC_C(C5, C4));
+    }
+
+    for(N2 = 0; N2 < N1; ++N2) { // Schur vectors.
+        const register Complex C5 = Cqt0[N0 * N1 + N2], C6 = Cqt0[(N0 + 1) * N1 + N2];
+
+        Cqt0[N0 * N1 + N2] = A_CC_C(M_CR_C(C5, R3), M_CCcj_C(C6, C4));
+        Cqt0[(N0 + 1) * N1 + N2] = S_CC_C(M_CR_C(C6, R3), M_CC_C(C5, C4));
+    }
+
+    Cut0[N0 * (N1 + 1)] = C1;
+    Cut0[(N0 + 1) * (N1 + 1)] = C0;
+}
+
+/**
+ * @brief Groups [Grp], contiguous on a diagonal range of the Schur form.
+ * 
+ * Eigenvalues within R0 of each other share a group, transitively. Groups
+ * keep the order of their first eigenvalue and are gathered by adjacent
+ * swaps, as few as the inversions.
+ * 
+ * @param Cut0 Complex Upper Triangular Matrix [Cu], Target [t], reordered.
+ * @param Cqt0 Complex Square Matrix [Cq], Target [t], Schur vectors.
+ * @param Nvt0 Natural Vector [Nv], Target [t], groups' boundaries, N1 + 1 entries.
+ * @param R0 Real Number [R], distance.
+ * @param N0 First index [N].
+ * @param N1 Entries [N].
+ * @param N2 Rows and Columns [N].
+ * @return Natural Groups [N].
+ */
+static Natural Grp_CutCqtNvtRNNN_N(Complex* Cut0, Complex* Cqt0, Natural* Nvt0, const Real R0, const Natural N0, const Natural N1, const Natural N2) {
+    Natural* Nv0 = (Natural*) Alc_NN_P(N1, sizeof(Natural)); // Labels.
+    register Natural N3, N4, N5, N6 = 0;
+
+    for(N3 = 0; N3 < N1; ++N3)
+        Nv0[N3] = N3;
+
+    for(N3 = 0; N3 < N1; ++N3) // Grouping.
+        for(N4 = N3 + 1; N4 < N1; ++N4) {
+            if(Nv0[N3] == Nv0[N4] || N2_C_R(S_CC_C(Cut0[(N0 + N3) * (N2 + 1)], Cut0[(N0 + N4) * (N2 + 1)])) > R0) continue;
+
+            const register Natural N7 = Nv0[N3] < Nv0[N4] ? Nv0[N3] : Nv0[N4];
+            const register Natural N8 = Nv0[N3] < Nv0[N4] ? Nv0[N4] : Nv0[N3];
+
+            for(N5 = 0; N5 < N1; ++N5) // Merge.
+                if(Nv0[N5] == N8) Nv0[N5] = N7;
+        }
+
+    for(N3 = 1; N3 < N1; ++N3) // Reordering.
+        for(N4 = N3; N4 > 0 && Nv0[N4 - 1] > Nv0[N4]; --N4) {
+            Swp_CutCqtNN_0(Cut0, Cqt0, N0 + N4 - 1, N2);
+
+            N5 = Nv0[N4 - 1];
+            Nv0[N4 - 1] = Nv0[N4];
+            Nv0[N4] = N5;
+        }
+
+    Nvt0[0] = N0;
+
+    for(N3 = 1; N3 < N1; ++N3) // Boundaries.
+        if(Nv0[N3] != Nv0[N3 - 1]) Nvt0[++N6] = N0 + N3;
+
+    Nvt0[++N6] = N0 + N1;
+
+    Fr_P_0(Nv0);
+
+    return N6;
+}
+
+/**
+ * @brief Clusters [Cls], contiguous on the Schur form's diagonal.
+ * 
+ * Eigenvalues within FNC0 of each other share a cluster, transitively.
+ * 
+ * @param Cut0 Complex Upper Triangular Matrix [Cu], Target [t], reordered.
+ * @param Cqt0 Complex Square Matrix [Cq], Target [t], Schur vectors.
+ * @param Nvt0 Natural Vector [Nv], Target [t], blocks' boundaries, N0 + 1 entries.
+ * @param N0 Rows and Columns [N].
+ * @return Natural Blocks [N].
+ */
+Natural Cls_CutCqtNvtN_N(Complex* Cut0, Complex* Cqt0, Natural* Nvt0, const Natural N0) {
+    return Grp_CutCqtNvtRNNN_N(Cut0, Cqt0, Nvt0, FNC0, 0, N0, N0);
+}
+
+/**
+ * @brief Fit [Fit], a cluster against the radius of convergence at its mean.
+ * 
+ * @param Cu0 Complex Upper Triangular Matrix [Cu].
+ * @param Rd0 Radius callback [Rd], NULL for entire functions.
+ * @param N0 First index [N].
+ * @param N1 Entries [N].
+ * @param N2 Rows and Columns [N].
+ * @return Real Real Number [R], the cluster's radius if beyond FNC3 of min(1, r), 0 otherwise.
+ */
+static Real Fit_CuRdNNN_R(const Complex* Cu0, const Radius Rd0, const Natural N0, const Natural N1, const Natural N2) {
+    register Complex C0 = C_R_C(0.0);
+    register Real R0 = 0.0;
+    register Natural N3;
+
+    for(N3 = N0; N3 < N0 + N1; ++N3) // Mean.
+        C0 = A_CC_C(C0, Cu0[N3 * (N2 + 1)]);
+
+    C0 = D_CR_C(C0, (Real) N1);
+
+    for(N3 = N0; N3 < N0 + N1; ++N3) // Radius.
+        R0 = fmax(R0, N2_C_R(S_CC_C(Cu0[N3 * (N2 + 1)], C0)));
+
+    return R0 <= FNC3 * fmin(1.0, Rd0 != NULL ? Rd0(C0) : INFINITY) ? 0.0 : R0;
+}
+
+/**
+ * @brief Fit [Fit], every cluster.
+ * 
+ * @param Cu0 Complex Upper Triangular Matrix [Cu], Schur form, clustered.
+ * @param Nv0 Natural Vector [Nv], blocks' boundaries.
+ * @param Rd0 Radius callback [Rd], NULL for entire functions.
+ * @param N0 Rows and Columns [N].
+ * @param N1 Blocks [N].
+ * @return true Every cluster fits f's Taylor series.
+ * @return false Some cluster has to be split.
+ */
+bool Fit_CuNvRdNN_B(const Complex* Cu0, const Natural* Nv0, const Radius Rd0, const Natural N0, const Natural N1) {
+    for(register Natural N2 = 0; N2 < N1; ++N2)
+        if(Nv0[N2 + 1] - Nv0[N2] > 1 && Fit_CuRdNNN_R(Cu0, Rd0, Nv0[N2], Nv0[N2 + 1] - Nv0[N2], N0) > 0.0) return false;
+
+    return true;
+}
+
+/**
+ * @brief Split [Spl], a cluster, recursively.
+ * 
+ * A cluster that does not fit is regrouped at half the distance, or at half
+ * its radius if smaller, until it breaks apart.
+ * 
+ * @param Cut0 Complex Upper Triangular Matrix [Cu], Target [t], reordered.
+ * @param Cqt0 Complex Square Matrix [Cq], Target [t], Schur vectors.
+ * @param Nvt0 Natural Vector [Nv], Target [t], blocks' first indices.
+ * @param Rd0 Radius callback [Rd], NULL for entire functions.
+ * @param R0 Real Number [R], the cluster's distance.
+ * @param N0 First index [N].
+ * @param N1 Entries [N].
+ * @param N2 Rows and Columns [N].
+ * @return Natural Blocks [N].
+ */
+static Natural Spl_CutCqtNvtRdRNNN_N(Complex* Cut0, Complex* Cqt0, Natural* Nvt0, const Radius Rd0, Real R0, const Natural N0, const Natural N1, const Natural N2) {
+    const register Real R1 = N1 > 1 ? Fit_CuRdNNN_R(Cut0, Rd0, N0, N1, N2) : 0.0;
+    register Natural N3 = 1, N4, N5 = 0;
+
+    Nvt0[0] = N0;
+    if(R1 == 0.0) return 1;
+
+    Natural* Nv0 = (Natural*) Alc_NN_P(N1 + 1, sizeof(Natural)); // Groups' boundaries.
+
+    for(R0 = fmin(R0, R1); N3 == 1 && R0 > 0.0;) // Regrouping.
+        N3 = Grp_CutCqtNvtRNNN_N(Cut0, Cqt0, Nv0, R0 /= 2.0, N0, N1, N2);
+
+    if(N3 == 1) N5 = 1; // Inseparable.
+    else for(N4 = 0; N4 < N3; ++N4)
+        N5 += Spl_CutCqtNvtRdRNNN_N(Cut0, Cqt0, Nvt0 + N5, Rd0, R0, Nv0[N4], Nv0[N4 + 1] - Nv0[N4], N2);
+
+    Fr_P_0(Nv0);
+
+    return N5;
+}
+
+/**
+ * @brief Split [Spl], clusters not fitting f's Taylor series.
+ * 
+ * A cluster fits when its eigenvalues lie within FNC3 of min(1, r) from
+ * their mean, r being the radius of convergence there, so that the series'
+ * terms decay geometrically.
+ * 
+ * @param Cut0 Complex Upper Triangular Matrix [Cu], Target [t], reordered.
+ * @param Cqt0 Complex Square Matrix [Cq], Target [t], Schur vectors.
+ * @param Nvt0 Natural Vector [Nv], Target [t], blocks' boundaries, N0 + 1 entries.
+ * @param Rd0 Radius callback [Rd], NULL for entire functions.
+ * @param N0 Rows and Columns [N].
+ * @param N1 Blocks [N].
+ * @return Natural Blocks [N].
+ */
+Natural Spl_CutCqtNvtRdNN_N(Complex* Cut0, Complex* Cqt0, Natural* Nvt0, const Radius Rd0, const Natural N0, const Natural N1) {
+    Natural* Nv0 = (Natural*) Alc_NN_P(N1 + 1, sizeof(Natural)); // Previous boundaries.
+    register Natural N2, N3 = 0;
+
+    for(N2 = 0; N2 <= N1; ++N2)
+        Nv0[N2] = Nvt0[N2];
+
+    for(N2 = 0; N2 < N1; ++N2)
+        N3 += Spl_CutCqtNvtRdRNNN_N(Cut0, Cqt0, Nvt0 + N3, Rd0, FNC0, Nv0[N2], Nv0[N2 + 1] - Nv0[N2], N0);
+
+    Nvt0[N3] = N0;
+
+    Fr_P_0(Nv0);
+
+    return N3;
+}
+
+// Matrix functions.
+
+/**
+ * @brief Taylor series [Tay], diagonal block.
+ * 
+ * f(T) = sum_k c_k (T - sI)^k, s being the mean of the block's eigenvalues,
+ * until two consecutive terms fall below FNC2 relative to the sum. Running
+ * out of FNC1 terms or into non-finite values is reported.
+ * 
+ * @param Cu0 Complex Upper Triangular Matrix [Cu], block.
+ * @param Ty0 Taylor callback [Ty].
+ * @param Cut0 Complex Upper Triangular Matrix [Cu], Target [t], block.
+ * @param N0 Block's rows and columns [N].
+ * @param N1 Stride [N].
+ * @return Natural Status [N], STS_CONVERGED, STS_ITERATIONS or STS_FAILED.
+ */
+static Natural Tay_CuTyCutNN_N(const Complex* Cu0, const Taylor Ty0, Complex* Cut0, const Natural N0, const Natural N1) {
+    Complex* Cu1 = (Complex*) Calc_NN_P(N0 * N0, sizeof(Complex)); // T - sI.
+    Complex* Cu2 = (Complex*) Calc_NN_P(N0 * N0, sizeof(Complex)); // Power.
+    Complex* Cu3 = (Complex*) Calc_NN_P(N0 * N0, sizeof(Complex)); // Next power.
+    Complex* Cu4;
+
+    register Natural N2, N3, N4, N5 = 0, N6 = STS_ITERATIONS;
+    register Complex C0 = C_R_C(0.0), C1;
+    register Real R0, R1;
+
+    for(N2 = 0; N2 < N0; ++N2) // Mean.
+        C0 = A_CC_C(C0, Cu0[N2 * (N1 + 1)]);
+
+    C0 = D_CR_C(C0, (Real) N0);
+
+    for(N2 = 0; N2 < N0; ++N2) { // Shift.
+        Cp_CvtCvN_0(Cu1 + N2 * N0, Cu0 + N2 * N1, N2 + 1);
+        Cu1[N2 * (N0 + 1)] = S_CC_C(Cu1[N2 * (N0 + 1)], C0);
+        Cu2[N2 * (N0 + 1)] = C_R_C(1.0);
+    }
+
+    C1 = Ty0(C0, 0);
+
+    for(N2 = 0; N2 < N0; ++N2) // First term.
+        Cut0[N2 * (N1 + 1)] = C1;
+
+    for(N3 = 1; N3 <= FNC1; ++N3) {
+        for(N2 = 0; N2 < N0; ++N2) { // Power, triangular.
+            for(N4 = 0; N4 <= N2; ++N4)
+                Cu3[N2 * N0 + N4] = C_R_C(0.0);
+
+            for(N4 = 0; N4 <= N2; ++N4)
+                Ma_CvtCvCN_0(Cu3 + N2 * N0, Cu2 + N4 * N0, Cu1[N2 * N0 + N4], N4 + 1);
+        }
+
+        Cu4 = Cu2;
+        Cu2 = Cu3;
+        Cu3 = Cu4;
+
+        C1 = Ty0(C0, N3);
+        R0 = R1 = 0.0;
+
+        for(N2 = 0; N2 < N0; ++N2) {
+            Ma_CvtCvCN_0(Cut0 + N2 * N1, Cu2 + N2 * N0, C1, N2 + 1);
+
+            const register Real R2 = N2_CvN_R(Cu2 + N2 * N0, N2 + 1), R3 = N2_CvN_R(Cut0 + N2 * N1, N2 + 1);
+
+            R0 += R2 * R2; // Norms.
+            R1 += R3 * R3;
+        }
+
+        if(!isfinite(R1)) { N6 = STS_FAILED; break; } // Overflow.
+        if(R0 == 0.0) { N6 = STS_CONVERGED; break; } // Nilpotent.
+        if(N2_C_R(C1) * sqrt(R0) > FNC2 * sqrt(R1)) { N5 = 0; continue; }
+        if(++N5 == 2) { N6 = STS_CONVERGED; break; } // Convergence.
+    }
+
+    Fr_P_0(Cu1);
+    Fr_P_0(Cu2);
+    Fr_P_0(Cu3);
+
+    return N6;
+}
+
+/**
+ * @brief Matrix function [Fnc], blocked Schur-Parlett.
+ * 
+ * Diagonal blocks come from Taylor series, single eigenvalues directly.
+ * Above them, block (i, j) solves T_ii F_ij - F_ij T_jj = F_ii T_ij -
+ * T_ij F_jj + sum_k (F_ik T_kj - T_ik F_kj), by columns and back
+ * substitution, the clusters' separation keeping it nonsingular.
+ * 
+ * @param Cu0 Complex Upper Triangular Matrix [Cu], Schur form, clustered.
+ * @param Nv0 Natural Vector [Nv], blocks' boundaries.
+ * @param Ty0 Taylor callback [Ty].
+ * @param Cut0 Complex Upper Triangular Matrix [Cu], Target [t], f(T).
+ * @param N0 Rows and Columns [N].
+ * @param N1 Blocks [N].
+ * @return Natural Status [N], the first block's failure, STS_FAILED for non-finite entries.
+ */
+Natural Fnc_CuNvTyCutNN_N(const Complex* Cu0, const Natural* Nv0, const Taylor Ty0, Complex* Cut0, const Natural N0, const Natural N1) {
+    register Natural N2, N3, N4, N5;
+
+    for(N2 = 0; N2 < N0 * N0; ++N2)
+        Cut0[N2] = C_R_C(0.0);
+
+    for(N2 = 0; N2 < N1; ++N2) { // Diagonal blocks.
+        const register Natural N6 = Nv0[N2], N7 = Nv0[N2 + 1] - Nv0[N2];
+
+        if(N7 == 1) Cut0[N6 * (N0 + 1)] = Ty0(Cu0[N6 * (N0 + 1)], 0);
+        else if((N5 = Tay_CuTyCutNN_N(Cu0 + N6 * (N0 + 1), Ty0, Cut0 + N6 * (N0 + 1), N7, N0)) != STS_CONVERGED) return N5;
+    }
+
+    for(N2 = 1; N2 < N1; ++N2) // Block columns.
+        for(N3 = N2; N3-- > 0;) { // Block rows, upwards.
+            const register Natural N6 = Nv0[N3], N7 = Nv0[N3 + 1]; // Rows.
+            const register Natural N8 = Nv0[N2], N9 = Nv0[N2 + 1]; // Columns.
+
+            for(N4 = N8; N4 < N9; ++N4) {
+                Complex* Ccv0 = Cut0 + N4 * N0 + N6;
+
+                for(N5 = N6; N5 < N8; ++N5) // F_ik T_kj.
+                    Ma_CvtCvCN_0(Ccv0, Cut0 + N5 * N0 + N6, Cu0[N4 * N0 + N5], (N5 < N7 ? N5 + 1 : N7) - N6);
+
+                for(N5 = N7; N5 <= N4; ++N5) // T_ik F_kj.
+                    Ma_CvtCvCN_0(Ccv0, Cu0 + N5 * N0 + N6, vnegq_f64(Cut0[N4 * N0 + N5]), N7 - N6);
+
+                for(N5 = N8; N5 < N4; ++N5) // Sylvester, previous columns.
+                    Ma_CvtCvCN_0(Ccv0, Cut0 + N5 * N0 + N6, Cu0[N4 * N0 + N5], N7 - N6);
+
+                for(N5 = N7; N5-- > N6;) { // Back substitution.
+                    Ccv0[N5 - N6] = D_CC_C(Ccv0[N5 - N6], S_CC_C(Cu0[N5 * (N0 + 1)], Cu0[N4 * (N0 + 1)]));
+                    Ma_CvtCvCN_0(Ccv0, Cu0 + N5 * N0 + N6, vnegq_f64(Ccv0[N5 - N6]), N5 - N6);
+                }
+            }
+        }
+
+    for(N2 = 0; N2 < N0; ++N2) // Finiteness.
+        for(N3 = 0; N3 <= N2; ++N3)
+            if(!isfinite(vgetq_lane_f64(Cut0[N2 * N0 + N3], 0)) || !isfinite(vgetq_lane_f64(Cut0[N2 * N0 + N3], 1))) return STS_FAILED;
+
+    return STS_CONVERGED;
+}
+
+/**
+ * @brief Similarity [Sim], Q F Q^H.
+ * 
+ * @param Cq0 Complex Square Matrix [Cq], Schur vectors.
+ * @param Cqt0 Complex Square Matrix [Cq], Target [t], upper triangular on entry.
+ * @param N0 Rows and Columns [N].
+ */
+void Sim_CqCqtN_0(const Complex* Cq0, Complex* Cqt0, const Natural N0) {
+    Complex* Cq1 = (Complex*) Calc_NN_P(N0 * N0, sizeof(Complex)); // Q F.
+    register Natural N1, N2;
+
+    for(N1 = 0; N1 < N0; ++N1)
+        for(N2 = 0; N2 <= N1; ++N2)
+            Ma_CvtCvCN_0(Cq1 + N1 * N0, Cq0 + N2 * N0, Cqt0[N1 * N0 + N2], N0);
+
+    for(N1 = 0; N1 < N0; ++N1) { // (Q F) Q^H.
+        for(N2 = 0; N2 < N0; ++N2)
+            Cqt0[N1 * N0 + N2] = C_R_C(0.0);
+
+        for(N2 = 0; N2 < N0; ++N2)
+            Ma_CvtCvCN_0(Cqt0 + N1 * N0, Cq1 + N2 * N0, Cj_C_C(Cq0[N2 * N0 + N1]), N0);
+    }
+
+    Fr_P_0(Cq1);
+}
@@ -0,0 +1,158 @@
+/**
+ * @file NAQRA_Generic.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief include/Generic.h implementation.
+ * @date 2024-12-20
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <math.h>
+#include "../include/Generic.h"
+
+// Real numbers, double precision, pairs.
+
+#define GNR_T Real
+#define GNR_U Real
+#define GNR_W Real2
+#define GNR_K 2
+#define GNR_L R
+#define GNR_LR R
+
+#define GNR_LD(P) vld1q_f64(P)
+#define GNR_ST(P, W) vst1q_f64((P), (W))
+#define GNR_BC(X) vdupq_n_f64(X)
+#define GNR_Z vdupq_n_f64(0.0)
+#define GNR_AD(W, V) vaddq_f64((W), (V))
+#define GNR_MLB(W, V) vmulq_f64((W), (V))
+#define GNR_FMB(A, W, V) vfmaq_f64((A), (W), (V))
+#define GNR_FMJ(A, W, V) vfmaq_f64((A), (W), (V))
+#define GNR_SQ(A, W) vfmaq_f64((A), (W), (W))
+#define GNR_SM(W) vaddvq_f64(W)
+#define GNR_RSM(W) vaddvq_f64(W)
+
+#define GNR_ZERO 0.0
+#define GNR_ADD(X, Y) ((X) + (Y))
+#define GNR_SUB(X, Y) ((X) - (Y))
+#define GNR_NEG(X) (-(X))
+#define GNR_MUL(X, Y) ((X) * (Y))
+#define GNR_MLJ(X, Y) ((X) * (Y))
+#define GNR_CJM(X, Y) ((X) * (Y))
+#define GNR_CJ(X) (X)
+#define GNR_SCL(X, Y) ((X) * (Y))
+#define GNR_SQA(X) ((X) * (X))
+#define GNR_PHS(X) ((X) < 0.0 ? -1.0 : 1.0)
+#define GNR_SQRT(X) sqrt(X)
+
+#include "./Kernels.h"
+
+// Real numbers, single precision, quadruples.
+
+#define GNR_T Reals
+#define GNR_U Reals
+#define GNR_W Reals4
+#define GNR_K 4
+#define GNR_L Rs
+#define GNR_LR Rs
+
+#define GNR_LD(P) vld1q_f32(P)
+#define GNR_ST(P, W) vst1q_f32((P), (W))
+#define GNR_BC(X) vdupq_n_f32(X)
+#define GNR_Z vdupq_n_f32(0.0f)
+#define GNR_AD(W, V) vaddq_f32((W), (V))
+#define GNR_MLB(W, V) vmulq_f32((W), (V))
+#define GNR_FMB(A, W, V) vfmaq_f32((A), (W), (V))
+#define GNR_FMJ(A, W, V) vfmaq_f32((A), (W), (V))
+#define GNR_SQ(A, W) vfmaq_f32((A), (W), (W))
+#define GNR_SM(W) vaddvq_f32(W)
+#define GNR_RSM(W) vaddvq_f32(W)
+
+#define GNR_ZERO 0.0f
+#define GNR_ADD(X, Y) ((X) + (Y))
+#define GNR_SUB(X, Y) ((X) - (Y))
+#define GNR_NEG(X) (-(X))
+#define GNR_MUL(X, Y) ((X) * (Y))
+#define GNR_MLJ(X, Y) ((X) * (Y))
+#define GNR_CJM(X, Y) ((X) * (Y))
+#define GNR_CJ(X) (X)
+#define GNR_SCL(X, Y) ((X) * (Reals) (Y))
+#define GNR_SQA(X) ((X) * (X))
+#define GNR_PHS(X) ((X) < 0.0f ? -1.0f : 1.0f)
+#define GNR_SQRT(X) sqrtf(X)
+
+#include "./Kernels.h"
+
+// Complex numbers, double precision, units.
+
+#define GNR_T Complex
+#define GNR_U Real
+#define GNR_W Complex
+#define GNR_K 1
+#define GNR_L C
+#define GNR_LR R
+
+#define GNR_LD(P) (*(P))
+#define GNR_ST(P, W) (*(P) = (W))
+#define GNR_BC(X) (X)
+#define GNR_Z vdupq_n_f64(0.0)
+#define GNR_AD(W, V) A_CC_C((W), (V))
+#define GNR_MLB(W, V) M_CC_C((W), (V))
+#define GNR_FMB(A, W, V) A_CC_C((A), M_CC_C((W), (V)))
+#define GNR_FMJ(A, W, V) A_CC_C((A), M_CCcj_C((W), (V)))
+#define GNR_SQ(A, W) vfmaq_f64((A), (W), (W))
+#define GNR_SM(W) (W)
+#define GNR_RSM(W) vaddvq_f64(W)
+
+#define GNR_ZERO vdupq_n_f64(0.0)
+#define GNR_ADD(X, Y) A_CC_C((X), (Y))
+#define GNR_SUB(X, Y) S_CC_C((X), (Y))
+#define GNR_NEG(X) vnegq_f64(X)
+#define GNR_MUL(X, Y) M_CC_C((X), (Y))
+#define GNR_MLJ(X, Y) M_CCcj_C((X), (Y))
+#define GNR_CJM(X, Y) M_CcjC_C((X), (Y))
+#define GNR_CJ(X) Cj_C_C(X)
+#define GNR_SCL(X, Y) M_CR_C((X), (Y))
+#define GNR_SQA(X) vaddvq_f64(vmulq_f64((X), (X)))
+#define GNR_PHS(X) (N2_C_R(X) > 0.0 ? Nzd2_C_C(X) : C_R_C(1.0))
+#define GNR_SQRT(X) sqrt(X)
+
+#include "./Kernels.h"
+
+// Complex numbers, single precision, pairs.
+
+#define GNR_T Complexs
+#define GNR_U Reals
+#define GNR_W Complexs2
+#define GNR_K 2
+#define GNR_L Cs
+#define GNR_LR Rs
+
+#define GNR_LD(P) Ld_Csv_Cs2(P)
+#define GNR_ST(P, W) St_CsvtCs2_0((P), (W))
+#define GNR_BC(X) Dp_Cs_Cs2(X)
+#define GNR_Z vdupq_n_f32(0.0f)
+#define GNR_AD(W, V) vaddq_f32((W), (V))
+#define GNR_MLB(W, V) M_Cs2Cs2_Cs2((W), (V))
+#define GNR_FMB(A, W, V) vaddq_f32((A), M_Cs2Cs2_Cs2((W), (V)))
+#define GNR_FMJ(A, W, V) vaddq_f32((A), M_Cs2Cs2cj_Cs2((W), (V)))
+#define GNR_SQ(A, W) vfmaq_f32((A), (W), (W))
+#define GNR_SM(W) Sm_Cs2_Cs(W)
+#define GNR_RSM(W) vaddvq_f32(W)
+
+// Scalars through the pair kernels, as in NAQRA_Single.c.
+
+#define GNR_ZERO vdup_n_f32(0.0f)
+#define GNR_ADD(X, Y) vadd_f32((X), (Y))
+#define GNR_SUB(X, Y) vsub_f32((X), (Y))
+#define GNR_NEG(X) vneg_f32(X)
+#define GNR_MUL(X, Y) vget_low_f32(M_Cs2Cs2_Cs2(Dp_Cs_Cs2(X), Dp_Cs_Cs2(Y)))
+#define GNR_MLJ(X, Y) vget_low_f32(M_Cs2Cs2cj_Cs2(Dp_Cs_Cs2(X), Dp_Cs_Cs2(Y)))
+#define GNR_CJM(X, Y) vget_low_f32(M_Cs2cjCs2_Cs2(Dp_Cs_Cs2(X), Dp_Cs_Cs2(Y)))
+#define GNR_CJ(X) vget_low_f32(Cj_Cs2_Cs2(Dp_Cs_Cs2(X)))
+#define GNR_SCL(X, Y) vmul_f32((X), vdup_n_f32((Reals) (Y)))
+#define GNR_SQA(X) vget_lane_f32(vpadd_f32(vmul_f32((X), (X)), vmul_f32((X), (X))), 0)
+#define GNR_PHS(X) Dm_C_Cs(N2_C_R(Pm_Cs_C(X)) > 0.0 ? Nzd2_C_C(Pm_Cs_C(X)) : C_R_C(1.0))
+#define GNR_SQRT(X) sqrtf(X)
+
+#include "./Kernels.h"
@@ -0,0 +1,1116 @@
+/**
+ * @file NAQRA_Hermitian.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief include/Hermitian.h implementation.
+ * @date 2024-12-09
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <stdlib.h>
+#include "../include/Hermitian.h"
+
+// Householder reflections.
+
+/**
+ * @brief Householder vector [Hsv], stable direction.
+ * 
+ * @param Cvt0 Complex Vector [Cv], Target [t], normalized.
+ * @param Cv0 Complex Vector [Cv], column to reflect.
+ * @param R0 Real Number [R], column's norm, positive.
+ * @param N0 Entries [N].
+ * @return Complex Complex Number [C], leading entry of the reflected column.
+ */
+static inline Complex Hsv_CvtCvRN_C(Complex* Cvt0, const Complex* Cv0, const Real R0, const Natural N0) {
+    const register Complex C0 = N2_C_R(Cv0[0]) > TOL1 ? Nzd2_C_C(Cv0[0]) : C_R_C(1.0); // Phase.
+
+    Cp_CvtCvN_0(Cvt0, Cv0, N0);
+    Cvt0[0] = A_CC_C(Cvt0[0], M_CR_C(C0, R0));
+    Nz2_CvN_0(Cvt0, N0);
+
+    return M_CR_C(C0, -R0);
+}
+
+/**
+ * @brief Hermitian Householder product [Hsh], two-sided, lower triangle.
+ * 
+ * Columns start on the diagonal, column j + 1 being N1 - N2 * j entries after
+ * column j.
+ * 
+ * @param Cmt0 Complex Matrix [Cm], Target [t], lower triangle.
+ * @param Cv0 Complex Vector [Cv], Householder vector.
+ * @param Cvt1 Complex Vector [Cv], Target [t], workspace.
+ * @param N0 Entries [N].
+ * @param N1 Stride [N].
+ * @param N2 Stride decrement [N].
+ */
+static void Hsh_CmtCvCvtNNN_0(Complex* Cmt0, const Complex* Cv0, Complex* Cvt1, const Natural N0, const Natural N1, const Natural N2) {
+    register Natural N3;
+    register Complex* Ccv0;
+
+    // Trailing product, Cvt1 = A Cv0.
+
+    for(N3 = 0; N3 < N0; ++N3)
+        Cvt1[N3] = C_R_C(0.0);
+
+    for(N3 = 0, Ccv0 = Cmt0; N3 < N0; Ccv0 += N1 - N2 * N3, ++N3) {
+        Cvt1[N3] = A_CC_C(Cvt1[N3], A_CC_C(M_CR_C(Cv0[N3], vgetq_lane_f64(Ccv0[0], 0)), Dot_CrvCcvN_C(Cv0 + N3 + 1, Ccv0 + 1, N0 - N3 - 1)));
+        Ma_CvtCvCN_0(Cvt1 + N3 + 1, Ccv0 + 1, Cv0[N3], N0 - N3 - 1);
+    }
+
+    // Cvt1 = A Cv0 - (Cv0^H A Cv0) Cv0.
+
+    Ma_CvtCvCN_0(Cvt1, Cv0, C_R_C(-vgetq_lane_f64(Dot_CrvCcvN_C(Cvt1, Cv0, N0), 0)), N0);
+
+    // Rank-2 update, A = A - 2 (Cv0 Cvt1^H + Cvt1 Cv0^H).
+
+    for(N3 = 0, Ccv0 = Cmt0; N3 < N0; Ccv0 += N1 - N2 * N3, ++N3) {
+        Ma_CvtCvCN_0(Ccv0, Cv0 + N3, M_CR_C(Cj_C_C(Cvt1[N3]), -2.0), N0 - N3);
+        Ma_CvtCvCN_0(Ccv0, Cvt1 + N3, M_CR_C(Cj_C_C(Cv0[N3]), -2.0), N0 - N3);
+    }
+}
+
+// Tridiagonal form.
+
+/**
+ * @brief Tridiagonal form [Trd].
+ * 
+ * @param Chpt0 Complex Hermitian Packed Matrix [Chp], Target [t], overwritten.
+ * @param Rvt0 Real Vector [Rv], Target [t], diagonal.
+ * @param Rvt1 Real Vector [Rv], Target [t], off-diagonal.
+ * @param N0 Rows and Columns [N].
+ */
+void Trd_ChptRvtRvtN_0(Complex* Chpt0, Real* Rvt0, Real* Rvt1, const Natural N0) {
+    register Complex* Cv0 = (Complex*) Alc_NN_P(N0, sizeof(Complex)); // Householder vector.
+    register Complex* Cv1 = (Complex*) Alc_NN_P(N0, sizeof(Complex)); // Product.
+
+    register Natural N1 = 0;
+    register Real R0;
+
+    for(; N1 + 1 < N0; ++N1) {
+        const register Natural N2 = N0 - N1 - 1; // Entries.
+        Complex* Cv2 = Chpt0 + Pk_NNN_N(N1 + 1, N1, N0); // Column below the diagonal.
+
+        Rvt0[N1] = vgetq_lane_f64(Chpt0[Pk_NNN_N(N1, N1, N0)], 0);
+        Rvt1[N1] = R0 = N2_CvN_R(Cv2, N2); // The reflection only changes the phase.
+
+        if(N2 < 2 || R0 <= TOL1) continue;
+
+        Hsv_CvtCvRN_C(Cv0, Cv2, R0, N2);
+        Hsh_CmtCvCvtNNN_0(Chpt0 + Pk_NNN_N(N1 + 1, N1 + 1, N0), Cv0, Cv1, N2, N2, 1);
+    }
+
+    if(N0 > 0) {
+        Rvt0[N0 - 1] = vgetq_lane_f64(Chpt0[Pk_NNN_N(N0 - 1, N0 - 1, N0)], 0);
+        Rvt1[N0 - 1] = 0.0;
+    }
+
+    Fr_P_0(Cv0);
+    Fr_P_0(Cv1);
+}
+
+// Two-stage tridiagonal form.
+
+/**
+ * @brief Band form [Bnd], blocked.
+ * 
+ * Each panel of N1 columns is reduced by N1 reflectors, whose compact
+ * representation Q = I - V T V^H updates the trailing matrix as
+ * A = A - W V^H - V W^H, W = A V T - V (T^H V^H A V T) / 2.
+ * 
+ * @param Chpt0 Complex Hermitian Packed Matrix [Chp], overwritten.
+ * @param Chbt0 Complex Hermitian Band Matrix [Chb], Target [t].
+ * @param N0 Rows and Columns [N].
+ * @param N1 Bandwidth [N], positive.
+ */
+void Bnd_ChptChbtNN_0(Complex* Chpt0, Complex* Chbt0, const Natural N0, const Natural N1) {
+    register Complex* Cm0 = (Complex*) Alc_NN_P(N0 * N1, sizeof(Complex)); // Householder vectors, V.
+    register Complex* Cm1 = (Complex*) Alc_NN_P(N0 * N1, sizeof(Complex)); // Products, A V, A V T and W.
+    register Complex* Cq0 = (Complex*) Alc_NN_P(N1 * N1, sizeof(Complex)); // T.
+    register Complex* Cq1 = (Complex*) Alc_NN_P(N1 * N1, sizeof(Complex)); // V^H A V T and T^H V^H A V T.
+
+    register Natural N2 = 0, N3, N4, N5, N6, N7;
+    register Real R0;
+
+    for(; N2 + N1 + 1 < N0; N2 += N1) {
+        const register Natural N8 = N0 - N2 - N1; // Trailing rows and columns.
+        const register Natural N9 = N1 < N8 - 1 ? N1 : N8 - 1; // Reflectors.
+
+        // Panel.
+
+        for(N3 = 0; N3 < N9; ++N3) {
+            Complex* Cv0 = Cm0 + N3 * N8;
+            Complex* Ccv0 = Chpt0 + Pk_NNN_N(N2 + N1 + N3, N2 + N3, N0);
+
+            for(N4 = 0; N4 < N8; ++N4)
+                Cv0[N4] = C_R_C(0.0);
+
+            if((R0 = N2_CvN_R(Ccv0, N8 - N3)) > TOL1) {
+                Ccv0[0] = Hsv_CvtCvRN_C(Cv0 + N3, Ccv0, R0, N8 - N3);
+
+                for(N4 = 1; N4 < N8 - N3; ++N4)
+                    Ccv0[N4] = C_R_C(0.0);
+
+                for(N4 = N3 + 1; N4 < N1; ++N4) { // Remaining columns.
+                    Complex* Ccv1 = Chpt0 + Pk_NNN_N(N2 + N1 + N3, N2 + N4, N0);
+                    Ma_CvtCvCN_0(Ccv1, Cv0 + N3, M_CR_C(Dot_CrvCcvN_C(Ccv1, Cv0 + N3, N8 - N3), -2.0), N8 - N3);
+                }
+            }
+
+            // T, column N3.
+
+            for(N4 = 0; N4 < N3; ++N4)
+                Cq1[N4] = Dot_CrvCcvN_C(Cv0 + N3, Cm0 + N4 * N8 + N3, N8 - N3);
+
+            for(N4 = 0; N4 < N3; ++N4) {
+                register Complex C0 = C_R_C(0.0);
+
+                for(N5 = N4; N5 < N3; ++N5)
+                    C0 = A_CC_C(C0, M_CC_C(Cq0[N5 * N1 + N4], Cq1[N5]));
+
+                Cq0[N3 * N1 + N4] = M_CR_C(C0, -2.0);
+            }
+
+            Cq0[N3 * N1 + N3] = C_R_C(2.0);
+        }
+
+        // A V, trailing columns loaded once for all the reflectors.
+
+        for(N3 = 0; N3 < N8 * N9; ++N3)
+            Cm1[N3] = C_R_C(0.0);
+
+        for(N3 = 0; N3 < N8; ++N3) {
+            Complex* Ccv0 = Chpt0 + Pk_NNN_N(N2 + N1 + N3, N2 + N1 + N3, N0);
+
+            for(N4 = 0; N4 < N9; ++N4) {
+                Complex* Cv0 = Cm0 + N4 * N8;
+                Complex* Cv1 = Cm1 + N4 * N8;
+
+                Cv1[N3] = A_CC_C(Cv1[N3], A_CC_C(M_CR_C(Cv0[N3], vgetq_lane_f64(Ccv0[0], 0)), Dot_CrvCcvN_C(Cv0 + N3 + 1, Ccv0 + 1, N8 - N3 - 1)));
+                Ma_CvtCvCN_0(Cv1 + N3 + 1, Ccv0 + 1, Cv0[N3], N8 - N3 - 1);
+            }
+        }
+
+        // A V T, in place.
+
+        for(N3 = N9; N3-- > 0;) {
+            M_CvR_0(Cm1 + N3 * N8, 2.0, N8);
+
+            for(N4 = 0; N4 < N3; ++N4)
+                Ma_CvtCvCN_0(Cm1 + N3 * N8, Cm1 + N4 * N8, Cq0[N3 * N1 + N4], N8);
+        }
+
+        // T^H V^H A V T, in place.
+
+        for(N3 = 0; N3 < N9; ++N3)
+            for(N4 = 0; N4 < N9; ++N4)
+                Cq1[N4 * N1 + N3] = Dot_CrvCcvN_C(Cm1 + N4 * N8, Cm0 + N3 * N8, N8);
+
+        for(N4 = 0; N4 < N9; ++N4)
+            for(N3 = N9; N3-- > 0;) {
+                register Complex C0 = C_R_C(0.0);
+
+                for(N5 = 0; N5 <= N3; ++N5)
+                    C0 = A_CC_C(C0, M_CC_C(Cj_C_C(Cq0[N3 * N1 + N5]), Cq1[N4 * N1 + N5]));
+
+                Cq1[N4 * N1 + N3] = C0;
+            }
+
+        // W.
+
+        for(N3 = 0; N3 < N9; ++N3)
+            for(N4 = 0; N4 < N9; ++N4)
+                Ma_CvtCvCN_0(Cm1 + N3 * N8, Cm0 + N4 * N8, M_CR_C(Cq1[N3 * N1 + N4], -0.5), N8);
+
+        // Rank-2N9 update, each trailing column loaded once.
+
+        for(N3 = 0; N3 < N8; ++N3) {
+            Complex* Ccv0 = Chpt0 + Pk_NNN_N(N2 + N1 + N3, N2 + N1 + N3, N0);
+
+            for(N4 = 0; N4 < N9; ++N4) {
+                Ma_CvtCvCN_0(Ccv0, Cm1 + N4 * N8 + N3, M_CR_C(Cj_C_C(Cm0[N4 * N8 + N3]), -1.0), N8 - N3);
+                Ma_CvtCvCN_0(Ccv0, Cm0 + N4 * N8 + N3, M_CR_C(Cj_C_C(Cm1[N4 * N8 + N3]), -1.0), N8 - N3);
+            }
+        }
+    }
+
+    // Band.
+
+    for(N6 = 0; N6 < N0; ++N6)
+        for(N7 = 0; N7 < 2 * N1; ++N7)
+            Chbt0[Bd_NNN_N(N6 + N7, N6, N1)] = N7 <= N1 && N6 + N7 < N0 ? Chpt0[Pk_NNN_N(N6 + N7, N6, N0)] : C_R_C(0.0);
+
+    Fr_P_0(Cm0);
+    Fr_P_0(Cm1);
+    Fr_P_0(Cq0);
+    Fr_P_0(Cq1);
+}
+
+/**
+ * @brief Bulge chasing [Chs], one task.
+ * 
+ * Task 0 of sweep s reduces column s to its first subdiagonal entry. Task t
+ * applies the previous reflector to the block below, whose first column it
+ * then reduces, chasing the bulge N1 rows further. Tasks of sweep s + 1 only
+ * overlap tasks of sweep s up to three positions ahead.
+ * 
+ * @param Chbt0 Complex Hermitian Band Matrix [Chb], Target [t].
+ * @param Cvt0 Complex Vector [Cv], Target [t], 2 * N1 entries, kept along the sweep.
+ * @param N0 Rows and Columns [N].
+ * @param N1 Bandwidth [N].
+ * @param N2 Sweep [N].
+ * @param N3 Task [N].
+ * @return Natural 1 if the sweep goes on, 0 otherwise [N].
+ */
+Natural Chs_ChbtCvtNNNN_N(Complex* Chbt0, Complex* Cvt0, const Natural N0, const Natural N1, const Natural N2, const Natural N3) {
+    const register Natural N4 = N2 + 1 + (N3 > 0 ? (N3 - 1) * N1 : 0); // Previous block's first row.
+    const register Natural N5 = N3 > 0 ? N4 + N1 : N4; // Block's first row.
+
+    if(N5 >= N0) return 0;
+
+    const register Natural N6 = N0 - N4 < N1 ? N0 - N4 : N1; // Previous block's rows.
+    const register Natural N7 = N0 - N5 < N1 ? N0 - N5 : N1; // Block's rows.
+    register Natural N8;
+    register Real R0;
+
+    Complex* Ccv0; // Column to reduce.
+
+    if(N3 > 0) {
+        Complex* Cm0 = Chbt0 + Bd_NNN_N(N5, N4, N1); // Block below, column stride 2 * N1 - 1.
+
+        // Previous reflector, right.
+
+        for(N8 = 0; N8 < N7; ++N8)
+            Cvt0[N1 + N8] = C_R_C(0.0);
+
+        for(N8 = 0; N8 < N6; ++N8)
+            Ma_CvtCvCN_0(Cvt0 + N1, Cm0 + N8 * (2 * N1 - 1), Cvt0[N8], N7);
+
+        for(N8 = 0; N8 < N6; ++N8)
+            Ma_CvtCvCN_0(Cm0 + N8 * (2 * N1 - 1), Cvt0 + N1, M_CR_C(Cj_C_C(Cvt0[N8]), -2.0), N7);
+
+        Ccv0 = Cm0;
+    } else
+        Ccv0 = Chbt0 + Bd_NNN_N(N5, N2, N1);
+
+    if(N7 < 2 || (R0 = N2_CvN_R(Ccv0, N7)) <= TOL1) return 0;
+
+    // Reflector.
+
+    Ccv0[0] = Hsv_CvtCvRN_C(Cvt0, Ccv0, R0, N7);
+
+    for(N8 = 1; N8 < N7; ++N8)
+        Ccv0[N8] = C_R_C(0.0);
+
+    if(N3 > 0) // Left, block's remaining columns.
+        for(N8 = 1; N8 < N6; ++N8) {
+            Complex* Ccv1 = Ccv0 + N8 * (2 * N1 - 1);
+            Ma_CvtCvCN_0(Ccv1, Cvt0, M_CR_C(Dot_CrvCcvN_C(Ccv1, Cvt0, N7), -2.0), N7);
+        }
+
+    // Two-sided, diagonal block.
+
+    Hsh_CmtCvCvtNNN_0(Chbt0 + Bd_NNN_N(N5, N5, N1), Cvt0, Cvt0 + N1, N7, 2 * N1, 0);
+
+    return 1;
+}
+
+/**
+ * @brief Diagonals [Dgs], tridiagonal band.
+ * 
+ * @param Chb0 Complex Hermitian Band Matrix [Chb], tridiagonal.
+ * @param Rvt0 Real Vector [Rv], Target [t], diagonal.
+ * @param Rvt1 Real Vector [Rv], Target [t], off-diagonal, moduli.
+ * @param N0 Rows and Columns [N].
+ * @param N1 Bandwidth [N].
+ */
+void Dgs_ChbRvtRvtNN_0(const Complex* Chb0, Real* Rvt0, Real* Rvt1, const Natural N0, const Natural N1) {
+    for(register Natural N2 = 0; N2 < N0; ++N2) {
+        Rvt0[N2] = vgetq_lane_f64(Chb0[Bd_NNN_N(N2, N2, N1)], 0);
+        Rvt1[N2] = N2 + 1 < N0 ? N2_C_R(Chb0[Bd_NNN_N(N2 + 1, N2, N1)]) : 0.0; // A diagonal similarity clears the phases.
+    }
+}
+
+/**
+ * @brief Tridiagonal form [Trd], band.
+ * 
+ * @param Chbt0 Complex Hermitian Band Matrix [Chb], Target [t], overwritten.
+ * @param Rvt0 Real Vector [Rv], Target [t], diagonal.
+ * @param Rvt1 Real Vector [Rv], Target [t], off-diagonal.
+ * @param N0 Rows and Columns [N].
+ * @param N1 Bandwidth [N].
+ */
+void Trd_ChbtRvtRvtNN_0(Complex* Chbt0, Real* Rvt0, Real* Rvt1, const Natural N0, const Natural N1) {
+    register Complex* Cv0 = (Complex*) Alc_NN_P(2 * N1, sizeof(Complex));
+
+    for(register Natural N2 = 0; N2 + 2 < N0; ++N2)
+        for(register Natural N3 = 0; Chs_ChbtCvtNNNN_N(Chbt0, Cv0, N0, N1, N2, N3); ++N3);
+
+    Dgs_ChbRvtRvtNN_0(Chbt0, Rvt0, Rvt1, N0, N1);
+    Fr_P_0(Cv0);
+}
+
+// Tridiagonal eigenvalues.
+
+/**
+ * @brief Ascending order.
+ * 
+ * @param P0 Real Number.
+ * @param P1 Real Number.
+ * @return int Comparison.
+ */
+static int Cmp_PP_I(const void* P0, const void* P1) {
+    const register Real R0 = *(const Real*) P0, R1 = *(const Real*) P1;
+    return (R0 > R1) - (R0 < R1);
+}
+
+/**
+ * @brief Implicit QL with Wilkinson's shift [Ql].
+ * 
+ * @param Rvt0 Real Vector [Rv], Target [t], diagonal, unordered eigenvalues on exit.
+ * @param Rvt1 Real Vector [Rv], Target [t], off-diagonal, destroyed.
+ * @param Cmt0 Complex Matrix [Cm], Target [t], columns rotated alongside, NULL for none.
+ * @param N0 Rows and Columns [N].
+ */
+static void Ql_RvtRvtCmtN_0(Real* Rvt0, Real* Rvt1, Complex* Cmt0, const Natural N0) {
+    register Natural N1 = 0, N2, N3 = 0, N4;
+    register Integer I0;
+    register Real R0, R1, R2, R3, R4, R5, R6;
+
+    if(N0 == 0) return;
+    Rvt1[N0 - 1] = 0.0;
+
+    for(; N1 < N0; ++N1)
+        for(;;) {
+            for(N2 = N1; N2 + 1 < N0; ++N2) // Deflation.
+                if(fabs(Rvt1[N2]) <= TOL0 * (fabs(Rvt0[N2]) + fabs(Rvt0[N2 + 1]))) break;
+
+            if(N2 == N1 || N3++ >= ITM0) break;
+
+            // Wilkinson's shift.
+            R0 = (Rvt0[N1 + 1] - Rvt0[N1]) / (2.0 * Rvt1[N1]);
+            R1 = hypot(R0, 1.0);
+            R0 = Rvt0[N2] - Rvt0[N1] + Rvt1[N1] / (R0 + copysign(R1, R0));
+
+            R2 = 1.0; R3 = 1.0; R4 = 0.0; // Sine, cosine, correction.
+
+            for(I0 = (Integer) N2 - 1; I0 >= (Integer) N1; --I0) { // Chasing.
+                R5 = R2 * Rvt1[I0];
+                R6 = R3 * Rvt1[I0];
+
+                Rvt1[I0 + 1] = R1 = hypot(R5, R0);
+
+                if(R1 == 0.0) { // Early split.
+                    Rvt0[I0 + 1] -= R4;
+                    Rvt1[N2] = 0.0;
+                    break;
+                }
+
+                R2 = R5 / R1;
+                R3 = R0 / R1;
+
+                if(Cmt0 != NULL) // Vectors.
+                    for(N4 = 0; N4 < N0; ++N4) {
+                        const register Complex C0 = Cmt0[N0 * (Natural) I0 + N4], C1 = Cmt0[N0 * ((Natural) I0 + 1) + N4];
+
+                        Cmt0[N0 * ((Natural) I0 + 1) + N4] = A_CC_C(M_CR_C(C0, R2), M_CR_C(C1, R3));
+                        Cmt0[N0 * (Natural) I0 + N4] = S_CC_C(M_CR_C(C0, R3), M_CR_C(C1, R2));
+                    }
+
+                R0 = Rvt0[I0 + 1] - R4;
+                R1 = (Rvt0[I0] - R0) * R2 + 2.0 * R3 * R6;
+                R4 = R2 * R1;
+                Rvt0[I0 + 1] = R0 + R4;
+                R0 = R3 * R1 - R6;
+            }
+
+            if(R1 == 0.0 && I0 >= (Integer) N1) continue;
+
+            Rvt0[N1] -= R4;
+            Rvt1[N1] = R0;
+            Rvt1[N2] = 0.0;
+        }
+}
+
+/**
+ * @brief Eigenvalues [Eig], implicit QL with Wilkinson's shift.
+ * 
+ * @param Rvt0 Real Vector [Rv], Target [t], diagonal, ascending eigenvalues on exit.
+ * @param Rvt1 Real Vector [Rv], Target [t], off-diagonal, destroyed.
+ * @param N0 Rows and Columns [N].
+ */
+void Eig_RvtRvtN_0(Real* Rvt0, Real* Rvt1, const Natural N0) {
+    Ql_RvtRvtCmtN_0(Rvt0, Rvt1, NULL, N0);
+    qsort(Rvt0, N0, sizeof(Real), Cmp_PP_I);
+}
+
+// Subset eigenvalues.
+
+// Subset problem.
+typedef struct {
+
+    // Diagonal.
+    const Real* Rv0;
+
+    // Off-diagonal.
+    const Real* Rv1;
+
+    // Eigenvalues, from the first index.
+    Real* Rvt0;
+
+    // Workspace.
+    Real* Rvt1;
+    Real* Rvt2;
+
+    // Rows and Columns.
+    Natural N0;
+
+    // Indices, last excluded.
+    Natural N1, N2;
+
+    // Minimum pivot.
+    Real R0;
+
+} Subset;
+
+/**
+ * @brief Minimum pivot [Pvt].
+ * 
+ * @param Rv0 Real Vector [Rv], off-diagonal.
+ * @param N0 Rows and Columns [N].
+ * @return Real Real Number [R].
+ */
+static inline Real Pvt_RvN_R(const Real* Rv0, const Natural N0) {
+    register Real R0 = 1.0;
+
+    for(register Natural N1 = 0; N1 + 1 < N0; ++N1)
+        if(Rv0[N1] * Rv0[N1] > R0) R0 = Rv0[N1] * Rv0[N1];
+
+    return TOL1 * R0;
+}
+
+/**
+ * @brief Sturm count [Stc], guarded pivots.
+ * 
+ * @param Rv0 Real Vector [Rv], diagonal.
+ * @param Rv1 Real Vector [Rv], off-diagonal.
+ * @param R0 Real Number [R], shift.
+ * @param R1 Real Number [R], minimum pivot.
+ * @param N0 Rows and Columns [N].
+ * @return Natural Eigenvalues below the shift [N].
+ */
+static inline Natural Stc_RvRvRRN_N(const Real* Rv0, const Real* Rv1, const Real R0, const Real R1, const Natural N0) {
+    register Natural N1 = 0, N2 = 0;
+    register Real R2 = 1.0;
+
+    for(; N1 < N0; ++N1) {
+        R2 = Rv0[N1] - R0 - (N1 > 0 ? Rv1[N1 - 1] * Rv1[N1 - 1] / R2 : 0.0);
+        if(fabs(R2) < R1) R2 = -R1;
+        N2 += R2 < 0.0;
+    }
+
+    return N2;
+}
+
+/**
+ * @brief Sturm count [Stc].
+ * 
+ * @param Rv0 Real Vector [Rv], diagonal.
+ * @param Rv1 Real Vector [Rv], off-diagonal.
+ * @param R0 Real Number [R], shift.
+ * @param N0 Rows and Columns [N].
+ * @return Natural Eigenvalues below the shift [N].
+ */
+Natural Stc_RvRvRN_N(const Real* Rv0, const Real* Rv1, const Real R0, const Natural N0) {
+    return Stc_RvRvRRN_N(Rv0, Rv1, R0, Pvt_RvN_R(Rv1, N0), N0);
+}
+
+/**
+ * @brief Gershgorin bounds [Grs], tridiagonal.
+ * 
+ * @param Rv0 Real Vector [Rv], diagonal.
+ * @param Rv1 Real Vector [Rv], off-diagonal.
+ * @param Rvt0 Real Vector [Rv], Target [t], lower and upper bound.
+ * @param N0 Rows and Columns [N].
+ */
+void Grs_RvRvRvtN_0(const Real* Rv0, const Real* Rv1, Real* Rvt0, const Natural N0) {
+    register Natural N1 = 0;
+    register Real R0;
+
+    Rvt0[0] = HUGE_VAL;
+    Rvt0[1] = -HUGE_VAL;
+
+    for(; N1 < N0; ++N1) {
+        R0 = (N1 > 0 ? fabs(Rv1[N1 - 1]) : 0.0) + (N1 + 1 < N0 ? fabs(Rv1[N1]) : 0.0);
+
+        if(Rv0[N1] - R0 < Rvt0[0]) Rvt0[0] = Rv0[N1] - R0;
+        if(Rv0[N1] + R0 > Rvt0[1]) Rvt0[1] = Rv0[N1] + R0;
+    }
+
+    // Strict bounds.
+    R0 = TOL0 * (fabs(Rvt0[0]) > fabs(Rvt0[1]) ? fabs(Rvt0[0]) : fabs(Rvt0[1])) + TOL1;
+    Rvt0[0] -= R0;
+    Rvt0[1] += R0;
+}
+
+/**
+ * @brief Refinement [Rfn], MRRR-style.
+ * 
+ * Rayleigh quotient corrections from the twisted factorizations of T - sI,
+ * the signs of the forward pivots keeping the bracket.
+ * 
+ * @param Sb0 Subset.
+ * @param R0 Real Number [R], lower bound.
+ * @param R1 Real Number [R], upper bound.
+ * @param N0 Index [N], only eigenvalue in the bracket.
+ * @return Real Real Number [R], eigenvalue.
+ */
+static Real Rfn_SbRRN_R(const Subset* Sb0, Real R0, Real R1, const Natural N0) {
+    const Real* Rv0 = Sb0->Rv0;
+    const Real* Rv1 = Sb0->Rv1;
+    Real* Rv2 = Sb0->Rvt1; // Forward pivots.
+    Real* Rv3 = Sb0->Rvt2; // Backward pivots.
+
+    const register Natural N1 = Sb0->N0;
+    register Natural N2 = 0, N3, N4, N5;
+    register Real R2 = (R0 + R1) / 2.0, R3, R4, R5, R6;
+
+    for(; N2 < BSC0; ++N2) {
+        for(N3 = 0, N4 = 0; N3 < N1; ++N3) { // Forward, Sturm count.
+            Rv2[N3] = Rv0[N3] - R2 - (N3 > 0 ? Rv1[N3 - 1] * Rv1[N3 - 1] / Rv2[N3 - 1] : 0.0);
+            if(fabs(Rv2[N3]) < Sb0->R0) Rv2[N3] = -Sb0->R0;
+            N4 += Rv2[N3] < 0.0;
+        }
+
+        if(N4 > N0) R1 = R2; else R0 = R2; // Bracket.
+
+        for(N3 = N1; N3-- > 0;) { // Backward.
+            Rv3[N3] = Rv0[N3] - R2 - (N3 + 1 < N1 ? Rv1[N3] * Rv1[N3] / Rv3[N3 + 1] : 0.0);
+            if(fabs(Rv3[N3]) < Sb0->R0) Rv3[N3] = -Sb0->R0;
+        }
+
+        for(N3 = 0, N5 = 0, R3 = HUGE_VAL; N3 < N1; ++N3) { // Twist.
+            R4 = Rv2[N3] + Rv3[N3] - (Rv0[N3] - R2);
+            if(fabs(R4) < fabs(R3)) { R3 = R4; N5 = N3; }
+        }
+
+        for(N3 = N5, R4 = 1.0, R5 = 1.0; N3-- > 0;) { // Eigenvector's norm, upwards.
+            R5 *= -Rv1[N3] / Rv2[N3];
+            R4 += R5 * R5;
+        }
+
+        for(N3 = N5 + 1, R5 = 1.0; N3 < N1; ++N3) { // Downwards.
+            R5 *= -Rv1[N3 - 1] / Rv3[N3];
+            R4 += R5 * R5;
+        }
+
+        R6 = R3 / R4; // Correction.
+
+        if(fabs(R6) <= TOL0 * fabs(R2) + Sb0->R0) return R2 + R6;
+        if(R1 - R0 <= TOL0 * (fabs(R0) > fabs(R1) ? fabs(R0) : fabs(R1)) + Sb0->R0) break;
+
+        R2 = R2 + R6 > R0 && R2 + R6 < R1 ? R2 + R6 : (R0 + R1) / 2.0; // Bisection as a fallback.
+    }
+
+    return (R0 + R1) / 2.0;
+}
+
+/**
+ * @brief Bisection [Bsc].
+ * 
+ * @param Sb0 Subset.
+ * @param R0 Real Number [R], lower bound.
+ * @param R1 Real Number [R], upper bound.
+ * @param N0 Eigenvalues below the lower bound [N].
+ * @param N1 Eigenvalues below the upper bound [N].
+ */
+static void Bsc_SbRRNN_0(const Subset* Sb0, const Real R0, const Real R1, const Natural N0, const Natural N1) {
+    if(N0 == N1 || N1 <= Sb0->N1 || N0 >= Sb0->N2) return;
+
+    if(N1 - N0 == 1) { Sb0->Rvt0[N0 - Sb0->N1] = Rfn_SbRRN_R(Sb0, R0, R1, N0); return; }
+
+    const register Real R2 = (R0 + R1) / 2.0;
+
+    if(R1 - R0 <= TOL0 * (fabs(R0) > fabs(R1) ? fabs(R0) : fabs(R1)) + Sb0->R0) { // Cluster.
+        for(register Natural N2 = N0 > Sb0->N1 ? N0 : Sb0->N1; N2 < N1 && N2 < Sb0->N2; ++N2)
+            Sb0->Rvt0[N2 - Sb0->N1] = R2;
+
+        return;
+    }
+
+    const register Natural N2 = Stc_RvRvRRN_N(Sb0->Rv0, Sb0->Rv1, R2, Sb0->R0, Sb0->N0);
+
+    Bsc_SbRRNN_0(Sb0, R0, R2, N0, N2);
+    Bsc_SbRRNN_0(Sb0, R2, R1, N2, N1);
+}
+
+/**
+ * @brief Subset eigenvalues [Sbs], by index.
+ * 
+ * @param Rv0 Real Vector [Rv], diagonal.
+ * @param Rv1 Real Vector [Rv], off-diagonal.
+ * @param Rvt0 Real Vector [Rv], Target [t], N2 - N1 ascending eigenvalues.
+ * @param N0 Rows and Columns [N].
+ * @param N1 First index [N].
+ * @param N2 Last index, excluded [N].
+ */
+void Sbs_RvRvRvtNNN_0(const Real* Rv0, const Real* Rv1, Real* Rvt0, const Natural N0, const Natural N1, const Natural N2) {
+    if(N1 >= N2 || N2 > N0) return;
+
+    Real Rv2[2];
+    Grs_RvRvRvtN_0(Rv0, Rv1, Rv2, N0);
+
+    Subset Sb0 = {.Rv0 = Rv0, .Rv1 = Rv1, .Rvt0 = Rvt0, .N0 = N0, .N1 = N1, .N2 = N2, .R0 = Pvt_RvN_R(Rv1, N0)};
+    Sb0.Rvt1 = (Real*) Alc_NN_P(2 * N0, sizeof(Real));
+    Sb0.Rvt2 = Sb0.Rvt1 + N0;
+
+    Bsc_SbRRNN_0(&Sb0, Rv2[0], Rv2[1], 0, N0);
+
+    Fr_P_0(Sb0.Rvt1);
+}
+
+// Eigen-decomposition.
+
+/**
+ * @brief Eigen-decomposition [Dcm], A = Q diag(Rvt0) Q^H.
+ * 
+ * The reflectors are rebuilt from the reduced columns, which the tridiagonal
+ * form leaves in place, and the phases of the complex off-diagonal are folded
+ * into Q before the QL rotations.
+ * 
+ * @param Chpt0 Complex Hermitian Packed Matrix [Chp], Target [t], overwritten.
+ * @param Cmt0 Complex Matrix [Cm], Target [t], eigenvectors by column.
+ * @param Rvt0 Real Vector [Rv], Target [t], ascending eigenvalues.
+ * @param N0 Rows and Columns [N].
+ */
+void Dcm_ChptCmtRvtN_0(Complex* Chpt0, Complex* Cmt0, Real* Rvt0, const Natural N0) {
+    register Real* Rv1 = (Real*) Alc_NN_P(N0, sizeof(Real)); // Off-diagonal.
+    register Complex* Cv0 = (Complex*) Alc_NN_P(N0, sizeof(Complex)); // Householder vector.
+
+    register Complex C0 = C_R_C(1.0), C1; // Phases.
+    register Natural N1, N2, N3;
+    register Integer I0;
+    register Real R0;
+
+    Trd_ChptRvtRvtN_0(Chpt0, Rvt0, Rv1, N0);
+
+    for(N1 = 0; N1 < N0 * N0; ++N1)
+        Cmt0[N1] = C_R_C(0.0);
+
+    for(N1 = 0; N1 < N0; ++N1)
+        Cmt0[N0 * N1 + N1] = C_R_C(1.0);
+
+    // Q = H_0 H_1 ... H_{N0 - 3}, backward accumulation.
+    for(I0 = (Integer) N0 - 3; I0 >= 0; --I0) {
+        N1 = (Natural) I0;
+        N2 = N0 - N1 - 1; // Entries.
+
+        if(Rv1[N1] <= TOL1) continue;
+        Hsv_CvtCvRN_C(Cv0, Chpt0 + Pk_NNN_N(N1 + 1, N1, N0), Rv1[N1], N2);
+
+        for(N3 = N1 + 1; N3 < N0; ++N3)
+            Ma_CvtCvCN_0(Cmt0 + N0 * N3 + N1 + 1, Cv0, M_CR_C(Dot_CrvCcvN_C(Cmt0 + N0 * N3 + N1 + 1, Cv0, N2), -2.0), N2);
+    }
+
+    // Phases, Q^H A Q = D T D^H for the real T.
+    for(N1 = 0; N1 + 1 < N0; ++N1) {
+        C1 = Chpt0[Pk_NNN_N(N1 + 1, N1, N0)];
+        C1 = N2_C_R(C1) > TOL1 ? Nzd2_C_C(C1) : C_R_C(1.0);
+
+        if(N1 + 2 < N0 && Rv1[N1] > TOL1) // Reflected, leading entry -C1 |x|.
+            C1 = M_CR_C(C1, -1.0);
+
+        C0 = M_CC_C(C0, C1);
+
+        for(N2 = 0; N2 < N0; ++N2)
+            Cmt0[N0 * (N1 + 1) + N2] = M_CC_C(Cmt0[N0 * (N1 + 1) + N2], C0);
+    }
+
+    Ql_RvtRvtCmtN_0(Rvt0, Rv1, Cmt0, N0);
+
+    for(N1 = 0; N1 + 1 < N0; ++N1) { // Ascending order, selection.
+        for(N2 = N1, N3 = N1 + 1; N3 < N0; ++N3)
+            if(Rvt0[N3] < Rvt0[N2]) N2 = N3;
+
+        if(N2 == N1) continue;
+
+        R0 = Rvt0[N1]; Rvt0[N1] = Rvt0[N2]; Rvt0[N2] = R0;
+
+        for(N3 = 0; N3 < N0; ++N3) {
+            C1 = Cmt0[N0 * N1 + N3];
+            Cmt0[N0 * N1 + N3] = Cmt0[N0 * N2 + N3];
+            Cmt0[N0 * N2 + N3] = C1;
+        }
+    }
+
+    Fr_P_0(Rv1);
+    Fr_P_0(Cv0);
+}
+
+// Rank-one updates.
+
+// Secular equation, 1 + R0 sum_j Rv1[j] / (Rv0[j] - x) = 0.
+typedef struct {
+
+    // Poles, ascending and distinct.
+    const Real* Rv0;
+
+    // Weights, squared components, positive.
+    const Real* Rv1;
+
+    // Roots' origins, their nearest pole.
+    Natural* Nvt0;
+
+    // Roots' offsets from their origins.
+    Real* Rvt0;
+
+    // Poles.
+    Natural N0;
+
+    // Weight, positive.
+    Real R0;
+
+    // Weights' sum.
+    Real R1;
+
+} Secular;
+
+// Rank-one problem, working order.
+typedef struct {
+
+    // Poles, ascending, rotated pairs mixed on exit.
+    Real* Rv0;
+
+    // Components, non-negative.
+    Real* Rv1;
+
+    // Columns.
+    Natural* Nv0;
+
+    // Kept indices, ascending.
+    Natural* Nv1;
+
+    // Rows and Columns.
+    Natural N0;
+
+    // Kept indices.
+    Natural N1;
+
+    // Weight, positive.
+    Real R0;
+
+    // Sign, the weight's original one.
+    Real R1;
+
+} Rank;
+
+/**
+ * @brief Distance [Gap], pole minus root, without cancellation.
+ * 
+ * @param Sc0 Secular [Sc].
+ * @param N0 Pole [N].
+ * @param N1 Root [N].
+ * @return Real Real Number [R].
+ */
+static inline Real Gap_ScNN_R(const Secular* Sc0, const Natural N0, const Natural N1) {
+    return (Sc0->Rv0[N0] - Sc0->Rv0[Sc0->Nvt0[N1]]) - Sc0->Rvt0[N1];
+}
+
+/**
+ * @brief Secular root [Sec], safeguarded Newton from the nearest pole.
+ * 
+ * The N0-th root lies between poles N0 and N0 + 1, the last one within the
+ * weights' sum above the last pole.
+ * 
+ * @param Sc0 Secular [Sc], Target [t].
+ * @param N0 Root [N].
+ */
+static void Sec_ScN_0(Secular* Sc0, const Natural N0) {
+    const register Real* Rv0 = Sc0->Rv0;
+    const register Real* Rv1 = Sc0->Rv1;
+    const register Natural N1 = Sc0->N0;
+
+    register Natural N2, N3 = N0;
+    register Real R0 = 0.5 * (N0 + 1 < N1 ? Rv0[N0 + 1] - Rv0[N0] : Sc0->R0 * Sc0->R1), R1, R2, R3, R4, R5, R6;
+
+    for(R1 = 1.0, N2 = 0; N2 < N1; ++N2) // Midpoint.
+        R1 += Sc0->R0 * Rv1[N2] / ((Rv0[N2] - Rv0[N0]) - R0);
+
+    // Bracket and origin.
+    if(R1 >= 0.0) {
+        R2 = 0.0; R3 = R0;
+    } else if(N0 + 1 < N1) {
+        N3 = N0 + 1; R2 = -R0; R3 = 0.0;
+    } else {
+        R2 = R0; R3 = 2.0 * R0;
+    }
+
+    R0 = 0.5 * (R2 + R3);
+
+    for(N2 = 0; N2 < BSC0; ++N2) {
+        register Natural N4 = 0;
+
+        for(R1 = 1.0, R4 = 0.0, R5 = 1.0; N4 < N1; ++N4) { // Value, derivative and terms.
+            const register Real R7 = (Rv0[N4] - Rv0[N3]) - R0;
+            const register Real R8 = Sc0->R0 * Rv1[N4] / R7;
+
+            R1 += R8;
+            R4 += R8 / R7;
+            R5 += fabs(R8);
+        }
+
+        if(fabs(R1) <= UPD0 * (Real) (N1 + 1) * R5) break;
+
+        if(R1 > 0.0) R3 = R0;
+        else R2 = R0;
+
+        R6 = R0 - R1 / R4; // Newton.
+
+        if(!(R6 > R2 && R6 < R3)) R6 = 0.5 * (R2 + R3);
+        if(R6 == R0 || R6 <= R2 || R6 >= R3) break; // Exhausted.
+
+        R0 = R6;
+    }
+
+    Sc0->Nvt0[N0] = N3;
+    Sc0->Rvt0[N0] = R0;
+}
+
+/**
+ * @brief Rank-one problem [Rnk], working order and deflation.
+ * 
+ * A negative weight is handled through -(D + R0 v v^H) = -D - R0 v v^H, the
+ * poles being reversed. Small components are dropped, and a rotation zeroes
+ * the first of two kept components whose poles are closer than the tolerance.
+ * 
+ * @param Rk0 Rank [Rk], Target [t], allocated.
+ * @param Rv0 Real Vector [Rv], ascending eigenvalues.
+ * @param Cmt0 Complex Matrix [Cm], Target [t], eigenvectors, rotated and rephased unless B0.
+ * @param R0 Real Number [R], weight.
+ * @param Cv0 Complex Vector [Cv].
+ * @param B0 Boolean [B], eigenvalues only, Cmt0 untouched.
+ */
+static void Rnk_RkRvCmtRCvB_0(Rank* Rk0, const Real* Rv0, Complex* Cmt0, const Real R0, const Complex* Cv0, const bool B0) {
+    const register Natural N0 = Rk0->N0;
+    register Natural N1, N2, N3 = N0, N4;
+    register Real R1 = 0.0, R2 = 0.0, R3, R4, R5;
+    register Complex C0;
+
+    Rk0->R0 = fabs(R0);
+    Rk0->R1 = R0 < 0.0 ? -1.0 : 1.0;
+
+    for(N1 = 0; N1 < N0; ++N1) { // Working order, components and phases.
+        N2 = R0 < 0.0 ? N0 - N1 - 1 : N1;
+        C0 = Dot_CrvCcvN_C(Cv0, Cmt0 + N0 * N2, N0);
+
+        Rk0->Rv0[N1] = Rk0->R1 * Rv0[N2];
+        Rk0->Rv1[N1] = N2_C_R(C0);
+        Rk0->Nv0[N1] = N2;
+
+        if(!B0 && Rk0->Rv1[N1] > 0.0) { // Real components, q = q z / |z|.
+            C0 = Nzd2_C_C(C0);
+
+            for(N4 = 0; N4 < N0; ++N4)
+                Cmt0[N0 * N2 + N4] = M_CC_C(Cmt0[N0 * N2 + N4], C0);
+        }
+
+        R1 += Rk0->Rv1[N1] * Rk0->Rv1[N1];
+        R2 = fmax(R2, fabs(Rv0[N2]));
+    }
+
+    R3 = UPD0 * fmax(R2, Rk0->R0 * R1); // Tolerance.
+    R1 = sqrt(R1);
+
+    for(Rk0->N1 = 0, N1 = 0; N1 < N0; ++N1) {
+        if(Rk0->R0 * R1 * Rk0->Rv1[N1] <= R3) continue; // Small component.
+
+        if(N3 < N0) {
+            R4 = hypot(Rk0->Rv1[N3], Rk0->Rv1[N1]);
+            R5 = Rk0->Rv1[N3] / R4; // Sine.
+            R2 = Rk0->Rv1[N1] / R4; // Cosine.
+
+            if(fabs((Rk0->Rv0[N1] - Rk0->Rv0[N3]) * R5 * R2) <= R3) { // Close poles.
+                const register Real R6 = Rk0->Rv0[N3], R7 = Rk0->Rv0[N1];
+
+                Rk0->Rv0[N3] = R2 * R2 * R6 + R5 * R5 * R7;
+                Rk0->Rv0[N1] = R5 * R5 * R6 + R2 * R2 * R7;
+                Rk0->Rv1[N3] = 0.0;
+                Rk0->Rv1[N1] = R4;
+
+                if(!B0)
+                    for(N4 = 0; N4 < N0; ++N4) {
+                        const register Complex C1 = Cmt0[N0 * Rk0->Nv0[N3] + N4], C2 = Cmt0[N0 * Rk0->Nv0[N1] + N4];
+
+                        Cmt0[N0 * Rk0->Nv0[N3] + N4] = S_CC_C(M_CR_C(C1, R2), M_CR_C(C2, R5));
+                        Cmt0[N0 * Rk0->Nv0[N1] + N4] = A_CC_C(M_CR_C(C1, R5), M_CR_C(C2, R2));
+                    }
+            } else
+                Rk0->Nv1[Rk0->N1++] = N3;
+        }
+
+        N3 = N1;
+    }
+
+    if(N3 < N0)
+        Rk0->Nv1[Rk0->N1++] = N3;
+}
+
+/**
+ * @brief Rank-one update [Upd], eigenvalues only, O(N0^2).
+ * 
+ * @param Rvt0 Real Vector [Rv], Target [t], ascending eigenvalues of A, then of A + R0 v v^H.
+ * @param Cm0 Complex Matrix [Cm], eigenvectors of A by column.
+ * @param R0 Real Number [R], weight.
+ * @param Cv0 Complex Vector [Cv], v.
+ * @param N0 Rows and Columns [N].
+ */
+void Upd_RvtCmRCvN_0(Real* Rvt0, const Complex* Cm0, const Real R0, const Complex* Cv0, const Natural N0) {
+    Rank Rk0 = {
+        .Rv0 = (Real*) Alc_NN_P(N0, sizeof(Real)), .Rv1 = (Real*) Alc_NN_P(N0, sizeof(Real)),
+        .Nv0 = (Natural*) Alc_NN_P(N0, sizeof(Natural)), .Nv1 = (Natural*) Alc_NN_P(N0, sizeof(Natural)), .N0 = N0
+    };
+
+    register Natural N1, N2 = 0;
+
+    Rnk_RkRvCmtRCvB_0(&Rk0, Rvt0, (Complex*) Cm0, R0, Cv0, true);
+
+    Real* Rv0 = (Real*) Alc_NN_P(Rk0.N1 + 1, sizeof(Real)); // Poles.
+    Real* Rv1 = (Real*) Alc_NN_P(Rk0.N1 + 1, sizeof(Real)); // Weights.
+    Secular Sc0 = {.Rv0 = Rv0, .Rv1 = Rv1, .Nvt0 = (Natural*) Alc_NN_P(Rk0.N1 + 1, sizeof(Natural)), .Rvt0 = (Real*) Alc_NN_P(Rk0.N1 + 1, sizeof(Real)), .N0 = Rk0.N1, .R0 = Rk0.R0, .R1 = 0.0};
+
+    for(N1 = 0; N1 < Rk0.N1; ++N1) {
+        Rv0[N1] = Rk0.Rv0[Rk0.Nv1[N1]];
+        Rv1[N1] = Rk0.Rv1[Rk0.Nv1[N1]] * Rk0.Rv1[Rk0.Nv1[N1]];
+        Sc0.R1 += Rv1[N1];
+    }
+
+    for(N1 = 0; N1 < Rk0.N1; ++N1) {
+        Sec_ScN_0(&Sc0, N1);
+        Rvt0[N1] = Rk0.R1 * (Rv0[Sc0.Nvt0[N1]] + Sc0.Rvt0[N1]);
+    }
+
+    for(N1 = 0; N1 < N0; ++N1) { // Deflated.
+        if(N2 < Rk0.N1 && Rk0.Nv1[N2] == N1) { ++N2; continue; }
+        Rvt0[Rk0.N1 + N1 - N2] = Rk0.R1 * Rk0.Rv0[N1];
+    }
+
+    qsort(Rvt0, N0, sizeof(Real), Cmp_PP_I);
+
+    Fr_P_0(Rk0.Rv0);
+    Fr_P_0(Rk0.Rv1);
+    Fr_P_0(Rk0.Nv0);
+    Fr_P_0(Rk0.Nv1);
+    Fr_P_0(Rv0);
+    Fr_P_0(Rv1);
+    Fr_P_0(Sc0.Nvt0);
+    Fr_P_0(Sc0.Rvt0);
+}
+
+// Eigenpair, the eigenvalue first for Cmp_PP_I.
+typedef struct {
+
+    // Eigenvalue.
+    Real R0;
+
+    // Column, past N0 for the updated ones.
+    Natural N0;
+
+} Pair;
+
+/**
+ * @brief Rank-one update [Upd], eigen-decomposition.
+ * 
+ * The eigenvalues cost O(N0^2), the eigenvectors O(N0 K^2) for K kept
+ * components. The secular components are recomputed from the roots, as by Gu
+ * and Eisenstat, so that the updated eigenvectors stay orthogonal.
+ * 
+ * @param Rvt0 Real Vector [Rv], Target [t], ascending eigenvalues of A, then of A + R0 v v^H.
+ * @param Cmt0 Complex Matrix [Cm], Target [t], eigenvectors by column, updated.
+ * @param R0 Real Number [R], weight.
+ * @param Cv0 Complex Vector [Cv], v.
+ * @param N0 Rows and Columns [N].
+ */
+void Upd_RvtCmtRCvN_0(Real* Rvt0, Complex* Cmt0, const Real R0, const Complex* Cv0, const Natural N0) {
+    Rank Rk0 = {
+        .Rv0 = (Real*) Alc_NN_P(N0, sizeof(Real)), .Rv1 = (Real*) Alc_NN_P(N0, sizeof(Real)),
+        .Nv0 = (Natural*) Alc_NN_P(N0, sizeof(Natural)), .Nv1 = (Natural*) Alc_NN_P(N0, sizeof(Natural)), .N0 = N0
+    };
+
+    register Natural N1, N2, N3 = 0;
+    register Real R1;
+
+    Rnk_RkRvCmtRCvB_0(&Rk0, Rvt0, Cmt0, R0, Cv0, false);
+
+    const register Natural N4 = Rk0.N1; // Kept.
+
+    Real* Rv0 = (Real*) Alc_NN_P(N4 + 1, sizeof(Real)); // Poles.
+    Real* Rv1 = (Real*) Alc_NN_P(N4 + 1, sizeof(Real)); // Weights, then recomputed components.
+    Real* Rv2 = (Real*) Alc_NN_P(N4 + 1, sizeof(Real)); // Eigenvector, secular basis.
+    Secular Sc0 = {.Rv0 = Rv0, .Rv1 = Rv1, .Nvt0 = (Natural*) Alc_NN_P(N4 + 1, sizeof(Natural)), .Rvt0 = (Real*) Alc_NN_P(N4 + 1, sizeof(Real)), .N0 = N4, .R0 = Rk0.R0, .R1 = 0.0};
+
+    Complex* Cm0 = (Complex*) Calc_NN_P(N0 * (N0 + N4), sizeof(Complex)); // Updated eigenvectors, then sorted ones.
+    Pair* Pv0 = (Pair*) Alc_NN_P(N0, sizeof(Pair));
+
+    for(N1 = 0; N1 < N4; ++N1) {
+        Rv0[N1] = Rk0.Rv0[Rk0.Nv1[N1]];
+        Rv1[N1] = Rk0.Rv1[Rk0.Nv1[N1]] * Rk0.Rv1[Rk0.Nv1[N1]];
+        Sc0.R1 += Rv1[N1];
+    }
+
+    for(N1 = 0; N1 < N4; ++N1)
+        Sec_ScN_0(&Sc0, N1);
+
+    // Components, z_j^2 = prod_i (x_i - d_j) / (R0 prod_{i != j} (d_i - d_j)).
+    for(N1 = 0; N1 < N4; ++N1) {
+        for(R1 = -Gap_ScNN_R(&Sc0, N1, N4 - 1) / Sc0.R0, N2 = 0; N2 + 1 < N4; ++N2)
+            R1 *= N2 < N1 ? Gap_ScNN_R(&Sc0, N1, N2) / (Rv0[N1] - Rv0[N2]) : -Gap_ScNN_R(&Sc0, N1, N2) / (Rv0[N2 + 1] - Rv0[N1]);
+
+        Rv2[N1] = sqrt(fmax(R1, 0.0));
+    }
+
+    for(N1 = 0; N1 < N4; ++N1) // Recomputed components.
+        Rv1[N1] = Rv2[N1];
+
+    for(N1 = 0; N1 < N4; ++N1) { // Eigenvectors, Q (D - x)^-1 z.
+        for(R1 = 0.0, N2 = 0; N2 < N4; ++N2) {
+            Rv2[N2] = Rv1[N2] / Gap_ScNN_R(&Sc0, N2, N1);
+            R1 += Rv2[N2] * Rv2[N2];
+        }
+
+        for(R1 = 1.0 / sqrt(R1), N2 = 0; N2 < N4; ++N2)
+            Ma_CvtCvCN_0(Cm0 + N0 * N1, Cmt0 + N0 * Rk0.Nv0[Rk0.Nv1[N2]], C_R_C(R1 * Rv2[N2]), N0);
+
+        Pv0[N1].R0 = Rk0.R1 * (Rv0[Sc0.Nvt0[N1]] + Sc0.Rvt0[N1]);
+        Pv0[N1].N0 = N0 + N1;
+    }
+
+    for(N1 = 0; N1 < N0; ++N1) { // Deflated.
+        if(N3 < N4 && Rk0.Nv1[N3] == N1) { ++N3; continue; }
+
+        Pv0[N4 + N1 - N3].R0 = Rk0.R1 * Rk0.Rv0[N1];
+        Pv0[N4 + N1 - N3].N0 = Rk0.Nv0[N1];
+    }
+
+    qsort(Pv0, N0, sizeof(Pair), Cmp_PP_I);
+
+    for(N1 = 0; N1 < N0; ++N1) // Ascending order.
+        Cp_CvtCvN_0(Cm0 + N0 * (N4 + N1), Pv0[N1].N0 < N0 ? Cmt0 + N0 * Pv0[N1].N0 : Cm0 + N0 * (Pv0[N1].N0 - N0), N0);
+
+    for(N1 = 0; N1 < N0; ++N1) {
+        Rvt0[N1] = Pv0[N1].R0;
+        Cp_CvtCvN_0(Cmt0 + N0 * N1, Cm0 + N0 * (N4 + N1), N0);
+    }
+
+    Fr_P_0(Rk0.Rv0);
+    Fr_P_0(Rk0.Rv1);
+    Fr_P_0(Rk0.Nv0);
+    Fr_P_0(Rk0.Nv1);
+    Fr_P_0(Rv0);
+    Fr_P_0(Rv1);
+    Fr_P_0(Rv2);
+    Fr_P_0(Sc0.Nvt0);
+    Fr_P_0(Sc0.Rvt0);
+    Fr_P_0(Cm0);
+    Fr_P_0(Pv0);
+}
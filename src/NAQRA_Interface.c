@@ -8,12 +8,222 @@
  * 
  */
 
+#include <string.h>
 #include "../include/Interface.h"
 
+// Files.
+
+/**
+ * @brief Matrix loader, complex column-major files being mapped without copies.
+ * 
+ * @param path Path, NULL or "-" for stdin.
+ * @param structure Structure, STR_* flags from the header, NULL to ignore.
+ * @return Matrix* Matrix, NULL on failure.
+ */
+[[nodiscard]] Matrix* LoadMatrix(const char* path, Natural* structure) {
+    Format Fmt0;
+    Complex* Cm0 = Ld_SFmtt_Cm(path, &Fmt0);
+
+    if(Cm0 == NULL) return NULL;
+    if(structure != NULL) *structure = (Natural) Fmt0.N3;
+
+    Matrix* M0 = (Matrix*) Alc_NN_P(1, sizeof(Matrix));
+
+    M0->Cm0 = Cm0;
+    M0->N0 = (Natural) Fmt0.N4;
+    M0->N1 = (Natural) Fmt0.N5;
+
+    return M0;
+}
+
+/**
+ * @brief Matrix saver.
+ * 
+ * @param path Path, NULL or "-" for stdout.
+ * @param matrix Matrix.
+ * @param structure Structure, STR_* flags.
+ * @return Natural Written entries.
+ */
+Natural SaveMatrix(const char* path, const Matrix* matrix, const Natural structure) {
+    const Format Fmt0 = {.N3 = structure, .N4 = matrix->N0, .N5 = matrix->N1};
+    return Sv_SFmtCm_N(path, &Fmt0, matrix->Cm0);
+}
+
+/**
+ * @brief Matrix Market reader, parsed in parallel, symmetric storage being expanded.
+ * 
+ * @param path Path.
+ * @param structure Structure, STR_* flags from the banner, NULL to ignore.
+ * @return Matrix* Matrix, NULL on failure.
+ */
+[[nodiscard]] Matrix* ReadMatrixMarket(const char* path, Natural* structure) {
+    Format Fmt0;
+    Complex* Cm0 = Mtx_SFmttN_Cm(path, &Fmt0, Thr_0_N());
+
+    if(Cm0 == NULL) return NULL;
+    if(structure != NULL) *structure = (Natural) Fmt0.N3;
+
+    Matrix* M0 = (Matrix*) Alc_NN_P(1, sizeof(Matrix));
+
+    M0->Cm0 = Cm0;
+    M0->N0 = (Natural) Fmt0.N4;
+    M0->N1 = (Natural) Fmt0.N5;
+
+    return M0;
+}
+
 // Eigenvalues.
 
 /**
- * @brief Matrix eigenvalues.
+ * @brief Tridiagonal form [Trd], packed copy.
+ * 
+ * @param Chp0 Complex Hermitian Packed Matrix [Chp].
+ * @param Rvt0 Real Vector [Rv], Target [t], diagonal.
+ * @param Rvt1 Real Vector [Rv], Target [t], off-diagonal.
+ * @param N0 Rows and Columns [N].
+ */
+static void Trd_ChpRvtRvtN_0(const Complex* Chp0, Real* Rvt0, Real* Rvt1, const Natural N0) {
+    Complex* Chp1 = (Complex*) Alc_NN_P(N0 * (N0 + 1) / 2, sizeof(Complex)); // Packed copy.
+    Cp_CvtCvN_0(Chp1, Chp0, N0 * (N0 + 1) / 2);
+
+    const Tuning Tn0 = Tn_0_Tn();
+
+    if(N0 < Tn0.N5)
+        Trd_ChptRvtRvtN_0(Chp1, Rvt0, Rvt1, N0); // Tridiagonal.
+    else {
+        Complex* Chb0 = (Complex*) Alc_NN_P(2 * Tn0.N4 * N0, sizeof(Complex)); // Band.
+
+        Bnd_ChptChbtNN_0(Chp1, Chb0, N0, Tn0.N4); // Band, blocked.
+        Trd_ChbtRvtRvtNNN_0(Chb0, Rvt0, Rvt1, N0, Tn0.N4, Thr_0_N()); // Tridiagonal, bulge chasing.
+
+        Fr_P_0(Chb0);
+    }
+
+    Fr_P_0(Chp1);
+}
+
+/**
+ * @brief Eigenvalues [Eig], structure dispatch.
+ * 
+ * Triangular matrices are read off, block upper triangular ones split and
+ * Hermitian, real and Hessenberg ones sent to their own paths. Real ones are
+ * balanced first, their QR being redone in complex arithmetic if it does not
+ * converge.
+ * 
+ * @param Cq0 Complex Square Matrix [Cq].
+ * @param Cvt0 Complex Vector [Cv], Target [t], eigenvalues.
+ * @param N0 Rows and Columns [N].
+ * @return Natural Structure [N], STR_* flags of the path taken.
+ */
+static Natural Eig_CqCvtN_N(const Complex* Cq0, Complex* Cvt0, const Natural N0) {
+    Natural* Nv0 = (Natural*) Alc_NN_P(N0, sizeof(Natural)); // Splits.
+    const register Natural N1 = Str_CqNvtN_N(Cq0, Nv0, N0); // Structure.
+    register Natural N2 = 0, N3, N4 = 0, N5 = 0;
+
+    if(N1 & (STR_UPPER | STR_LOWER)) { // Triangular.
+        for(; N2 < N0; ++N2)
+            Cvt0[N2] = Cq0[N2 * (N0 + 1)];
+
+        Fr_P_0(Nv0);
+        return N1 & (STR_UPPER | STR_LOWER);
+    }
+
+    for(; N2 + 1 < N0; ++N2) // Blocks.
+        N4 += Nv0[N2] <= N2;
+
+    if(N4 > 0) { // Reducible.
+        for(N2 = 0, N4 = 0, N5 = STR_REDUCIBLE; N2 < N0; ++N2) {
+            if(N2 + 1 < N0 && Nv0[N2] > N2) continue;
+
+            const register Natural N6 = N2 + 1 - N4; // Block's size.
+            Complex* Cq1 = (Complex*) Alc_NN_P(N6 * N6, sizeof(Complex));
+
+            for(N3 = 0; N3 < N6; ++N3) // Block copy.
+                Cp_CvtCvN_0(Cq1 + N3 * N6, Cq0 + (N4 + N3) * N0 + N4, N6);
+
+            N5 |= Eig_CqCvtN_N(Cq1, Cvt0 + N4, N6);
+            N4 = N2 + 1;
+
+            Fr_P_0(Cq1);
+        }
+
+        Fr_P_0(Nv0);
+        return N5;
+    }
+
+    Fr_P_0(Nv0);
+
+    if(N1 & STR_HERMITIAN) { // Tridiagonal.
+        Complex* Chp0 = (Complex*) Alc_NN_P(N0 * (N0 + 1) / 2, sizeof(Complex)); // Packed copy.
+        Real* Rv0 = (Real*) Alc_NN_P(N0, sizeof(Real)); // Diagonal.
+        Real* Rv1 = (Real*) Alc_NN_P(N0, sizeof(Real)); // Off-diagonal.
+
+        for(N2 = 0; N2 < N0; ++N2)
+            Cp_CvtCvN_0(Chp0 + Pk_NNN_N(N2, N2, N0), Cq0 + N2 * (N0 + 1), N0 - N2);
+
+        Trd_ChpRvtRvtN_0(Chp0, Rv0, Rv1, N0); // Tridiagonal.
+        Eig_RvtRvtN_0(Rv0, Rv1, N0); // Eigenvalues.
+
+        for(N2 = 0; N2 < N0; ++N2)
+            Cvt0[N2] = C_R_C(Rv0[N2]);
+
+        Fr_P_0(Chp0);
+        Fr_P_0(Rv0);
+        Fr_P_0(Rv1);
+
+        return N1 & (STR_HERMITIAN | STR_REAL);
+    }
+
+    Complex* Cm0 = NULL;
+
+    if(N1 & STR_REAL) { // Real arithmetic.
+        Real* Rq0 = (Real*) Alc_NN_P(N0 * N0, sizeof(Real)); // Real copy.
+
+        for(N2 = 0; N2 < N0 * N0; ++N2)
+            Rq0[N2] = vgetq_lane_f64(Cq0[N2], 0);
+
+        Bln_RqtN_0(Rq0, N0); // Balancing.
+        if(!(N1 & STR_HESSENBERG)) Hsn_RqtN_0(Rq0, N0); // Hessenberg.
+
+        if(Eig_RhsnqtCvtN_B(Rq0, Cvt0, N0)) { // Eigenvalues.
+            Fr_P_0(Rq0);
+            return N1 & (STR_REAL | STR_HESSENBERG);
+        }
+
+        // Unconverged, complex arithmetic on the balanced Hessenberg form.
+
+        for(N2 = 0; N2 < N0 * N0; ++N2)
+            Rq0[N2] = vgetq_lane_f64(Cq0[N2], 0);
+
+        Bln_RqtN_0(Rq0, N0); // Balancing.
+        if(!(N1 & STR_HESSENBERG)) Hsn_RqtN_0(Rq0, N0); // Hessenberg.
+
+        Cm0 = (Complex*) Alc_NN_P(N0 * N0, sizeof(Complex));
+
+        for(N2 = 0; N2 < N0 * N0; ++N2)
+            Cm0[N2] = C_R_C(Rq0[N2]);
+
+        Fr_P_0(Rq0);
+    } else {
+        Cm0 = (Complex*) Alc_NN_P(N0 * N0, sizeof(Complex)); // Matrix copy.
+        Cp_CmtCmNN_0(Cm0, Cq0, N0, Thr_0_N());
+
+        if(!(N1 & STR_HESSENBERG)) Hsn_CqtN_0(Cm0, N0); // Hessenberg.
+    }
+
+    Cpt_ChsnqtN_0(Cm0, N0); // Compact storage.
+    Eig_ChctNN_0(Cm0, N0, Thr_0_N()); // Eigenvalues.
+
+    for(N2 = 0; N2 < N0; ++N2) // Eigenvalues copy.
+        Cvt0[N2] = Cm0[Cx_NN_N(N2, N2)];
+
+    Fr_P_0(Cm0);
+
+    return N1 & STR_HESSENBERG;
+}
+
+/**
+ * @brief Matrix eigenvalues, the path taken being reported by the vector's structure.
  * 
  * @param matrix Square matrix.
  * @return Vector* Vector.
@@ -23,21 +233,872 @@
     assert(matrix->N0 == matrix->N1);
     #endif
 
+    Vector* V0 = NewVector(matrix->N0);
+    V0->N1 = Eig_CqCvtN_N(matrix->Cm0, V0->Cv0, matrix->N0);
+
+    return V0;
+}
+
+/**
+ * @brief Matrix eigenvalues, streamed as they deflate, within a budget.
+ * 
+ * Hessenberg input, any matrix up to 2 x 2 included, skips the reduction.
+ * 
+ * @param matrix Square matrix.
+ * @param callback Deflation callback, given the index, the eigenvalue and the iterations so far, returning false to cancel.
+ * @param data Callback's data.
+ * @param budget Budget, NULL for none.
+ * @return Natural Status, STS_*.
+ */
+Natural StreamEigenvalues(const Matrix* matrix, const Deflation callback, void* data, const Budget* budget) {
+    #ifndef NDEBUG // Integrity check.
+    assert(matrix->N0 == matrix->N1);
+    #endif
+
+    const register Natural N0 = matrix->N0;
+
+    Complex* Cm0 = (Complex*) Alc_NN_P(N0 * N0, sizeof(Complex)); // Matrix copy.
+    Natural* Nv0 = (Natural*) Alc_NN_P(N0, sizeof(Natural)); // Splits, unused.
+    Cp_CmtCmNN_0(Cm0, matrix->Cm0, N0, Thr_0_N());
+
+    if(N0 > 2 && !(Str_CqNvtN_N(Cm0, Nv0, N0) & STR_HESSENBERG)) Hsn_CqtN_0(Cm0, N0); // Hessenberg.
+    Cpt_ChsnqtN_0(Cm0, N0); // Compact storage.
+
+    Fr_P_0(Nv0);
+
+    const register Natural N1 = Eig_ChctDfPBgNN_N(Cm0, callback, data, budget, N0, Thr_0_N()); // Eigenvalues.
+
+    Fr_P_0(Cm0);
+
+    return N1;
+}
+
+// Collector's target.
+typedef struct {
+
+    // Eigenvalues, by deflation index.
+    Complex* Cv0;
+
+    // Converged eigenvalues.
+    Natural N0;
+
+} Collection;
+
+/**
+ * @brief Collector [Cl], converged eigenvalues into a collection.
+ * 
+ * @param N0 Index [N].
+ * @param C0 Eigenvalue [C].
+ * @param N1 Iterations [N].
+ * @param P0 Collection.
+ * @return bool Always true.
+ */
+static bool Cl_NCNP_B(const Natural N0, const Complex C0, [[maybe_unused]] const Natural N1, void* P0) {
+    Collection* Cl0 = (Collection*) P0;
+
+    Cl0->Cv0[N0] = C0;
+    ++Cl0->N0;
+
+    return true;
+}
+
+/**
+ * @brief Matrix eigenvalues within a budget, the converged ones only.
+ * 
+ * @param matrix Square matrix.
+ * @param budget Budget, NULL for none.
+ * @param status Status, STS_*, NULL to ignore.
+ * @return Vector* Vector, NULL if none converged.
+ */
+[[nodiscard]] Vector* BudgetEigenvalues(const Matrix* matrix, const Budget* budget, Natural* status) {
+    #ifndef NDEBUG // Integrity check.
+    assert(matrix->N0 == matrix->N1);
+    #endif
+
+    const register Natural N0 = matrix->N0;
+
+    Vector* V0 = NewVector(N0);
+    Collection Cl0 = {.Cv0 = V0->Cv0, .N0 = 0};
+
+    const register Natural N1 = StreamEigenvalues(matrix, Cl_NCNP_B, &Cl0, budget);
+    const register Natural N2 = Cl0.N0; // Converged.
+
+    if(status != NULL) *status = N1;
+
+    if(N2 == 0) {
+        FreeVector(V0);
+        return NULL;
+    }
+
+    Vector* V1 = NewVector(N2);
+
+    for(register Natural N3 = 0; N3 < N2; ++N3)
+        V1->Cv0[N3] = V0->Cv0[N0 - N2 + N3];
+
+    FreeVector(V0);
+
+    return V1;
+}
+
+/**
+ * @brief Matrix eigenvalues, out-of-core, streamed as they deflate, within a budget.
+ * 
+ * The Hessenberg reduction works on a scratch copy of the file within the
+ * given memory, or in memory when the matrix fits it, the QR algorithm on its
+ * compact storage.
+ * 
+ * @param path Path, NULL or "-" for stdin, binary, square and column-major.
+ * @param memory Memory for the reduction, bytes, 0 for CRE0.
+ * @param callback Deflation callback, given the index, the eigenvalue and the iterations so far, returning false to cancel.
+ * @param data Callback's data.
+ * @param budget Budget, NULL for none.
+ * @return Natural Status, STS_*.
+ */
+Natural OutOfCoreEigenvalues(const char* path, const size_t memory, const Deflation callback, void* data, const Budget* budget) {
+    Panels* Pnl0 = Opn_SN_Pnl(path, memory);
+    if(Pnl0 == NULL) return STS_FAILED;
+
+    const register Natural N0 = Pnl0->N0;
+    Complex* Chc0 = Hsn_Pnl_B(Pnl0) ? Cpt_Pnl_Chc(Pnl0) : NULL; // Hessenberg, compact storage.
+
+    Cls_Pnl_0(Pnl0);
+    if(Chc0 == NULL) return STS_FAILED;
+
+    const register Natural N1 = Eig_ChctDfPBgNN_N(Chc0, callback, data, budget, N0, Thr_0_N()); // Eigenvalues.
+
+    Fr_P_0(Chc0);
+
+    return N1;
+}
+
+/**
+ * @brief Matrix eigenvalues, warm-started from the solver's previous ones.
+ * 
+ * The first matrix is solved from scratch. Each later one takes the previous
+ * eigenvalues as the opening shifts at each deflation index, which pays off
+ * when consecutive matrices are close. Hessenberg input, any matrix up to
+ * 2 x 2 included, skips the reduction.
+ * 
+ * @param solver Solver, updated.
+ * @param matrix Square matrix, as large as the solver.
+ * @param status Status, STS_*, NULL to ignore.
+ * @return Vector* Vector, by deflation index.
+ */
+[[nodiscard]] Vector* SolverEigenvalues(Solver* solver, const Matrix* matrix, Natural* status) {
+    #ifndef NDEBUG // Integrity check.
+    assert(matrix->N0 == matrix->N1);
+    assert(matrix->N0 == solver->N0);
+    #endif
+
+    const register Natural N0 = matrix->N0;
+    register Natural N1;
+
+    Complex* Cm0 = (Complex*) Alc_NN_P(N0 * N0, sizeof(Complex)); // Matrix copy.
+    Natural* Nv0 = (Natural*) Alc_NN_P(N0, sizeof(Natural)); // Splits, unused.
+    Cp_CmtCmNN_0(Cm0, matrix->Cm0, N0, Thr_0_N());
+
+    if(N0 > 2 && !(Str_CqNvtN_N(Cm0, Nv0, N0) & STR_HESSENBERG)) Hsn_CqtN_0(Cm0, N0); // Hessenberg.
+    Cpt_ChsnqtN_0(Cm0, N0); // Compact storage.
+
+    Fr_P_0(Nv0);
+
+    Vector* V0 = NewVector(N0);
+
+    if(solver->N1 == 0) { // Cold start.
+        Collection Cl0 = {.Cv0 = V0->Cv0, .N0 = 0};
+        N1 = Eig_ChctDfPBgNN_N(Cm0, Cl_NCNP_B, &Cl0, NULL, N0, Thr_0_N());
+        Cp_CvtCvN_0(solver->Cv0, V0->Cv0, N0);
+    } else
+        N1 = Eig_ChctCvtDfPBgNN_N(Cm0, solver->Cv0, NULL, NULL, NULL, N0, Thr_0_N()); // Warm start.
+
+    Cp_CvtCvN_0(V0->Cv0, solver->Cv0, N0);
+    V0->N1 = STR_GENERAL;
+
+    if(status != NULL) *status = N1;
+
+    ++solver->N1;
+    Fr_P_0(Cm0);
+
+    return V0;
+}
+
+/**
+ * @brief Matrix eigenvalues, single precision.
+ * 
+ * @param matrix Square matrix.
+ * @return Vector* Vector.
+ */
+[[nodiscard]] Vector* SingleEigenvalues(const Matrix* matrix) {
+    #ifndef NDEBUG // Integrity check.
+    assert(matrix->N0 == matrix->N1);
+    #endif
+
     const register Natural N0 = matrix->N0;
     register Natural N1 = 0;
 
-    Complex* Cm0 = (Complex*) malloc(N0 * N0 * sizeof(Complex)); // Matrix copy.
+    Complexs* Csm0 = (Complexs*) Alc_NN_P(N0 * N0, sizeof(Complexs)); // Matrix copy.
+    Dm_CsvtCvN_0(Csm0, matrix->Cm0, N0 * N0);
+
+    if(N0 > 2) Hsn_CsqtN_0(Csm0, N0); // Hessenberg.
+    Eig_CshsnqtN_0(Csm0, N0); // Eigenvalues.
+
+    Vector* V0 = NewVector(N0);
+
+    for(; N1 < N0; ++N1) // Eigenvalues copy.
+        V0->Cv0[N1] = Pm_Cs_C(Csm0[N1 * (N0 + 1)]);
+
+    Fr_P_0(Csm0);
+
+    return V0;
+}
+
+/**
+ * @brief Matrix eigenvalues, single precision QR with double precision refinement.
+ * 
+ * Eigenvalues the refinement leaves short of double accuracy are taken from a
+ * double precision QR instead, each from the values the refined ones do not
+ * claim, nearest first.
+ * 
+ * @param matrix Square matrix.
+ * @param status Status, STS_CONVERGED if the refinement reached double accuracy throughout, STS_ITERATIONS if the double precision QR filled in, NULL to ignore.
+ * @return Vector* Vector.
+ */
+[[nodiscard]] Vector* MixedEigenvalues(const Matrix* matrix, Natural* status) {
+    #ifndef NDEBUG // Integrity check.
+    assert(matrix->N0 == matrix->N1);
+    #endif
+
+    const register Natural N0 = matrix->N0;
+    register Natural N1 = 0, N2, N3;
+    register Real R0, R1;
+
+    Complex* Cm0 = (Complex*) Alc_NN_P(N0 * N0, sizeof(Complex)); // Matrix copy.
     Cp_CvtCvN_0(Cm0, matrix->Cm0, N0 * N0);
 
-    Hsn_CqtN_0(Cm0, N0); // Hessenberg.
-    Eig_ChsnqtN_0(Cm0, N0); // Eigenvalues.
+    if(N0 > 2) Hsn_CqtN_0(Cm0, N0); // Hessenberg.
+
+    Complexs* Csm0 = (Complexs*) Alc_NN_P(N0 * N0, sizeof(Complexs)); // Single copy.
+    Dm_CsvtCvN_0(Csm0, Cm0, N0 * N0);
+
+    Eig_CshsnqtN_0(Csm0, N0); // Eigenvalues.
+
+    Vector* V0 = NewVector(N0);
+
+    for(; N1 < N0; ++N1) // Eigenvalues copy.
+        V0->Cv0[N1] = Pm_Cs_C(Csm0[N1 * (N0 + 1)]);
+
+    Fr_P_0(Csm0);
+
+    bool* Bv0 = (bool*) Alc_NN_P(N0, sizeof(bool)); // Double accuracy.
+    const register Natural N4 = Rfn_ChsnqCvtBvtN_N(Cm0, V0->Cv0, Bv0, N0); // Refinement.
+
+    if(N4 > 0) { // Double precision QR.
+        Cpt_ChsnqtN_0(Cm0, N0); // Compact storage.
+        Eig_ChctNN_0(Cm0, N0, Thr_0_N()); // Eigenvalues.
+
+        Complex* Cv0 = (Complex*) Alc_NN_P(N0, sizeof(Complex)); // Unclaimed eigenvalues.
+        bool* Bv1 = (bool*) Calc_NN_P(N0, sizeof(bool)); // Claims.
+
+        for(N1 = 0; N1 < N0; ++N1)
+            Cv0[N1] = Cm0[Cx_NN_N(N1, N1)];
+
+        for(N1 = 0; N1 < 2 * N0; ++N1) { // Refined claims first, then replacements.
+            const register Natural N5 = N1 % N0;
+            if(Bv0[N5] != (N1 < N0)) continue;
+
+            for(N2 = 0, N3 = 0, R0 = INFINITY; N2 < N0; ++N2) { // Nearest unclaimed.
+                if(Bv1[N2]) continue;
+
+                R1 = N2_C_R(S_CC_C(V0->Cv0[N5], Cv0[N2]));
+                if(R1 < R0) { R0 = R1; N3 = N2; }
+            }
+
+            Bv1[N3] = true;
+            if(!Bv0[N5]) V0->Cv0[N5] = Cv0[N3];
+        }
+
+        Fr_P_0(Cv0);
+        Fr_P_0(Bv1);
+    }
+
+    if(status != NULL) *status = N4 > 0 ? STS_ITERATIONS : STS_CONVERGED;
+
+    Fr_P_0(Bv0);
+    Fr_P_0(Cm0);
+
+    return V0;
+}
+
+/**
+ * @brief Hermitian matrix eigenvalues, ascending.
+ * 
+ * @param matrix Hermitian matrix.
+ * @return Vector* Vector.
+ */
+[[nodiscard]] Vector* HermitianEigenvalues(const HermitianMatrix* matrix) {
+    const register Natural N0 = matrix->N0;
+    register Natural N1 = 0;
+
+    Real* Rv0 = (Real*) Alc_NN_P(N0, sizeof(Real)); // Diagonal.
+    Real* Rv1 = (Real*) Alc_NN_P(N0, sizeof(Real)); // Off-diagonal.
+
+    Trd_ChpRvtRvtN_0(matrix->Chp0, Rv0, Rv1, N0); // Tridiagonal.
+    Eig_RvtRvtN_0(Rv0, Rv1, N0); // Eigenvalues.
 
     Vector* V0 = NewVector(N0);
 
     for(; N1 < N0; ++N1) // Eigenvalues copy.
-        V0->Cv0[N1] = Cm0[N1 * (N0 + 1)];
+        V0->Cv0[N1] = C_R_C(Rv0[N1]);
 
-    free(Cm0);
+    Fr_P_0(Rv0);
+    Fr_P_0(Rv1);
 
     return V0;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Hermitian matrix eigenvalues by index, ascending.
+ * 
+ * @param matrix Hermitian matrix.
+ * @param first First index, from the smallest eigenvalue.
+ * @param last Last index, excluded.
+ * @return Vector* Vector.
+ */
+[[nodiscard]] Vector* HermitianEigenvaluesIndex(const HermitianMatrix* matrix, const Natural first, const Natural last) {
+    #ifndef NDEBUG // Integrity check.
+    assert(first < last && last <= matrix->N0);
+    #endif
+
+    const register Natural N0 = matrix->N0;
+    register Natural N1 = 0;
+
+    Real* Rv0 = (Real*) Alc_NN_P(N0, sizeof(Real)); // Diagonal.
+    Real* Rv1 = (Real*) Alc_NN_P(N0, sizeof(Real)); // Off-diagonal.
+    Real* Rv2 = (Real*) Alc_NN_P(last - first, sizeof(Real)); // Eigenvalues.
+
+    Trd_ChpRvtRvtN_0(matrix->Chp0, Rv0, Rv1, N0); // Tridiagonal.
+    Sbs_RvRvRvtNNNN_0(Rv0, Rv1, Rv2, N0, first, last, Thr_0_N()); // Eigenvalues.
+
+    Vector* V0 = NewVector(last - first);
+
+    for(; N1 < last - first; ++N1) // Eigenvalues copy.
+        V0->Cv0[N1] = C_R_C(Rv2[N1]);
+
+    Fr_P_0(Rv0);
+    Fr_P_0(Rv1);
+    Fr_P_0(Rv2);
+
+    return V0;
+}
+
+/**
+ * @brief Hermitian matrix eigenvalues by value, ascending.
+ * 
+ * @param matrix Hermitian matrix.
+ * @param lower Lower bound.
+ * @param upper Upper bound, excluded.
+ * @return Vector* Vector, NULL if no eigenvalue lies in the range.
+ */
+[[nodiscard]] Vector* HermitianEigenvaluesRange(const HermitianMatrix* matrix, const Real lower, const Real upper) {
+    const register Natural N0 = matrix->N0;
+    register Natural N1 = 0;
+
+    Real* Rv0 = (Real*) Alc_NN_P(N0, sizeof(Real)); // Diagonal.
+    Real* Rv1 = (Real*) Alc_NN_P(N0, sizeof(Real)); // Off-diagonal.
+
+    Trd_ChpRvtRvtN_0(matrix->Chp0, Rv0, Rv1, N0); // Tridiagonal.
+
+    // Indices.
+    const register Natural N2 = Stc_RvRvRN_N(Rv0, Rv1, lower, N0);
+    const register Natural N3 = upper > lower ? Stc_RvRvRN_N(Rv0, Rv1, upper, N0) : N2;
+
+    if(N3 == N2) {
+        Fr_P_0(Rv0);
+        Fr_P_0(Rv1);
+
+        return NULL;
+    }
+
+    Real* Rv2 = (Real*) Alc_NN_P(N3 - N2, sizeof(Real)); // Eigenvalues.
+    Sbs_RvRvRvtNNNN_0(Rv0, Rv1, Rv2, N0, N2, N3, Thr_0_N());
+
+    Vector* V0 = NewVector(N3 - N2);
+
+    for(; N1 < N3 - N2; ++N1) // Eigenvalues copy.
+        V0->Cv0[N1] = C_R_C(Rv2[N1]);
+
+    Fr_P_0(Rv0);
+    Fr_P_0(Rv1);
+    Fr_P_0(Rv2);
+
+    return V0;
+}
+
+/**
+ * @brief Hermitian matrix eigen-decomposition, the starting point of rank-one updates.
+ * 
+ * @param matrix Hermitian matrix.
+ * @return HermitianDecomposition* Hermitian decomposition.
+ */
+[[nodiscard]] HermitianDecomposition* NewHermitianDecomposition(const HermitianMatrix* matrix) {
+    const register Natural N0 = matrix->N0;
+
+    HermitianDecomposition* H0 = (HermitianDecomposition*) Alc_NN_P(1, sizeof(HermitianDecomposition));
+
+    H0->Rv0 = (Real*) Alc_NN_P(N0, sizeof(Real));
+    H0->Cm0 = (Complex*) Alc_NN_P(N0 * N0, sizeof(Complex));
+    H0->N0 = N0;
+
+    Complex* Chp0 = (Complex*) Alc_NN_P(N0 * (N0 + 1) / 2, sizeof(Complex)); // Packed copy.
+    Cp_CvtCvN_0(Chp0, matrix->Chp0, N0 * (N0 + 1) / 2);
+
+    Dcm_ChptCmtRvtN_0(Chp0, H0->Cm0, H0->Rv0, N0); // Eigen-decomposition.
+
+    Fr_P_0(Chp0);
+
+    return H0;
+}
+
+/**
+ * @brief Hermitian eigenvalues after a rank-one update, ascending, in O(N^2).
+ * 
+ * The decomposition is left untouched.
+ * 
+ * @param decomposition Hermitian decomposition of A.
+ * @param weight Weight.
+ * @param vector Vector v.
+ * @return Vector* Vector, eigenvalues of A + weight v v^H.
+ */
+[[nodiscard]] Vector* UpdatedHermitianEigenvalues(const HermitianDecomposition* decomposition, const Real weight, const Vector* vector) {
+    #ifndef NDEBUG // Integrity check.
+    assert(vector->N0 == decomposition->N0);
+    #endif
+
+    const register Natural N0 = decomposition->N0;
+    register Natural N1 = 0;
+
+    Real* Rv0 = (Real*) Alc_NN_P(N0, sizeof(Real)); // Eigenvalues.
+
+    for(; N1 < N0; ++N1)
+        Rv0[N1] = decomposition->Rv0[N1];
+
+    Upd_RvtCmRCvN_0(Rv0, decomposition->Cm0, weight, vector->Cv0, N0); // Secular equation.
+
+    Vector* V0 = NewVector(N0);
+
+    for(N1 = 0; N1 < N0; ++N1) // Eigenvalues copy.
+        V0->Cv0[N1] = C_R_C(Rv0[N1]);
+
+    Fr_P_0(Rv0);
+
+    return V0;
+}
+
+/**
+ * @brief Hermitian rank-one update, A = A + weight v v^H.
+ * 
+ * @param decomposition Hermitian decomposition, updated.
+ * @param weight Weight.
+ * @param vector Vector v.
+ */
+void UpdateHermitianDecomposition(HermitianDecomposition* decomposition, const Real weight, const Vector* vector) {
+    #ifndef NDEBUG // Integrity check.
+    assert(vector->N0 == decomposition->N0);
+    #endif
+
+    Upd_RvtCmtRCvN_0(decomposition->Rv0, decomposition->Cm0, weight, vector->Cv0, decomposition->N0);
+}
+
+/**
+ * @brief Hermitian low-rank update, A = A + V diag(weights) V^H, one column at a time.
+ * 
+ * @param decomposition Hermitian decomposition, updated.
+ * @param weights Weights, one per column.
+ * @param vectors Matrix V, as many rows as the decomposition.
+ */
+void LowRankUpdateHermitianDecomposition(HermitianDecomposition* decomposition, const Real* weights, const Matrix* vectors) {
+    #ifndef NDEBUG // Integrity check.
+    assert(vectors->N0 == decomposition->N0);
+    #endif
+
+    register Natural N1 = 0;
+
+    for(; N1 < vectors->N1; ++N1)
+        Upd_RvtCmtRCvN_0(decomposition->Rv0, decomposition->Cm0, weights[N1], vectors->Cm0 + vectors->N0 * N1, decomposition->N0);
+}
+
+/**
+ * @brief Sparse mat-vec, operator's form.
+ * 
+ * @param Cv0 Complex Vector [Cv].
+ * @param Cvt0 Complex Vector [Cv], Target [t].
+ * @param P0 Sparse matrix.
+ */
+static void Mv_CvCvtP_0(const Complex* Cv0, Complex* Cvt0, void* P0) {
+    const SparseMatrix* S0 = (const SparseMatrix*) P0;
+    Mv_CvNvNvCvCvtN_0(S0->Cv0, S0->Nv0, S0->Nv1, Cv0, Cvt0, S0->N0);
+}
+
+/**
+ * @brief Operator eigenvalues, a few extremal ones.
+ * 
+ * @param operator Mat-vec callback.
+ * @param data Callback's data.
+ * @param size Operator's rows and columns.
+ * @param count Wanted eigenvalues.
+ * @param ordering SRT_MAGNITUDE or SRT_REAL.
+ * @param status Status, STS_CONVERGED or STS_ITERATIONS, NULL to ignore.
+ * @return Vector* Vector, NaN for the eigenvalues that did not converge.
+ */
+[[nodiscard]] Vector* OperatorEigenvalues(const Operator operator, void* data, const Natural size, const Natural count, const Natural ordering, Natural* status) {
+    #ifndef NDEBUG // Integrity check.
+    assert(count > 0 && count < size);
+    #endif
+
+    const register Natural N0 = size;
+    const register Natural N1 = count;
+    const register Natural N2 = 2 * N1 + 1 > 20 ? 2 * N1 + 1 : 20; // Basis size.
+
+    Vector* V0 = NewVector(N1);
+    const register Natural N3 = Ira_OpPCvtNNNN_N(operator, data, V0->Cv0, N0, N1, N2 < N0 ? N2 : N0, ordering); // Converged.
+
+    if(status != NULL) *status = N3 == N1 ? STS_CONVERGED : STS_ITERATIONS;
+
+    return V0;
+}
+
+/**
+ * @brief Sparse matrix eigenvalues, a few extremal ones.
+ * 
+ * @param matrix Sparse matrix.
+ * @param count Wanted eigenvalues.
+ * @param ordering SRT_MAGNITUDE or SRT_REAL.
+ * @param status Status, STS_CONVERGED or STS_ITERATIONS, NULL to ignore.
+ * @return Vector* Vector, NaN for the eigenvalues that did not converge.
+ */
+[[nodiscard]] Vector* SparseEigenvalues(const SparseMatrix* matrix, const Natural count, const Natural ordering, Natural* status) {
+    return OperatorEigenvalues(Mv_CvCvtP_0, (void*) matrix, matrix->N0, count, ordering, status);
+}
+
+/**
+ * @brief Polynomial roots, in O(N^2) time and O(N) memory.
+ * 
+ * @param coefficients Coefficients, ascending powers.
+ * @return Vector* Vector, as long as the degree, NULL for constant polynomials.
+ */
+[[nodiscard]] Vector* Roots(const Vector* coefficients) {
+    if(coefficients->N0 < 2) return NULL;
+
+    Vector* V0 = NewVector(coefficients->N0 - 1);
+
+    if((V0->N0 = Rts_CvCvtN_N(coefficients->Cv0, V0->Cv0, coefficients->N0)) == 0) {
+        FreeVector(V0);
+        return NULL;
+    }
+
+    return V0;
+}
+
+/**
+ * @brief Matrix pseudospectrum, smallest singular values of zI - A on a grid.
+ * 
+ * The matrix is reduced once to its Schur form, the points being then spread
+ * across threads at O(N^2) per inverse Lanczos iteration.
+ * 
+ * @param matrix Square matrix.
+ * @param lower Lower left corner.
+ * @param upper Upper right corner.
+ * @param rows Rows, points along the imaginary axis.
+ * @param columns Columns, points along the real axis.
+ * @return Pseudospectrum* Pseudospectrum, NaN values and the QR algorithm's status if the Schur form did not converge.
+ */
+[[nodiscard]] Pseudospectrum* Pseudospectra(const Matrix* matrix, const Complex lower, const Complex upper, const Natural rows, const Natural columns) {
+    #ifndef NDEBUG // Integrity check.
+    assert(matrix->N0 == matrix->N1);
+    assert(rows > 0 && columns > 0);
+    #endif
+
+    const register Natural N0 = matrix->N0;
+    const register Real R0 = vgetq_lane_f64(lower, 0), R1 = vgetq_lane_f64(lower, 1);
+    const register Real R2 = columns > 1 ? (vgetq_lane_f64(upper, 0) - R0) / (Real) (columns - 1) : 0.0; // Steps.
+    const register Real R3 = rows > 1 ? (vgetq_lane_f64(upper, 1) - R1) / (Real) (rows - 1) : 0.0;
+    register Natural N1, N2;
+
+    Complex* Cm0 = (Complex*) Alc_NN_P(N0 * N0, sizeof(Complex)); // Matrix copy.
+    Cp_CmtCmNN_0(Cm0, matrix->Cm0, N0, Thr_0_N());
+
+    const register Natural N3 = Sch_CqtN_N(Cm0, N0); // Schur form.
+
+    Complex* Cv0 = (Complex*) Alc_NN_P(rows * columns, sizeof(Complex)); // Points.
+
+    for(N1 = 0; N1 < columns; ++N1)
+        for(N2 = 0; N2 < rows; ++N2)
+            Cv0[N1 * rows + N2] = C_RR_C(R0 + (Real) N1 * R2, R1 + (Real) N2 * R3);
+
+    Pseudospectrum* P0 = (Pseudospectrum*) Alc_NN_P(1, sizeof(Pseudospectrum));
+
+    P0->Rm0 = (Real*) Alc_NN_P(rows * columns, sizeof(Real));
+    P0->C0 = lower;
+    P0->C1 = upper;
+    P0->N0 = rows;
+    P0->N1 = columns;
+    P0->N2 = N3;
+
+    if(N3 == STS_CONVERGED)
+        Psd_CuCvRvtNNN_0(Cm0, Cv0, P0->Rm0, N0, rows * columns, Thr_0_N());
+    else
+        for(N1 = 0; N1 < rows * columns; ++N1)
+            P0->Rm0[N1] = NAN;
+
+    Fr_P_0(Cm0);
+    Fr_P_0(Cv0);
+
+    return P0;
+}
+
+/**
+ * @brief Pseudospectrum saver, "real imaginary value" lines, columns split by blank lines, as for contour plots.
+ * 
+ * @param path Path, NULL or "-" for stdout.
+ * @param pseudospectrum Pseudospectrum.
+ * @return Natural Written points.
+ */
+Natural SavePseudospectrum(const char* path, const Pseudospectrum* pseudospectrum) {
+    FILE* F0 = path == NULL || strcmp(path, "-") == 0 ? stdout : fopen(path, "w");
+    if(F0 == NULL) return 0;
+
+    const register Natural N0 = pseudospectrum->N0, N1 = pseudospectrum->N1;
+    const register Real R0 = vgetq_lane_f64(pseudospectrum->C0, 0), R1 = vgetq_lane_f64(pseudospectrum->C0, 1);
+    const register Real R2 = N1 > 1 ? (vgetq_lane_f64(pseudospectrum->C1, 0) - R0) / (Real) (N1 - 1) : 0.0;
+    const register Real R3 = N0 > 1 ? (vgetq_lane_f64(pseudospectrum->C1, 1) - R1) / (Real) (N0 - 1) : 0.0;
+    register Natural N2, N3, N4 = 0;
+
+    for(N2 = 0; N2 < N1; ++N2) {
+        for(N3 = 0; N3 < N0; ++N3)
+            N4 += fprintf(F0, "%.17g %.17g %.17g\n", R0 + (Real) N2 * R2, R1 + (Real) N3 * R3, pseudospectrum->Rm0[N2 * N0 + N3]) > 0;
+
+        fprintf(F0, "\n");
+    }
+
+    if(F0 == stdout) fflush(F0);
+    else fclose(F0);
+
+    return N4;
+}
+
+/**
+ * @brief Schur decomposition, clustered, shared by any number of matrix functions.
+ * 
+ * @param matrix Square matrix.
+ * @return SchurDecomposition* Schur decomposition.
+ */
+[[nodiscard]] SchurDecomposition* NewSchurDecomposition(const Matrix* matrix) {
+    #ifndef NDEBUG // Integrity check.
+    assert(matrix->N0 == matrix->N1);
+    #endif
+
+    const register Natural N0 = matrix->N0;
+
+    SchurDecomposition* S0 = (SchurDecomposition*) Alc_NN_P(1, sizeof(SchurDecomposition));
+
+    S0->Cm0 = (Complex*) Alc_NN_P(N0 * N0, sizeof(Complex));
+    S0->Cm1 = (Complex*) Alc_NN_P(N0 * N0, sizeof(Complex));
+    S0->Nv0 = (Natural*) Alc_NN_P(N0 + 1, sizeof(Natural));
+    S0->N0 = N0;
+
+    Cp_CmtCmNN_0(S0->Cm0, matrix->Cm0, N0, Thr_0_N()); // Matrix copy.
+
+    Sch_CqtCqtN_0(S0->Cm0, S0->Cm1, N0); // Schur form.
+    S0->N1 = Cls_CutCqtNvtN_N(S0->Cm0, S0->Cm1, S0->Nv0, N0); // Clusters.
+
+    return S0;
+}
+
+/**
+ * @brief Schur decomposition's eigenvalues, clusters' order.
+ * 
+ * @param decomposition Schur decomposition.
+ * @return Vector* Vector, eigenvalues.
+ */
+[[nodiscard]] Vector* SchurEigenvalues(const SchurDecomposition* decomposition) {
+    Vector* V0 = NewVector(decomposition->N0);
+
+    for(register Natural N1 = 0; N1 < decomposition->N0; ++N1)
+        V0->Cv0[N1] = decomposition->Cm0[N1 * (decomposition->N0 + 1)];
+
+    return V0;
+}
+
+/**
+ * @brief Matrix function f(A), blocked Schur-Parlett.
+ * 
+ * Clusters too wide for f's radius of convergence are split on a copy of the
+ * decomposition, which is left untouched for other functions.
+ * 
+ * @param decomposition Schur decomposition of A.
+ * @param function Taylor coefficients of f, analytic on the eigenvalues' clusters.
+ * @param radius Radius of convergence of f's Taylor series, NULL for entire functions.
+ * @param status Status, STS_*, NULL to ignore.
+ * @return Matrix* Matrix, f(A), NULL if a Taylor series did not converge or the result is not finite.
+ */
+[[nodiscard]] Matrix* MatrixFunction(const SchurDecomposition* decomposition, const Taylor function, const Radius radius, Natural* status) {
+    const register Natural N0 = decomposition->N0;
+    register Natural N1 = decomposition->N1, N2;
+
+    Complex* Cm0 = decomposition->Cm0; // Schur form.
+    Complex* Cm1 = decomposition->Cm1; // Schur vectors.
+    Natural* Nv0 = decomposition->Nv0; // Clusters.
+
+    if(!Fit_CuNvRdNN_B(Cm0, Nv0, radius, N0, N1)) { // Splitting, on a copy.
+        Cm0 = (Complex*) Alc_NN_P(N0 * N0, sizeof(Complex));
+        Cm1 = (Complex*) Alc_NN_P(N0 * N0, sizeof(Complex));
+        Nv0 = (Natural*) Alc_NN_P(N0 + 1, sizeof(Natural));
+
+        Cp_CmtCmNN_0(Cm0, decomposition->Cm0, N0, Thr_0_N());
+        Cp_CmtCmNN_0(Cm1, decomposition->Cm1, N0, Thr_0_N());
+
+        for(N2 = 0; N2 <= N1; ++N2)
+            Nv0[N2] = decomposition->Nv0[N2];
+
+        N1 = Spl_CutCqtNvtRdNN_N(Cm0, Cm1, Nv0, radius, N0, N1);
+    }
+
+    Matrix* M0 = NewMatrix(N0, N0);
+
+    N2 = Fnc_CuNvTyCutNN_N(Cm0, Nv0, function, M0->Cm0, N0, N1); // f(T).
+    if(N2 == STS_CONVERGED) Sim_CqCqtN_0(Cm1, M0->Cm0, N0); // Q f(T) Q^H.
+
+    if(Cm0 != decomposition->Cm0) {
+        Fr_P_0(Cm0);
+        Fr_P_0(Cm1);
+        Fr_P_0(Nv0);
+    }
+
+    if(status != NULL) *status = N2;
+
+    if(N2 != STS_CONVERGED) {
+        FreeMatrix(M0);
+        return NULL;
+    }
+
+    return M0;
+}
+
+/**
+ * @brief Matrix exponential.
+ * 
+ * @param decomposition Schur decomposition of A.
+ * @param status Status, STS_*, NULL to ignore.
+ * @return Matrix* Matrix, exp(A), NULL on failure.
+ */
+[[nodiscard]] Matrix* MatrixExponential(const SchurDecomposition* decomposition, Natural* status) { return MatrixFunction(decomposition, Exp_CN_C, Exp_C_R, status); }
+
+/**
+ * @brief Matrix principal logarithm, no eigenvalue on the closed negative real axis.
+ * 
+ * @param decomposition Schur decomposition of A.
+ * @param status Status, STS_*, NULL to ignore.
+ * @return Matrix* Matrix, log(A), NULL on failure.
+ */
+[[nodiscard]] Matrix* MatrixLogarithm(const SchurDecomposition* decomposition, Natural* status) { return MatrixFunction(decomposition, Log_CN_C, Log_C_R, status); }
+
+/**
+ * @brief Gershgorin bounds of the spectrum.
+ * 
+ * @param matrix Square matrix.
+ * @return Vector* Vector, lower left and upper right corners of a box holding the spectrum.
+ */
+[[nodiscard]] Vector* SpectralBounds(const Matrix* matrix) {
+    #ifndef NDEBUG // Integrity check.
+    assert(matrix->N0 == matrix->N1);
+    #endif
+
+    Real Rv0[4];
+    Grs_CqRvtN_R(matrix->Cm0, Rv0, matrix->N0);
+
+    Vector* V0 = NewVector(2);
+
+    V0->Cv0[0] = C_RR_C(Rv0[0], Rv0[2]);
+    V0->Cv0[1] = C_RR_C(Rv0[1], Rv0[3]);
+
+    return V0;
+}
+
+/**
+ * @brief Gershgorin bound of the spectral radius.
+ * 
+ * @param matrix Square matrix.
+ * @return Real Upper bound.
+ */
+Real SpectralRadiusBound(const Matrix* matrix) {
+    #ifndef NDEBUG // Integrity check.
+    assert(matrix->N0 == matrix->N1);
+    #endif
+
+    Real Rv0[4];
+    return Grs_CqRvtN_R(matrix->Cm0, Rv0, matrix->N0);
+}
+
+/**
+ * @brief Dense mat-vec, operator's form.
+ * 
+ * @param Cv0 Complex Vector [Cv].
+ * @param Cvt0 Complex Vector [Cv], Target [t].
+ * @param P0 Matrix.
+ */
+static void Mvd_CvCvtP_0(const Complex* Cv0, Complex* Cvt0, void* P0) {
+    const Matrix* M0 = (const Matrix*) P0;
+    Mv_CmCvCvtNN_0(M0->Cm0, Cv0, Cvt0, M0->N0, M0->N1);
+}
+
+/**
+ * @brief Operator dominant eigenvalues, block power iteration.
+ * 
+ * @param operator Mat-vec callback.
+ * @param data Callback's data.
+ * @param size Operator's rows and columns.
+ * @param count Block size, wanted eigenvalues.
+ * @param tolerance Residual, relative to the projection's norm.
+ * @param iterations Maximum iterations.
+ * @return Vector* Vector, largest magnitude first.
+ */
+[[nodiscard]] Vector* OperatorDominantEigenvalues(const Operator operator, void* data, const Natural size, const Natural count, const Real tolerance, const Natural iterations) {
+    #ifndef NDEBUG // Integrity check.
+    assert(count > 0 && count <= size);
+    #endif
+
+    Vector* V0 = NewVector(count);
+    Bpw_OpPCvtRNNN_N(operator, data, V0->Cv0, tolerance, size, count, iterations);
+
+    return V0;
+}
+
+/**
+ * @brief Matrix dominant eigenvalues, block power iteration.
+ * 
+ * @param matrix Square matrix.
+ * @param count Block size, wanted eigenvalues.
+ * @param tolerance Residual, relative to the projection's norm.
+ * @param iterations Maximum iterations.
+ * @return Vector* Vector, largest magnitude first.
+ */
+[[nodiscard]] Vector* DominantEigenvalues(const Matrix* matrix, const Natural count, const Real tolerance, const Natural iterations) {
+    #ifndef NDEBUG // Integrity check.
+    assert(matrix->N0 == matrix->N1);
+    #endif
+
+    return OperatorDominantEigenvalues(Mvd_CvCvtP_0, (void*) matrix, matrix->N0, count, tolerance, iterations);
+}
+
+/**
+ * @brief Sparse matrix dominant eigenvalues, block power iteration.
+ * 
+ * @param matrix Sparse matrix.
+ * @param count Block size, wanted eigenvalues.
+ * @param tolerance Residual, relative to the projection's norm.
+ * @param iterations Maximum iterations.
+ * @return Vector* Vector, largest magnitude first.
+ */
+[[nodiscard]] Vector* SparseDominantEigenvalues(const SparseMatrix* matrix, const Natural count, const Real tolerance, const Natural iterations) {
+    return OperatorDominantEigenvalues(Mv_CvCvtP_0, (void*) matrix, matrix->N0, count, tolerance, iterations);
+}
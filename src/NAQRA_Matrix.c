@@ -9,7 +9,9 @@
  */
 
 #include <stdlib.h>
+#include <memory.h>
 #include "../include/Matrix.h"
+#include "../include/Generic.h"
 
 // Householder products.
 
@@ -26,7 +28,7 @@ void Hsl_CqtCvNN_0(Complex* Cqt0, const Complex* Cv0, const Natural N0, const Na
     const register Natural N5 = N0 - N1;
     register Complex C0 = {0.0, 0.0};
 
-    if(N0 < 5)
+    if(N1 < Tn_0_Tn().N0) // Short vectors.
         for(; N2 < N0; ++N2) {
             N3 = N5;
             N4 = N2 * N0 + N5;
@@ -39,47 +41,8 @@ void Hsl_CqtCvNN_0(Complex* Cqt0, const Complex* Cv0, const Natural N0, const Na
             for(N3 = N5, N4 = N2 * N0 + N5; N3 < N0; ++N3, ++N4)
                 Cqt0[N4] = S_CC_C(Cqt0[N4], M_CC_C(Cv0[N3], C0));
         }
-    else {
-        register Complex C1 = {0.0, 0.0};
-        register Complex C2 = {0.0, 0.0};
-        register Complex C3 = {0.0, 0.0};
-        register Complex C4 = {0.0, 0.0};
-
-        for(; N2 < N0; ++N2) {
-            N3 = N5;
-            N4 = N2 * N0 + N5;
-
-            C1 = M_CcjC_C(Cv0[N3], Cqt0[N4]);
-            C2 = M_CcjC_C(Cv0[N3 + 1], Cqt0[N4 + 1]);
-            C3 = M_CcjC_C(Cv0[N3 + 2], Cqt0[N4 + 2]);
-            C4 = M_CcjC_C(Cv0[N3 + 3], Cqt0[N4 + 3]);
-
-            N3 += 4;
-            N4 += 4;
-
-            for(; N3 + 3 < N0; N3 += 4, N4 += 4) {
-                C1 = A_CC_C(C1, M_CcjC_C(Cv0[N3], Cqt0[N4]));
-                C2 = A_CC_C(C2, M_CcjC_C(Cv0[N3 + 1], Cqt0[N4 + 1]));
-                C3 = A_CC_C(C3, M_CcjC_C(Cv0[N3 + 2], Cqt0[N4 + 2]));
-                C4 = A_CC_C(C4, M_CcjC_C(Cv0[N3 + 3], Cqt0[N4 + 3]));
-            }
-
-            for(; N3 < N0; ++N3, ++N4)
-                C1 = A_CC_C(C1, M_CcjC_C(Cv0[N3], Cqt0[N4]));
-
-            C0 = M_CR_C(A_CC_C(A_CC_C(C1, C2), A_CC_C(C3, C4)), 2.0);
-
-            for(N3 = N5, N4 = N2 * N0 + N5; N3 + 3 < N0; N3 += 4, N4 += 4) {
-                Cqt0[N4] = S_CC_C(Cqt0[N4], M_CC_C(Cv0[N3], C0));
-                Cqt0[N4 + 1] = S_CC_C(Cqt0[N4 + 1], M_CC_C(Cv0[N3 + 1], C0));
-                Cqt0[N4 + 2] = S_CC_C(Cqt0[N4 + 2], M_CC_C(Cv0[N3 + 2], C0));
-                Cqt0[N4 + 3] = S_CC_C(Cqt0[N4 + 3], M_CC_C(Cv0[N3 + 3], C0));
-            }
-
-            for(; N3 < N0; ++N3, ++N4)
-                Cqt0[N4] = S_CC_C(Cqt0[N4], M_CC_C(Cv0[N3], C0));
-        }
-    }
+    else // Generated, packed.
+        Hslg_CqtCvNN_0(Cqt0, Cv0, N0, N1);
 }
 
 /**
@@ -90,22 +53,7 @@ void Hsl_CqtCvNN_0(Complex* Cqt0, const Complex* Cv0, const Natural N0, const Na
  * @param N0 Rows and Columns [N].
  * @param N1 Entries [N].
  */
-void Hsr_CqtCvNN_0(Complex* Cqt0, const Complex* Cv0, const Natural N0, const Natural N1) {
-    register Natural N2 = 0, N3;
-    const register Natural N4 = N0 - N1;
-
-    for(; N2 < N0; ++N2) {
-        register Complex C0 = {0.0, 0.0};
-
-        for(N3 = N4; N3 < N0; ++N3)
-            C0 = A_CC_C(C0, M_CC_C(Cqt0[N3 * N0 + N2], Cv0[N3]));
-
-        C0 = M_CR_C(C0, 2.0);
-
-        for(N3 = N4; N3 < N0; ++N3)
-            Cqt0[N3 * N0 + N2] = S_CC_C(Cqt0[N3 * N0 + N2], M_CCcj_C(C0, Cv0[N3]));
-    }
-}
+void Hsr_CqtCvNN_0(Complex* Cqt0, const Complex* Cv0, const Natural N0, const Natural N1) { Hsrg_CqtCvNN_0(Cqt0, Cv0, N0, N1); }
 
 // Givens products.
 
@@ -118,16 +66,29 @@ void Hsr_CqtCvNN_0(Complex* Cqt0, const Complex* Cv0, const Natural N0, const Na
  * @param N0 Rows and Columns [N].
  * @param N1 Index [N].
  */
-void Gvl_ChsnqtCCNN_0(Complex* Chsnqt0, const Complex C0, const Complex C1, const Natural N0, const Natural N1) {
-    register Natural N3 = (N1 + 1) * (N0 + 1) - 1;
-    register Natural N4 = N3 + 1;
+void Gvl_ChsnqtCCNN_0(Complex* Chsnqt0, const Complex C0, const Complex C1, const Natural N0, const Natural N1) { Gvlg_ChsnqtCCNN_0(Chsnqt0, C0, C1, N0, N1); }
 
-    for(; N3 < N0 * N0; N3 += N0, N4 += N0) {
-        const register Complex C2 = Chsnqt0[N3];
-        const register Complex C3 = Chsnqt0[N4];
+/**
+ * @brief Givens Left [Gvl], columns range.
+ * 
+ * @param Chsnqt0 Chsnqt0 Complex Hessenberg Square Matrix [Chsnq], Target [t].
+ * @param C0 Complex Number [C].
+ * @param C1 Complex Number [C].
+ * @param N0 Rows and Columns [N].
+ * @param N1 Index [N].
+ * @param N2 First column [N].
+ * @param N3 Last column, excluded [N].
+ */
+void Gvl_ChsnqtCCNNNN_0(Complex* Chsnqt0, const Complex C0, const Complex C1, const Natural N0, const Natural N1, const Natural N2, const Natural N3) {
+    register Natural N4 = N2 * N0 + N1;
+    register Natural N5 = N4 + 1;
 
-        Chsnqt0[N3] = A_CC_C(M_CcjC_C(C0, C2), M_CcjC_C(C1, C3));
-        Chsnqt0[N4] = S_CC_C(M_CC_C(C0, C3), M_CC_C(C1, C2));
+    for(; N4 < N3 * N0; N4 += N0, N5 += N0) {
+        const register Complex C2 = Chsnqt0[N4];
+        const register Complex C3 = Chsnqt0[N5];
+
+        Chsnqt0[N4] = A_CC_C(M_CcjC_C(C0, C2), M_CcjC_C(C1, C3));
+        Chsnqt0[N5] = S_CC_C(M_CC_C(C0, C3), M_CC_C(C1, C2));
     }
 }
 
@@ -140,17 +101,494 @@ void Gvl_ChsnqtCCNN_0(Complex* Chsnqt0, const Complex C0, const Complex C1, cons
  * @param N0 Rows and Columns [N].
  * @param N1 Index [N].
  */
-void Gvrhr_ChsnqtCCNN_0(Complex* Chsnqt0, const Complex C0, const Complex C1, const Natural N0, const Natural N1) {
-    register Natural N3 = N1 * N0;
-    register Natural N4 = (N1 + 1) * N0;
+void Gvrhr_ChsnqtCCNN_0(Complex* Chsnqt0, const Complex C0, const Complex C1, const Natural N0, const Natural N1) { Gvrhrg_ChsnqtCCNN_0(Chsnqt0, C0, C1, N0, N1); }
+
+/**
+ * @brief Hermitian Givens Right [Gvrtr], rows range.
+ * 
+ * @param Chsnqt0 Chsnqt0 Complex Hessenberg Square Matrix [Chsnq], Target [t].
+ * @param C0 Complex Number [C].
+ * @param C1 Complex Number [C].
+ * @param N0 Rows and Columns [N].
+ * @param N1 Index [N].
+ * @param N2 First row [N].
+ * @param N3 Last row, excluded [N].
+ */
+void Gvrhr_ChsnqtCCNNNN_0(Complex* Chsnqt0, const Complex C0, const Complex C1, const Natural N0, const Natural N1, const Natural N2, const Natural N3) {
+    register Natural N4 = N1 * N0 + N2;
+    register Natural N5 = (N1 + 1) * N0 + N2;
+    const register Natural N6 = N1 * N0 + (N3 < N1 + 2 ? N3 : N1 + 2);
+
+    for(; N4 < N6; ++N4, ++N5) {
+        const register Complex C2 = Chsnqt0[N4];
+        const register Complex C3 = Chsnqt0[N5];
+
+        Chsnqt0[N4] = A_CC_C(M_CC_C(C2, C0), M_CC_C(C3, C1));
+        Chsnqt0[N5] = S_CC_C(M_CCcj_C(C3, C0), M_CCcj_C(C2, C1));
+    }
+}
+
+// Givens sequences.
+
+/**
+ * @brief Column start [Cl].
+ * 
+ * Full storage uses stride N0 and increment 0, compact storage stride 2 and
+ * increment 1.
+ * 
+ * @param N0 Column [N].
+ * @param N1 Stride [N].
+ * @param N2 Stride increment [N].
+ * @return Natural Index [N].
+ */
+static inline Natural Cl_NNN_N(const Natural N0, const Natural N1, const Natural N2) { return N0 * N1 + N2 * (N0 * (N0 - 1) / 2); }
+
+// Givens kernels.
+
+/**
+ * @brief Givens sequence Left [Gvsl], single column, baseline.
+ * 
+ * @param Ccvt0 Complex Column Vector [Ccv], Target [t].
+ * @param Cv0 Complex Vector [Cv], Givens coefficients.
+ * @param N0 First rotation [N].
+ * @param N1 Last rotation, excluded [N].
+ */
+static void Gvslbs_CcvtCvNN_0(Complex* Ccvt0, const Complex* Cv0, const Natural N0, const Natural N1) {
+    register Natural N2 = N0;
+    register Complex C0 = Ccvt0[N0]; // Carried row.
+
+    for(; N2 < N1; ++N2) {
+        const register Complex C1 = Ccvt0[N2 + 1];
+
+        Ccvt0[N2] = A_CC_C(M_CcjC_C(Cv0[2 * N2], C0), M_CcjC_C(Cv0[2 * N2 + 1], C1));
+        C0 = S_CC_C(M_CC_C(Cv0[2 * N2], C1), M_CC_C(Cv0[2 * N2 + 1], C0));
+    }
+
+    Ccvt0[N1] = C0;
+}
+
+/**
+ * @brief Givens sequence Left [Gvsl], column pair, baseline.
+ * 
+ * @param Ccvt0 Complex Column Vector [Ccv], Target [t].
+ * @param Ccvt1 Complex Column Vector [Ccv], Target [t].
+ * @param Cv0 Complex Vector [Cv], Givens coefficients.
+ * @param N0 First rotation [N].
+ * @param N1 Last rotation, excluded [N].
+ */
+static void Gvslbs_CcvtCcvtCvNN_0(Complex* Ccvt0, Complex* Ccvt1, const Complex* Cv0, const Natural N0, const Natural N1) {
+    register Natural N2 = N0;
+    register Complex C0 = Ccvt0[N0], C1 = Ccvt1[N0]; // Carried rows.
+
+    for(; N2 < N1; ++N2) {
+        const register Complex C2 = Cv0[2 * N2], C3 = Cv0[2 * N2 + 1];
+        const register Complex C4 = Ccvt0[N2 + 1], C5 = Ccvt1[N2 + 1];
+
+        Ccvt0[N2] = A_CC_C(M_CcjC_C(C2, C0), M_CcjC_C(C3, C4));
+        Ccvt1[N2] = A_CC_C(M_CcjC_C(C2, C1), M_CcjC_C(C3, C5));
+
+        C0 = S_CC_C(M_CC_C(C2, C4), M_CC_C(C3, C0));
+        C1 = S_CC_C(M_CC_C(C2, C5), M_CC_C(C3, C1));
+    }
+
+    Ccvt0[N1] = C0;
+    Ccvt1[N1] = C1;
+}
+
+/**
+ * @brief Givens sequence Left [Gvsl], single column, FCMA.
+ * 
+ * @param Ccvt0 Complex Column Vector [Ccv], Target [t].
+ * @param Cv0 Complex Vector [Cv], Givens coefficients.
+ * @param N0 First rotation [N].
+ * @param N1 Last rotation, excluded [N].
+ */
+FCM0 static void Gvslfc_CcvtCvNN_0(Complex* Ccvt0, const Complex* Cv0, const Natural N0, const Natural N1) {
+    register Natural N2 = N0;
+    register Complex C0 = Ccvt0[N0]; // Carried row.
+    const register Complex C2 = {0.0, 0.0};
+
+    for(; N2 < N1; ++N2) {
+        const register Complex C1 = Ccvt0[N2 + 1];
+
+        Ccvt0[N2] = Fma_CCcjC_C(Fma_CCcjC_C(C2, Cv0[2 * N2], C0), Cv0[2 * N2 + 1], C1);
+        C0 = Fms_CCC_C(Fma_CCC_C(C2, Cv0[2 * N2], C1), Cv0[2 * N2 + 1], C0);
+    }
+
+    Ccvt0[N1] = C0;
+}
+
+/**
+ * @brief Givens sequence Left [Gvsl], column pair, FCMA.
+ * 
+ * @param Ccvt0 Complex Column Vector [Ccv], Target [t].
+ * @param Ccvt1 Complex Column Vector [Ccv], Target [t].
+ * @param Cv0 Complex Vector [Cv], Givens coefficients.
+ * @param N0 First rotation [N].
+ * @param N1 Last rotation, excluded [N].
+ */
+FCM0 static void Gvslfc_CcvtCcvtCvNN_0(Complex* Ccvt0, Complex* Ccvt1, const Complex* Cv0, const Natural N0, const Natural N1) {
+    register Natural N2 = N0;
+    register Complex C0 = Ccvt0[N0], C1 = Ccvt1[N0]; // Carried rows.
+    const register Complex C6 = {0.0, 0.0};
+
+    for(; N2 < N1; ++N2) {
+        const register Complex C2 = Cv0[2 * N2], C3 = Cv0[2 * N2 + 1];
+        const register Complex C4 = Ccvt0[N2 + 1], C5 = Ccvt1[N2 + 1];
+
+        Ccvt0[N2] = Fma_CCcjC_C(Fma_CCcjC_C(C6, C2, C0), C3, C4);
+        Ccvt1[N2] = Fma_CCcjC_C(Fma_CCcjC_C(C6, C2, C1), C3, C5);
+
+        C0 = Fms_CCC_C(Fma_CCC_C(C6, C2, C4), C3, C0);
+        C1 = Fms_CCC_C(Fma_CCC_C(C6, C2, C5), C3, C1);
+    }
+
+    Ccvt0[N1] = C0;
+    Ccvt1[N1] = C1;
+}
+
+/**
+ * @brief Hermitian Givens sequence Right [Gvsrhr], single row, baseline.
+ * 
+ * @param Crvt0 Complex Row Vector [Crv], Target [t].
+ * @param Cv0 Complex Vector [Cv], Givens coefficients.
+ * @param N0 Stride [N].
+ * @param N1 Stride increment [N].
+ * @param N2 First rotation [N].
+ * @param N3 Last rotation, excluded [N].
+ */
+static void Gvsrhrbs_CrvtCvNNNN_0(Complex* Crvt0, const Complex* Cv0, const Natural N0, const Natural N1, const Natural N2, const Natural N3) {
+    register Natural N4 = N2;
+    register Complex* Crv0 = Crvt0 + Cl_NNN_N(N2, N0, N1);
+    register Complex C0 = *Crv0; // Carried column.
+
+    for(; N4 < N3; ++N4) {
+        Complex* Crv1 = Crv0 + N0 + N1 * N4;
+        const register Complex C1 = *Crv1;
+
+        *Crv0 = A_CC_C(M_CC_C(C0, Cv0[2 * N4]), M_CC_C(C1, Cv0[2 * N4 + 1]));
+        C0 = S_CC_C(M_CCcj_C(C1, Cv0[2 * N4]), M_CCcj_C(C0, Cv0[2 * N4 + 1]));
+
+        Crv0 = Crv1;
+    }
+
+    *Crv0 = C0;
+}
+
+/**
+ * @brief Hermitian Givens sequence Right [Gvsrhr], four rows, baseline.
+ * 
+ * @param Crvt0 Complex Row Vector [Crv], Target [t], first of four contiguous rows.
+ * @param Cv0 Complex Vector [Cv], Givens coefficients.
+ * @param N0 Stride [N].
+ * @param N1 Stride increment [N].
+ * @param N2 First rotation [N].
+ * @param N3 Last rotation, excluded [N].
+ */
+static void Gvsrhr4bs_CrvtCvNNNN_0(Complex* Crvt0, const Complex* Cv0, const Natural N0, const Natural N1, const Natural N2, const Natural N3) {
+    register Natural N4 = N2;
+    register Complex* Crv0 = Crvt0 + Cl_NNN_N(N2, N0, N1);
+    register Complex C0 = Crv0[0], C1 = Crv0[1]; // Carried columns.
+    register Complex C2 = Crv0[2], C3 = Crv0[3];
+
+    for(; N4 < N3; ++N4) {
+        const register Complex C4 = Cv0[2 * N4], C5 = Cv0[2 * N4 + 1];
+        Complex* Crv1 = Crv0 + N0 + N1 * N4;
+
+        const register Complex C6 = Crv1[0], C7 = Crv1[1];
+        const register Complex C8 = Crv1[2], C9 = Crv1[3];
+
+        Crv0[0] = A_CC_C(M_CC_C(C0, C4), M_CC_C(C6, C5));
+        Crv0[1] = A_CC_C(M_CC_C(C1, C4), M_CC_C(C7, C5));
+        Crv0[2] = A_CC_C(M_CC_C(C2, C4), M_CC_C(C8, C5));
+        Crv0[3] = A_CC_C(M_CC_C(C3, C4), M_CC_C(C9, C5));
+
+        C0 = S_CC_C(M_CCcj_C(C6, C4), M_CCcj_C(C0, C5));
+        C1 = S_CC_C(M_CCcj_C(C7, C4), M_CCcj_C(C1, C5));
+        C2 = S_CC_C(M_CCcj_C(C8, C4), M_CCcj_C(C2, C5));
+        C3 = S_CC_C(M_CCcj_C(C9, C4), M_CCcj_C(C3, C5));
+
+        Crv0 = Crv1;
+    }
+
+    Crv0[0] = C0;
+    Crv0[1] = C1;
+    Crv0[2] = C2;
+    Crv0[3] = C3;
+}
+
+/**
+ * @brief Hermitian Givens sequence Right [Gvsrhr], single row, FCMA.
+ * 
+ * @param Crvt0 Complex Row Vector [Crv], Target [t].
+ * @param Cv0 Complex Vector [Cv], Givens coefficients.
+ * @param N0 Stride [N].
+ * @param N1 Stride increment [N].
+ * @param N2 First rotation [N].
+ * @param N3 Last rotation, excluded [N].
+ */
+FCM0 static void Gvsrhrfc_CrvtCvNNNN_0(Complex* Crvt0, const Complex* Cv0, const Natural N0, const Natural N1, const Natural N2, const Natural N3) {
+    register Natural N4 = N2;
+    register Complex* Crv0 = Crvt0 + Cl_NNN_N(N2, N0, N1);
+    register Complex C0 = *Crv0; // Carried column.
+    const register Complex C2 = {0.0, 0.0};
+
+    for(; N4 < N3; ++N4) {
+        Complex* Crv1 = Crv0 + N0 + N1 * N4;
+        const register Complex C1 = *Crv1;
+
+        *Crv0 = Fma_CCC_C(Fma_CCC_C(C2, C0, Cv0[2 * N4]), C1, Cv0[2 * N4 + 1]);
+        C0 = Fms_CCcjC_C(Fma_CCcjC_C(C2, Cv0[2 * N4], C1), Cv0[2 * N4 + 1], C0);
+
+        Crv0 = Crv1;
+    }
+
+    *Crv0 = C0;
+}
+
+/**
+ * @brief Hermitian Givens sequence Right [Gvsrhr], four rows, FCMA.
+ * 
+ * @param Crvt0 Complex Row Vector [Crv], Target [t], first of four contiguous rows.
+ * @param Cv0 Complex Vector [Cv], Givens coefficients.
+ * @param N0 Stride [N].
+ * @param N1 Stride increment [N].
+ * @param N2 First rotation [N].
+ * @param N3 Last rotation, excluded [N].
+ */
+FCM0 static void Gvsrhr4fc_CrvtCvNNNN_0(Complex* Crvt0, const Complex* Cv0, const Natural N0, const Natural N1, const Natural N2, const Natural N3) {
+    register Natural N4 = N2;
+    register Complex* Crv0 = Crvt0 + Cl_NNN_N(N2, N0, N1);
+    register Complex C0 = Crv0[0], C1 = Crv0[1]; // Carried columns.
+    register Complex C2 = Crv0[2], C3 = Crv0[3];
+    const register Complex C10 = {0.0, 0.0};
+
+    for(; N4 < N3; ++N4) {
+        const register Complex C4 = Cv0[2 * N4], C5 = Cv0[2 * N4 + 1];
+        Complex* Crv1 = Crv0 + N0 + N1 * N4;
+
+        const register Complex C6 = Crv1[0], C7 = Crv1[1];
+        const register Complex C8 = Crv1[2], C9 = Crv1[3];
+
+        Crv0[0] = Fma_CCC_C(Fma_CCC_C(C10, C0, C4), C6, C5);
+        Crv0[1] = Fma_CCC_C(Fma_CCC_C(C10, C1, C4), C7, C5);
+        Crv0[2] = Fma_CCC_C(Fma_CCC_C(C10, C2, C4), C8, C5);
+        Crv0[3] = Fma_CCC_C(Fma_CCC_C(C10, C3, C4), C9, C5);
+
+        C0 = Fms_CCcjC_C(Fma_CCcjC_C(C10, C4, C6), C5, C0);
+        C1 = Fms_CCcjC_C(Fma_CCcjC_C(C10, C4, C7), C5, C1);
+        C2 = Fms_CCcjC_C(Fma_CCcjC_C(C10, C4, C8), C5, C2);
+        C3 = Fms_CCcjC_C(Fma_CCcjC_C(C10, C4, C9), C5, C3);
+
+        Crv0 = Crv1;
+    }
+
+    Crv0[0] = C0;
+    Crv0[1] = C1;
+    Crv0[2] = C2;
+    Crv0[3] = C3;
+}
+
+// Kernels' selection.
+
+static void (*Kn0)(Complex*, const Complex*, const Natural, const Natural) = Gvslbs_CcvtCvNN_0; // Givens sequence Left, single column.
+static void (*Kn1)(Complex*, Complex*, const Complex*, const Natural, const Natural) = Gvslbs_CcvtCcvtCvNN_0; // Givens sequence Left, column pair.
+static void (*Kn2)(Complex*, const Complex*, const Natural, const Natural, const Natural, const Natural) = Gvsrhrbs_CrvtCvNNNN_0; // Hermitian Givens sequence Right, single row.
+static void (*Kn3)(Complex*, const Complex*, const Natural, const Natural, const Natural, const Natural) = Gvsrhr4bs_CrvtCvNNNN_0; // Hermitian Givens sequence Right, four rows.
+
+/**
+ * @brief Kernels' selection [Krn], at load time.
+ */
+__attribute__((constructor)) static void Krn_0_0(void) {
+    if(Krn_0_N() != KRN_FCMA) return;
+
+    Kn0 = Gvslfc_CcvtCvNN_0;
+    Kn1 = Gvslfc_CcvtCcvtCvNN_0;
+    Kn2 = Gvsrhrfc_CrvtCvNNNN_0;
+    Kn3 = Gvsrhr4fc_CrvtCvNNNN_0;
+}
+
+/**
+ * @brief Givens sequence Left [Gvsl], any storage.
+ * 
+ * @param Cmt0 Complex Matrix [Cm], Target [t].
+ * @param Cv0 Complex Vector [Cv], Givens coefficients.
+ * @param N0 Stride [N].
+ * @param N1 Stride increment [N].
+ * @param N2 First rotation [N].
+ * @param N3 Last rotation, excluded [N].
+ * @param N4 First column [N].
+ * @param N5 Last column, excluded [N].
+ * @param N6 Offset [N].
+ */
+static void Gvsl_CmtCvNNNNNNN_0(Complex* Cmt0, const Complex* Cv0, const Natural N0, const Natural N1, const Natural N2, const Natural N3, const Natural N4, const Natural N5, const Natural N6) {
+    register Natural N7 = N4, N8, N9;
+
+    for(; N7 < N5; N7 += 2) {
+        N8 = N7 + 1 < N6 ? 0 : N7 + 1 - N6; if(N8 > N3) N8 = N3; // Column N7.
+        N9 = N7 + 2 < N6 ? 0 : N7 + 2 - N6; if(N9 > N3) N9 = N3; // Column N7 + 1.
+
+        Complex* Ccv0 = Cmt0 + Cl_NNN_N(N7, N0, N1);
+
+        if(N7 + 1 == N5) { // Last column.
+            if(N8 > N2) Kn0(Ccv0, Cv0, N2, N8);
+            break;
+        }
+
+        Complex* Ccv1 = Ccv0 + N0 + N1 * N7;
+
+        if(N8 > N2) Kn1(Ccv0, Ccv1, Cv0, N2, N8);
+        if(N9 > N2 && N9 > N8) Kn0(Ccv1, Cv0, N8 > N2 ? N8 : N2, N9);
+    }
+}
+
+/**
+ * @brief Givens sequence Left [Gvsl].
+ * 
+ * Rotation k reaches column j only if k + N5 <= j. Each column slice is
+ * loaded once for the whole sequence.
+ * 
+ * @param Chsnqt0 Complex Hessenberg Square Matrix [Chsnq], Target [t].
+ * @param Cv0 Complex Vector [Cv], Givens coefficients.
+ * @param N0 Rows and Columns [N].
+ * @param N1 First rotation [N].
+ * @param N2 Last rotation, excluded [N].
+ * @param N3 First column [N].
+ * @param N4 Last column, excluded [N].
+ * @param N5 Offset [N].
+ */
+void Gvsl_ChsnqtCvNNNNNN_0(Complex* Chsnqt0, const Complex* Cv0, const Natural N0, const Natural N1, const Natural N2, const Natural N3, const Natural N4, const Natural N5) {
+    Gvsl_CmtCvNNNNNNN_0(Chsnqt0, Cv0, N0, 0, N1, N2, N3, N4, N5);
+}
+
+/**
+ * @brief Givens sequence Left [Gvsl], compact storage.
+ * 
+ * @param Chct0 Complex Hessenberg Compact Matrix [Chc], Target [t].
+ * @param Cv0 Complex Vector [Cv], Givens coefficients.
+ * @param N0 First rotation [N].
+ * @param N1 Last rotation, excluded [N].
+ * @param N2 First column [N].
+ * @param N3 Last column, excluded [N].
+ * @param N4 Offset [N], at least 1.
+ */
+void Gvsl_ChctCvNNNNN_0(Complex* Chct0, const Complex* Cv0, const Natural N0, const Natural N1, const Natural N2, const Natural N3, const Natural N4) {
+    Gvsl_CmtCvNNNNNNN_0(Chct0, Cv0, 2, 1, N0, N1, N2, N3, N4);
+}
+
+/**
+ * @brief Hermitian Givens sequence Right [Gvsrhr], any storage.
+ * 
+ * @param Cmt0 Complex Matrix [Cm], Target [t].
+ * @param Cv0 Complex Vector [Cv], Givens coefficients.
+ * @param N0 Stride [N].
+ * @param N1 Stride increment [N].
+ * @param N2 First rotation [N].
+ * @param N3 Last rotation, excluded [N].
+ * @param N4 First row [N].
+ * @param N5 Last row, excluded [N].
+ */
+static void Gvsrhr_CmtCvNNNNNN_0(Complex* Cmt0, const Complex* Cv0, const Natural N0, const Natural N1, const Natural N2, const Natural N3, const Natural N4, const Natural N5) {
+    register Natural N6 = N4, N7, N8;
+
+    for(; N6 + 3 < N5; N6 += 4) {
+        N7 = N6 + 2 > N2 ? N6 + 2 : N2; if(N7 > N3) N7 = N3; // Common first rotation.
+
+        for(N8 = 0; N8 < 3; ++N8) { // Leading rotations.
+            const register Natural N9 = N6 + N8 > N2 ? N6 + N8 - 1 : N2;
+            if(N9 < N7) Kn2(Cmt0 + N6 + N8, Cv0, N0, N1, N9, N7);
+        }
+
+        if(N7 < N3) Kn3(Cmt0 + N6, Cv0, N0, N1, N7, N3);
+    }
+
+    for(; N6 < N5; ++N6) { // Remaining rows.
+        N7 = N6 > N2 ? N6 - 1 : N2;
+        if(N7 < N3) Kn2(Cmt0 + N6, Cv0, N0, N1, N7, N3);
+    }
+}
+
+/**
+ * @brief Hermitian Givens sequence Right [Gvsrhr].
+ * 
+ * Rotation k reaches row i only if i <= k + 1. Rows are swept four at a time
+ * along the sequence, each entry being loaded once.
+ * 
+ * @param Chsnqt0 Complex Hessenberg Square Matrix [Chsnq], Target [t].
+ * @param Cv0 Complex Vector [Cv], Givens coefficients.
+ * @param N0 Rows and Columns [N].
+ * @param N1 First rotation [N].
+ * @param N2 Last rotation, excluded [N].
+ * @param N3 First row [N].
+ * @param N4 Last row, excluded [N].
+ */
+void Gvsrhr_ChsnqtCvNNNNN_0(Complex* Chsnqt0, const Complex* Cv0, const Natural N0, const Natural N1, const Natural N2, const Natural N3, const Natural N4) {
+    Gvsrhr_CmtCvNNNNNN_0(Chsnqt0, Cv0, N0, 0, N1, N2, N3, N4);
+}
+
+/**
+ * @brief Hermitian Givens sequence Right [Gvsrhr], compact storage.
+ * 
+ * @param Chct0 Complex Hessenberg Compact Matrix [Chc], Target [t].
+ * @param Cv0 Complex Vector [Cv], Givens coefficients.
+ * @param N0 First rotation [N].
+ * @param N1 Last rotation, excluded [N].
+ * @param N2 First row [N].
+ * @param N3 Last row, excluded [N].
+ */
+void Gvsrhr_ChctCvNNNN_0(Complex* Chct0, const Complex* Cv0, const Natural N0, const Natural N1, const Natural N2, const Natural N3) {
+    Gvsrhr_CmtCvNNNNNN_0(Chct0, Cv0, 2, 1, N0, N1, N2, N3);
+}
+
+/**
+ * @brief Hermitian Givens sequence Right [Gvsrhr], dense.
+ * 
+ * Every row takes the whole sequence, as for accumulated transformations.
+ * 
+ * @param Cqt0 Complex Square Matrix [Cq], Target [t].
+ * @param Cv0 Complex Vector [Cv], Givens coefficients.
+ * @param N0 Rows and Columns [N].
+ * @param N1 Last rotation, excluded [N].
+ */
+static void Gvsrhr_CqtCvNN_0(Complex* Cqt0, const Complex* Cv0, const Natural N0, const Natural N1) {
+    register Natural N2 = 0;
+
+    for(; N2 + 3 < N0; N2 += 4)
+        Kn3(Cqt0 + N2, Cv0, N0, 0, 0, N1);
+
+    for(; N2 < N0; ++N2)
+        Kn2(Cqt0 + N2, Cv0, N0, 0, 0, N1);
+}
+
+// Compact storage.
 
-    for(; N3 < N1 * (N0 + 1) + 2; ++N3, ++N4) {
-        const register Complex C2 = Chsnqt0[N3];
-        const register Complex C3 = Chsnqt0[N4];
+/**
+ * @brief Compact [Cpt], in place.
+ * 
+ * @param Chsnqt0 Complex Hessenberg Square Matrix [Chsnq], Target [t].
+ * @param N0 Rows and Columns [N].
+ */
+void Cpt_ChsnqtN_0(Complex* Chsnqt0, const Natural N0) {
+    for(register Natural N1 = 1; N1 < N0; ++N1)
+        memmove(Chsnqt0 + Cx_NN_N(0, N1), Chsnqt0 + N1 * N0, (N1 + 2 < N0 ? N1 + 2 : N0) * sizeof(Complex));
+}
 
-        Chsnqt0[N3] = A_CC_C(M_CC_C(C2, C0), M_CC_C(C3, C1));
-        Chsnqt0[N4] = S_CC_C(M_CCcj_C(C3, C0), M_CCcj_C(C2, C1));
+/**
+ * @brief Expand [Xpd], in place, restoring the zeros below the subdiagonal.
+ * 
+ * @param Chct0 Complex Hessenberg Compact Matrix [Chc], Target [t], with room for N0 * N0 entries.
+ * @param N0 Rows and Columns [N].
+ */
+void Xpd_ChctN_0(Complex* Chct0, const Natural N0) {
+    for(register Natural N1 = N0; N1-- > 1;) {
+        memmove(Chct0 + N1 * N0, Chct0 + Cx_NN_N(0, N1), (N1 + 2 < N0 ? N1 + 2 : N0) * sizeof(Complex));
+
+        for(register Natural N2 = N1 + 2; N2 < N0; ++N2)
+            Chct0[N1 * N0 + N2] = C_R_C(0.0);
     }
+
+    for(register Natural N1 = 2; N1 < N0; ++N1)
+        Chct0[N1] = C_R_C(0.0);
 }
 
 // Hessenberg form.
@@ -161,10 +599,19 @@ void Gvrhr_ChsnqtCCNN_0(Complex* Chsnqt0, const Complex C0, const Complex C1, co
  * @param Cqt0 Complex Sqaure Matrix [Cq], Target [t].
  * @param N0 Rows and Columns [N].
  */
-void Hsn_CqtN_0(Complex* Cqt0, const Natural N0) {
+void Hsn_CqtN_0(Complex* Cqt0, const Natural N0) { Hsn_CqtCqtN_0(Cqt0, NULL, N0); }
+
+/**
+ * @brief Hessenberg form [Hsn], transformations accumulated.
+ * 
+ * @param Cqt0 Complex Sqaure Matrix [Cq], Target [t].
+ * @param Cqt1 Complex Sqaure Matrix [Cq], Target [t], multiplied on the right by the reflectors, NULL for none.
+ * @param N0 Rows and Columns [N].
+ */
+void Hsn_CqtCqtN_0(Complex* Cqt0, Complex* Cqt1, const Natural N0) {
     register Natural N1 = 0;
-    register Complex* Cv0 = (Complex*) calloc(N0, sizeof(Complex));
-    register Complex* Cv1 = (Complex*) calloc(N0 - 2, sizeof(Complex)); // Zeros.
+    register Complex* Cv0 = (Complex*) Calc_NN_P(N0, sizeof(Complex));
+    register Complex* Cv1 = (Complex*) Calc_NN_P(N0 - 2, sizeof(Complex)); // Zeros.
 
     for(; N1 < N0 - 2; ++N1) {
 
@@ -173,7 +620,12 @@ void Hsn_CqtN_0(Complex* Cqt0, const Natural N0) {
         // Householder vector.
 
         Cp_CvtCvN_0(Cv0 + N1 + 1, Cqt0 + N1 * (N0 + 1) + 1, N3); // Copy.
-        Cv0[N1 + 1] = S_CC_C(Cv0[N1 + 1], M_CR_C(Nzd2_C_C(Cv0[N1 + 1]), N2_CvN_R(Cv0 + N1 + 1, N3))); // Direction.
+
+        const register Real R0 = N2_CvN_R(Cv0 + N1 + 1, N3);
+        if(R0 == 0.0) continue; // Reduced column.
+
+        // Direction, any phase for a zero leading entry.
+        Cv0[N1 + 1] = A_CC_C(Cv0[N1 + 1], M_CR_C(N2_C_R(Cv0[N1 + 1]) > 0.0 ? Nzd2_C_C(Cv0[N1 + 1]) : C_R_C(1.0), R0));
         Nz2_CvN_0(Cv0 + N1 + 1, N3); // Normalization.
 
         // Householder products.
@@ -181,13 +633,15 @@ void Hsn_CqtN_0(Complex* Cqt0, const Natural N0) {
         Hsl_CqtCvNN_0(Cqt0, Cv0, N0, N3);
         Hsr_CqtCvNN_0(Cqt0, Cv0, N0, N3);
 
+        if(Cqt1 != NULL) Hsr_CqtCvNN_0(Cqt1, Cv0, N0, N3); // Accumulation.
+
         // Zeroing.
 
         Cp_CvtCvN_0(Cqt0 + N1 * (N0 + 1) + 2, Cv1, N0 - N1 - 2);
     }
 
-    free(Cv0);
-    free(Cv1);
+    Fr_P_0(Cv0);
+    Fr_P_0(Cv1);
 }
 
 // QR algorithm.
@@ -216,63 +670,732 @@ void Hsn_CqtN_0(Complex* Cqt0, const Natural N0) {
 }
 
 /**
- * @brief Eigenvalues [Eig].
+ * @brief Shifted QR step [Qrs], any storage.
+ * 
+ * @param Cmt0 Complex Matrix [Cm], Target [t].
+ * @param Cvt0 Complex Vector [Cv], Target [t], Givens coefficients.
+ * @param C0 Complex Number [C], Shift.
+ * @param N0 Rows and Columns [N].
+ * @param N1 Last active index [N].
+ * @param N2 Stride [N].
+ * @param N3 Stride increment [N].
+ */
+static void Qrs_CmtCvtCNNNN_0(Complex* Cmt0, Complex* Cvt0, const Complex C0, const Natural N0, const Natural N1, const Natural N2, const Natural N3) {
+    register Natural N4, N5, N6;
+    const register Natural N7 = Tn_0_Tn().N1; // Rotations per block.
+    register Real R0;
+
+    for(N4 = 0; N4 < N1 + 1; ++N4) // Shift (-).
+        Cmt0[Cl_NNN_N(N4, N2, N3) + N4] = S_CC_C(Cmt0[Cl_NNN_N(N4, N2, N3) + N4], C0);
+
+    for(N4 = 0; N4 < N1; N4 = N5) { // QR, N7 rotations at a time.
+        N5 = N4 + N7 < N1 ? N4 + N7 : N1;
+
+        for(N6 = N4; N6 < N5; ++N6) {
+            Complex* Ccv0 = Cmt0 + Cl_NNN_N(N6, N2, N3);
+
+            if(N6 > N4) Kn0(Ccv0, Cvt0, N4, N6); // Pending rotations.
+
+            Cp_CvtCvN_0(Cvt0 + 2 * N6, Ccv0 + N6, 2); // Copy.
+
+            R0 = N2_CvN_R(Cvt0 + 2 * N6, 2); // Norm.
+            D_CvR_0(Cvt0 + 2 * N6, R0, 2); // Normalization.
+
+            // First product.
+            Ccv0[N6] = C_R_C(R0);
+            Ccv0[N6 + 1] = C_R_C(0.0);
+        }
+
+        // Other products.
+        Gvsl_CmtCvNNNNNNN_0(Cmt0, Cvt0, N2, N3, N4, N5, N5, N0, 1);
+    }
+
+    // RQ.
+    Gvsrhr_CmtCvNNNNNN_0(Cmt0, Cvt0, N2, N3, 0, N1, 0, N1 + 1);
+
+    for(N4 = 0; N4 < N1 + 1; ++N4) // Shift (+).
+        Cmt0[Cl_NNN_N(N4, N2, N3) + N4] = A_CC_C(Cmt0[Cl_NNN_N(N4, N2, N3) + N4], C0);
+}
+
+/**
+ * @brief Shifted QR step [Qrs].
  * 
  * @param Chsnqt0 Complex Hessenberg Square Matrix [Chsnq], Target [t].
+ * @param Cvt0 Complex Vector [Cv], Target [t], Givens coefficients.
+ * @param C0 Complex Number [C], Shift.
  * @param N0 Rows and Columns [N].
+ * @param N1 Last active index [N].
  */
-void Eig_ChsnqtN_0(Complex *Chsnqt0, const Natural N0) {
-    register Complex* Cv0 = (Complex*) calloc(2 * (N0 - 1), sizeof(Complex));
-    register Complex* Cv1 = (Complex*) calloc(2, sizeof(Complex));
+void Qrs_ChsnqtCvtCNN_0(Complex* Chsnqt0, Complex* Cvt0, const Complex C0, const Natural N0, const Natural N1) {
+    Qrs_CmtCvtCNNNN_0(Chsnqt0, Cvt0, C0, N0, N1, N0, 0);
+}
 
-    register Natural N1 = 0, N2, N3 = N0 - 1, N4;
-    register Real R0;
+/**
+ * @brief Shifted QR step [Qrs], compact storage.
+ * 
+ * @param Chct0 Complex Hessenberg Compact Matrix [Chc], Target [t].
+ * @param Cvt0 Complex Vector [Cv], Target [t], Givens coefficients.
+ * @param C0 Complex Number [C], Shift.
+ * @param N0 Rows and Columns [N].
+ * @param N1 Last active index [N].
+ */
+void Qrs_ChctCvtCNN_0(Complex* Chct0, Complex* Cvt0, const Complex C0, const Natural N0, const Natural N1) {
+    Qrs_CmtCvtCNNNN_0(Chct0, Cvt0, C0, N0, N1, 2, 1);
+}
+
+/**
+ * @brief Eigenvalues [Eig], any storage, streamed, within a budget.
+ * 
+ * Each eigenvalue is handed to the callback, if any, as soon as it deflates.
+ * Each iteration is a single step shifted by the root of the trailing 2 x 2
+ * block closest to its last entry, Wilkinson's shift. An exceptional shift
+ * replaces it every EXC0 steps without deflation. Warm shifts, if any, open
+ * each index with two steps.
+ * 
+ * @param Cmt0 Complex Matrix [Cm], Target [t].
+ * @param Cvt0 Complex Vector [Cv], Target [t], previous eigenvalues by index, replaced by the new ones, NULL for none.
+ * @param Cqt0 Complex Square Matrix [Cq], Target [t], multiplied on the right by the rotations, NULL for none.
+ * @param Df0 Deflation callback [Df], NULL for none.
+ * @param P0 Callback's data.
+ * @param Bg0 Budget [Bg], NULL for none.
+ * @param N0 Rows and Columns [N].
+ * @param N1 Stride [N].
+ * @param N2 Stride increment [N].
+ * @return Natural Status [N], the eigenvalues below the last deflation having converged otherwise.
+ */
+static Natural Eig_CmtCvtCqtDfPBgNNN_N(Complex* Cmt0, Complex* Cvt0, Complex* Cqt0, const Deflation Df0, void* P0, const Budget* Bg0, const Natural N0, const Natural N1, const Natural N2) {
+    register Complex* Cv0 = (Complex*) Calc_NN_P(2 * (N0 - 1), sizeof(Complex));
+    register Complex C0; // Shift.
+
+    register Natural N3 = 0, N4 = N0 - 1, N5, N6, N7, N8 = STS_CONVERGED, N9 = 0;
+    const register Real R0 = Bg0 != NULL && Bg0->R0 > 0.0 ? Tm_0_R() : 0.0; // Start.
 
     #ifndef NVERBOSE
     printf("--- QR Algorithm\n");
     #endif
 
-    for(; N1 < ITM0; ++N1) {
+    for(;; ++N3) {
+
+        if(N4 == 0) break; // Stop.
+        if((N8 = Chk_BgRN_N(Bg0, R0, N3)) != STS_CONVERGED) break; // Budget.
+
+        N6 = Cl_NNN_N(N4 - 1, N1, N2) + N4 - 1; // Entry (N4 - 1, N4 - 1).
+        N7 = Cl_NNN_N(N4, N1, N2) + N4; // Entry (N4, N4).
+
+        if(N2_C_R(Cmt0[N6 + 1]) <= TOL0) { // Deflation.
+            if(Df0 != NULL && !Df0(N4, Cmt0[N7], N3, P0)) { N8 = STS_CANCELLED; break; }
+            if(Cvt0 != NULL) Wrm_CvtCN_0(Cvt0, Cmt0[N7], N4);
 
-        if(N3 == 0) break; // Stop.
-        if(N2_C_R(Chsnqt0[(N3 - 1) * (N0 + 1) + 1]) <= TOL0) { --N3; continue; } // Deflation.
+            --N4;
+            N9 = 0;
+            continue;
+        }
+
+        N5 = 1; // Steps.
+
+        if(++N9 % EXC0 == 0) // Exceptional shift.
+            C0 = A_CC_C(Cmt0[N7], C_R_C(0.75 * N2_C_R(Cmt0[N6 + 1])));
+        else if(Cvt0 != NULL && N9 == 1) { // Warm shift, twice.
+            C0 = Cvt0[N4];
+            N5 = 2;
+        } else {
+            register Complex* Cv2 = Eig_CCCC_C(Cmt0[N6], Cmt0[N7 - 1], Cmt0[N6 + 1], Cmt0[N7]); // Wilkinson's shift, the closest root.
+            C0 = N2_C_R(S_CC_C(Cv2[0], Cmt0[N7])) <= N2_C_R(S_CC_C(Cv2[1], Cmt0[N7])) ? Cv2[0] : Cv2[1];
+            Fr_P_0(Cv2);
+        }
+
+        for(; N5 > 0; --N5) {
+            Qrs_CmtCvtCNNNN_0(Cmt0, Cv0, C0, N0, N4, N1, N2);
+            if(Cqt0 != NULL) Gvsrhr_CqtCvNN_0(Cqt0, Cv0, N0, N4); // Accumulation.
+        }
+    }
 
-        *Cv1 = *Eig_CCCC_C(Chsnqt0[(N3 - 1) * (N0 + 1)], Chsnqt0[N3 * N0 + N3 - 1], Chsnqt0[(N3 - 1) * (N0 + 1) + 1], Chsnqt0[N3 * (N0 + 1)]); // Double Wilkinson's shift.
+    #ifndef NVERBOSE
+    printf("Exited after %zu iterations.\n", N3 + 1);
+    printf("---\n");
+    #endif
+
+    if(N8 == STS_CONVERGED && Df0 != NULL) // Last eigenvalue.
+        Df0(0, Cmt0[0], N3, P0);
+
+    if(N8 == STS_CONVERGED && Cvt0 != NULL)
+        *Cvt0 = Cmt0[0];
+
+    Fr_P_0(Cv0);
+
+    return N8;
+}
+
+/**
+ * @brief Eigenvalues [Eig].
+ * 
+ * @param Chsnqt0 Complex Hessenberg Square Matrix [Chsnq], Target [t].
+ * @param N0 Rows and Columns [N].
+ */
+void Eig_ChsnqtN_0(Complex *Chsnqt0, const Natural N0) {
+    Eig_CmtCvtCqtDfPBgNNN_N(Chsnqt0, NULL, NULL, NULL, NULL, NULL, N0, N0, 0);
+}
 
-        for(N4 = 0; N4 < 2; ++N4) { // Double shift.
+/**
+ * @brief Schur form [Eig], Schur vectors accumulated.
+ * 
+ * @param Chsnqt0 Complex Hessenberg Square Matrix [Chsnq], Target [t], upper triangular up to the deflated subdiagonal on exit.
+ * @param Cqt0 Complex Square Matrix [Cq], Target [t], multiplied on the right by the rotations.
+ * @param N0 Rows and Columns [N].
+ */
+void Eig_ChsnqtCqtN_0(Complex* Chsnqt0, Complex* Cqt0, const Natural N0) {
+    Eig_CmtCvtCqtDfPBgNNN_N(Chsnqt0, NULL, Cqt0, NULL, NULL, NULL, N0, N0, 0);
+}
+
+/**
+ * @brief Eigenvalues [Eig], compact storage.
+ * 
+ * @param Chct0 Complex Hessenberg Compact Matrix [Chc], Target [t].
+ * @param N0 Rows and Columns [N].
+ */
+void Eig_ChctN_0(Complex* Chct0, const Natural N0) {
+    Eig_CmtCvtCqtDfPBgNNN_N(Chct0, NULL, NULL, NULL, NULL, NULL, N0, 2, 1);
+}
+
+/**
+ * @brief Eigenvalues [Eig], streamed, within a budget.
+ * 
+ * @param Chsnqt0 Complex Hessenberg Square Matrix [Chsnq], Target [t].
+ * @param Df0 Deflation callback [Df], NULL for none.
+ * @param P0 Callback's data.
+ * @param Bg0 Budget [Bg], NULL for none.
+ * @param N0 Rows and Columns [N].
+ * @return Natural Status [N].
+ */
+Natural Eig_ChsnqtDfPBgN_N(Complex* Chsnqt0, const Deflation Df0, void* P0, const Budget* Bg0, const Natural N0) {
+    return Eig_CmtCvtCqtDfPBgNNN_N(Chsnqt0, NULL, NULL, Df0, P0, Bg0, N0, N0, 0);
+}
+
+/**
+ * @brief Eigenvalues [Eig], compact storage, streamed, within a budget.
+ * 
+ * @param Chct0 Complex Hessenberg Compact Matrix [Chc], Target [t].
+ * @param Df0 Deflation callback [Df], NULL for none.
+ * @param P0 Callback's data.
+ * @param Bg0 Budget [Bg], NULL for none.
+ * @param N0 Rows and Columns [N].
+ * @return Natural Status [N].
+ */
+Natural Eig_ChctDfPBgN_N(Complex* Chct0, const Deflation Df0, void* P0, const Budget* Bg0, const Natural N0) {
+    return Eig_CmtCvtCqtDfPBgNNN_N(Chct0, NULL, NULL, Df0, P0, Bg0, N0, 2, 1);
+}
+
+/**
+ * @brief Eigenvalues [Eig], compact storage, warm-started, streamed, within a budget.
+ * 
+ * @param Chct0 Complex Hessenberg Compact Matrix [Chc], Target [t].
+ * @param Cvt0 Complex Vector [Cv], Target [t], previous eigenvalues by index, replaced by the new ones.
+ * @param Df0 Deflation callback [Df], NULL for none.
+ * @param P0 Callback's data.
+ * @param Bg0 Budget [Bg], NULL for none.
+ * @param N0 Rows and Columns [N].
+ * @return Natural Status [N].
+ */
+Natural Eig_ChctCvtDfPBgN_N(Complex* Chct0, Complex* Cvt0, const Deflation Df0, void* P0, const Budget* Bg0, const Natural N0) {
+    return Eig_CmtCvtCqtDfPBgNNN_N(Chct0, Cvt0, NULL, Df0, P0, Bg0, N0, 2, 1);
+}
 
-            for(N2 = 0; N2 < N3 + 1; ++N2) // Shift (-).
-                Chsnqt0[N2 * (N0 + 1)] = S_CC_C(Chsnqt0[N2 * (N0 + 1)], Cv1[N4]);
+// Warm start.
 
-            for(N2 = 0; N2 < N3; ++N2) { // QR.
-                Cp_CvtCvN_0(Cv0 + 2 * N2, Chsnqt0 + N2 * (N0 + 1), 2); // Copy.
+/**
+ * @brief Warm start [Wrm], deflation bookkeeping.
+ * 
+ * The nearest previous eigenvalue at or below index N0 is swapped out for the
+ * new one at N0, so that the entries below N0 are always the unused previous
+ * eigenvalues and entry N0 - 1 is the next warm shift.
+ * 
+ * @param Cvt0 Complex Vector [Cv], Target [t], eigenvalues by index.
+ * @param C0 Complex Number [C], deflated eigenvalue.
+ * @param N0 Index [N].
+ */
+void Wrm_CvtCN_0(Complex* Cvt0, const Complex C0, const Natural N0) {
+    register Natural N1 = 0, N2 = N0;
+    register Real R0 = INFINITY, R1;
+
+    for(; N1 <= N0; ++N1) // Nearest.
+        if((R1 = N2_C_R(S_CC_C(Cvt0[N1], C0))) < R0) {
+            R0 = R1;
+            N2 = N1;
+        }
 
-                R0 = N2_CvN_R(Cv0 + 2 * N2, 2); // Norm.
-                D_CvR_0(Cv0 + 2 * N2, R0, 2); // Normalization.
+    Cvt0[N2] = Cvt0[N0];
+    Cvt0[N0] = C0;
+}
 
-                // First product.
-                Chsnqt0[N2 * (N0 + 1)] = C_R_C(R0);
-                Chsnqt0[N2 * (N0 + 1) + 1] = C_R_C(0.0);
+// Refinement.
 
-                // Other products.
-                Gvl_ChsnqtCCNN_0(Chsnqt0, Cv0[2 * N2], Cv0[2 * N2 + 1], N0, N2);
+/**
+ * @brief Hessenberg solve [Slv], partial pivoting.
+ * 
+ * @param Chsnqt0 Complex Hessenberg Square Matrix [Chsnq], Target [t], overwritten.
+ * @param Cvt0 Complex Vector [Cv], Target [t], right-hand side and solution.
+ * @param N0 Rows and Columns [N].
+ */
+void Slv_ChsnqtCvtN_0(Complex* Chsnqt0, Complex* Cvt0, const Natural N0) {
+    register Natural N1 = 0, N2;
+    register Complex C0, C1;
+
+    for(; N1 + 1 < N0; ++N1) { // Elimination.
+        if(N2_C_R(Chsnqt0[N1 * (N0 + 1) + 1]) > N2_C_R(Chsnqt0[N1 * (N0 + 1)])) { // Pivoting.
+            for(N2 = N1; N2 < N0; ++N2) {
+                C0 = Chsnqt0[N2 * N0 + N1];
+                Chsnqt0[N2 * N0 + N1] = Chsnqt0[N2 * N0 + N1 + 1];
+                Chsnqt0[N2 * N0 + N1 + 1] = C0;
             }
 
-            for(N2 = 0; N2 < N3; ++N2) // RQ.
-                Gvrhr_ChsnqtCCNN_0(Chsnqt0, Cv0[2 * N2], Cv0[2 * N2 + 1], N0, N2);
+            C0 = Cvt0[N1]; Cvt0[N1] = Cvt0[N1 + 1]; Cvt0[N1 + 1] = C0;
+        }
+
+        if(N2_C_R(Chsnqt0[N1 * (N0 + 1)]) <= TOL1) Chsnqt0[N1 * (N0 + 1)] = C_R_C(TOL1); // Singular pivot.
+
+        C1 = D_CC_C(Chsnqt0[N1 * (N0 + 1) + 1], Chsnqt0[N1 * (N0 + 1)]); // Multiplier.
+
+        for(N2 = N1 + 1; N2 < N0; ++N2)
+            Chsnqt0[N2 * N0 + N1 + 1] = S_CC_C(Chsnqt0[N2 * N0 + N1 + 1], M_CC_C(C1, Chsnqt0[N2 * N0 + N1]));
+
+        Cvt0[N1 + 1] = S_CC_C(Cvt0[N1 + 1], M_CC_C(C1, Cvt0[N1]));
+    }
 
-            for(N2 = 0; N2 < N3 + 1; ++N2) // Shift (+).
-                Chsnqt0[N2 * (N0 + 1)] = A_CC_C(Chsnqt0[N2 * (N0 + 1)], Cv1[N4]);
+    if(N2_C_R(Chsnqt0[N0 * N0 - 1]) <= TOL1) Chsnqt0[N0 * N0 - 1] = C_R_C(TOL1); // Singular pivot.
+
+    for(N1 = N0; N1 > 0; --N1) { // Back substitution, by columns.
+        Cvt0[N1 - 1] = D_CC_C(Cvt0[N1 - 1], Chsnqt0[(N1 - 1) * (N0 + 1)]);
+
+        for(N2 = 0; N2 < N1 - 1; ++N2)
+            Cvt0[N2] = S_CC_C(Cvt0[N2], M_CC_C(Chsnqt0[(N1 - 1) * N0 + N2], Cvt0[N1 - 1]));
+    }
+}
+
+/**
+ * @brief Shifted copy [Shf], the Hessenberg part only.
+ * 
+ * @param Chsnq0 Complex Hessenberg Square Matrix [Chsnq].
+ * @param Chsnqt1 Complex Hessenberg Square Matrix [Chsnq], Target [t], entries below the subdiagonal left untouched.
+ * @param C0 Complex Number [C], shift.
+ * @param N0 Rows and Columns [N].
+ */
+static void Shf_ChsnqChsnqtCN_0(const Complex* Chsnq0, Complex* Chsnqt1, const Complex C0, const Natural N0) {
+    for(register Natural N1 = 0; N1 < N0; ++N1) {
+        Cp_CvtCvN_0(Chsnqt1 + N1 * N0, Chsnq0 + N1 * N0, N1 + 2 < N0 ? N1 + 2 : N0);
+        Chsnqt1[N1 * (N0 + 1)] = S_CC_C(Chsnqt1[N1 * (N0 + 1)], C0);
+    }
+}
+
+/**
+ * @brief Hessenberg product [Mv].
+ * 
+ * @param Chsnq0 Complex Hessenberg Square Matrix [Chsnq].
+ * @param Cv0 Complex Vector [Cv].
+ * @param Cvt1 Complex Vector [Cv], Target [t].
+ * @param N0 Rows and Columns [N].
+ */
+static void Mv_ChsnqCvCvtN_0(const Complex* Chsnq0, const Complex* Cv0, Complex* Cvt1, const Natural N0) {
+    register Natural N1, N2;
+
+    for(N1 = 0; N1 < N0; ++N1)
+        Cvt1[N1] = C_R_C(0.0);
+
+    for(N1 = 0; N1 < N0; ++N1)
+        for(N2 = 0; N2 < (N1 + 2 < N0 ? N1 + 2 : N0); ++N2)
+            Cvt1[N2] = A_CC_C(Cvt1[N2], M_CC_C(Chsnq0[N1 * N0 + N2], Cv0[N1]));
+}
+
+/**
+ * @brief Shifted conjugate transpose [Shf], reversed so as to be Hessenberg as well.
+ * 
+ * @param Chsnq0 Complex Hessenberg Square Matrix [Chsnq].
+ * @param Chsnqt1 Complex Hessenberg Square Matrix [Chsnq], Target [t], entries below the subdiagonal left untouched.
+ * @param C0 Complex Number [C], shift.
+ * @param N0 Rows and Columns [N].
+ */
+static void Shfh_ChsnqChsnqtCN_0(const Complex* Chsnq0, Complex* Chsnqt1, const Complex C0, const Natural N0) {
+    register Natural N1 = 0, N2;
+
+    for(; N1 < N0; ++N1) {
+        for(N2 = 0; N2 < (N1 + 2 < N0 ? N1 + 2 : N0); ++N2)
+            Chsnqt1[N1 * N0 + N2] = Cj_C_C(Chsnq0[(N0 - 1 - N2) * N0 + N0 - 1 - N1]);
+
+        Chsnqt1[N1 * (N0 + 1)] = S_CC_C(Chsnqt1[N1 * (N0 + 1)], Cj_C_C(C0));
+    }
+}
+
+/**
+ * @brief Error estimate [Err], first order.
+ * 
+ * The residual of the right eigenvector over the cosine between the left
+ * and right ones, each from a step of inverse iteration.
+ * 
+ * @param Chsnq0 Complex Hessenberg Square Matrix [Chsnq].
+ * @param C0 Complex Number [C], eigenvalue.
+ * @param Cqt1 Complex Square Matrix [Cq], Target [t], workspace.
+ * @param Cvt2 Complex Vector [Cv], Target [t], workspace.
+ * @param Cvt3 Complex Vector [Cv], Target [t], workspace.
+ * @param N0 Rows and Columns [N].
+ * @return Real Real Number [R], error estimate.
+ */
+static Real Err_ChsnqCCqtCvtCvtN_R(const Complex* Chsnq0, const Complex C0, Complex* Cqt1, Complex* Cvt2, Complex* Cvt3, const Natural N0) {
+    register Natural N1 = 0;
+    register Complex C1 = C_R_C(0.0);
+    register Real R0;
+
+    for(; N1 < N0; ++N1) // Starting vector.
+        Cvt2[N1] = C_R_C(1.0 / sqrt((Real) N0));
+
+    Shf_ChsnqChsnqtCN_0(Chsnq0, Cqt1, C0, N0); // Right eigenvector.
+    Slv_ChsnqtCvtN_0(Cqt1, Cvt2, N0);
+    Nz2_CvN_0(Cvt2, N0);
+
+    Mv_ChsnqCvCvtN_0(Chsnq0, Cvt2, Cvt3, N0); // Residual.
+    Ma_CvtCvCN_0(Cvt3, Cvt2, vnegq_f64(C0), N0);
+    R0 = N2_CvN_R(Cvt3, N0);
+
+    for(N1 = 0; N1 < N0; ++N1) // Starting vector.
+        Cvt3[N1] = C_R_C(1.0 / sqrt((Real) N0));
+
+    Shfh_ChsnqChsnqtCN_0(Chsnq0, Cqt1, C0, N0); // Left eigenvector, reversed.
+    Slv_ChsnqtCvtN_0(Cqt1, Cvt3, N0);
+    Nz2_CvN_0(Cvt3, N0);
+
+    for(N1 = 0; N1 < N0; ++N1) // Cosine.
+        C1 = A_CC_C(C1, M_CCcj_C(Cvt2[N1], Cvt3[N0 - 1 - N1]));
+
+    return R0 / N2_C_R(C1);
+}
+
+/**
+ * @brief Cluster refinement [Rfn], block inverse iteration and Rayleigh-Ritz.
+ * 
+ * The cluster's eigenvalues are replaced together by those of the projection
+ * onto its invariant subspace, once converged and within the cluster's window.
+ * 
+ * @param Chsnq0 Complex Hessenberg Square Matrix [Chsnq].
+ * @param Cv0 Complex Vector [Cv], starting eigenvalues.
+ * @param Cvt1 Complex Vector [Cv], Target [t], eigenvalues.
+ * @param Nv0 Natural Vector [Nv], cluster's indices.
+ * @param Cqt1 Complex Square Matrix [Cq], Target [t], workspace.
+ * @param N0 Rows and Columns [N].
+ * @param N1 Cluster's size [N].
+ */
+static void Rfn_ChsnqCvCvtNvCqtNN_0(const Complex* Chsnq0, const Complex* Cv0, Complex* Cvt1, const Natural* Nv0, Complex* Cqt1, const Natural N0, const Natural N1) {
+    register Complex* Cm0 = (Complex*) Calc_NN_P(N0 * N1, sizeof(Complex)); // Basis.
+    register Complex* Cm1 = (Complex*) Alc_NN_P(N0 * N1, sizeof(Complex)); // Products.
+    register Complex* Cq0 = (Complex*) Alc_NN_P(N1 * N1, sizeof(Complex)); // Projection.
+    register Complex* Cv1 = (Complex*) Alc_NN_P(N1, sizeof(Complex)); // Ritz values.
+
+    register Natural N2, N3, N4, N5 = 0;
+    register Complex C0 = C_R_C(0.0);
+    register Real R0 = 0.0, R1 = INFINITY, R2;
+
+    for(N2 = 0; N2 < N1; ++N2) // Center.
+        C0 = A_CC_C(C0, Cv0[Nv0[N2]]);
+
+    C0 = D_CR_C(C0, (Real) N1);
+
+    for(N2 = 0; N2 < N1; ++N2) // Radius.
+        R0 = fmax(R0, N2_C_R(S_CC_C(Cv0[Nv0[N2]], C0)));
+
+    R0 += RFN1 * fmax(1.0, N2_C_R(C0)); // Window.
+
+    for(N2 = 0; N2 < N0; ++N2) // Starting basis, orthogonal.
+        Cm0[(N2 % N1) * N0 + N2] = C_R_C(1.0);
+
+    for(N2 = 0; N2 < N1; ++N2) {
+        Nz2_CvN_0(Cm0 + N2 * N0, N0);
+        Cv1[N2] = Cv0[Nv0[N2]];
+    }
+
+    for(; N5 < RFN3 && R1 > TOL0 * fmax(1.0, N2_C_R(C0)); ++N5) {
+        for(N2 = 0; N2 < N1; ++N2) { // Inverse iteration.
+            Shf_ChsnqChsnqtCN_0(Chsnq0, Cqt1, C0, N0);
+            Slv_ChsnqtCvtN_0(Cqt1, Cm0 + N2 * N0, N0);
         }
+
+        for(N2 = 0; N2 < N1; ++N2) { // Gram-Schmidt, twice.
+            for(N3 = 0; N3 < 2 * N2; ++N3)
+                Ma_CvtCvCN_0(Cm0 + N2 * N0, Cm0 + (N3 % N2) * N0, vnegq_f64(Dot_CrvCcvN_C(Cm0 + N2 * N0, Cm0 + (N3 % N2) * N0, N0)), N0);
+
+            Nz2_CvN_0(Cm0 + N2 * N0, N0);
+        }
+
+        for(N2 = 0; N2 < N1; ++N2) // Basis' products.
+            Mv_ChsnqCvCvtN_0(Chsnq0, Cm0 + N2 * N0, Cm1 + N2 * N0, N0);
+
+        for(N2 = 0; N2 < N1; ++N2) // Projection.
+            for(N3 = 0; N3 < N1; ++N3)
+                Cq0[N2 * N1 + N3] = Dot_CrvCcvN_C(Cm1 + N2 * N0, Cm0 + N3 * N0, N0);
+
+        if(N1 > 2) Hsn_CqtN_0(Cq0, N1); // Hessenberg.
+        Eig_ChsnqtN_0(Cq0, N1); // Ritz values.
+
+        for(N2 = 0, R1 = 0.0; N2 < N1; ++N2) { // Change, against the nearest previous value.
+            for(N3 = 0, R2 = INFINITY; N3 < N1; ++N3)
+                R2 = fmin(R2, N2_C_R(S_CC_C(Cq0[N2 * (N1 + 1)], Cv1[N3])));
+
+            R1 = fmax(R1, R2);
+        }
+
+        for(N2 = 0; N2 < N1; ++N2)
+            Cv1[N2] = Cq0[N2 * (N1 + 1)];
     }
 
-    #ifndef NVERBOSE
-    printf("Exited after %zu iterations.\n", N1 + 1);
-    printf("---\n");
-    #endif
+    // Stalling or drifting out of the cluster's window is rejected, the
+    // Ritz values of a tight cluster settling at the square root of TOL0.
+    for(N2 = 0, N4 = 0; N2 < N1; ++N2)
+        N4 += N2_C_R(S_CC_C(Cv1[N2], C0)) <= R0;
+
+    if(N4 == N1 && R1 <= sqrt(TOL0) * fmax(1.0, N2_C_R(C0)))
+        for(N2 = 0; N2 < N1; ++N2)
+            Cvt1[Nv0[N2]] = Cv1[N2];
+
+    Fr_P_0(Cm0);
+    Fr_P_0(Cm1);
+    Fr_P_0(Cq0);
+    Fr_P_0(Cv1);
+}
+
+/**
+ * @brief Eigenvalues refinement [Rfn], Rayleigh quotient iteration.
+ * 
+ * Eigenvalues whose iteration stalls, drifts or lands on another's are
+ * refined again together with their neighbours within the clustering window.
+ * Iterations stop once the eigenvector's residual is down to the size times
+ * the unit roundoff times the Frobenius norm, the double precision QR's own
+ * backward error. An eigenvalue then reaches double accuracy when its error
+ * estimate is within TOL0.
+ * 
+ * @param Chsnq0 Complex Hessenberg Square Matrix [Chsnq].
+ * @param Cvt0 Complex Vector [Cv], Target [t], eigenvalues.
+ * @param Bvt0 Boolean Vector [Bv], Target [t], double accuracy.
+ * @param N0 Rows and Columns [N].
+ * @return Natural Natural Number [N], eigenvalues short of double accuracy.
+ */
+Natural Rfn_ChsnqCvtBvtN_N(const Complex* Chsnq0, Complex* Cvt0, bool* Bvt0, const Natural N0) {
+    register Complex* Cm0 = (Complex*) Alc_NN_P(N0 * N0, sizeof(Complex)); // Shifted copy.
+    register Complex* Cv0 = (Complex*) Alc_NN_P(N0, sizeof(Complex)); // Vector.
+    register Complex* Cv1 = (Complex*) Alc_NN_P(N0, sizeof(Complex)); // Product.
+    register Complex* Cv2 = (Complex*) Alc_NN_P(N0, sizeof(Complex)); // Starting eigenvalues.
+    register Natural* Nv0 = (Natural*) Alc_NN_P(N0, sizeof(Natural)); // Labels.
+    register Natural* Nv1 = (Natural*) Calc_NN_P(N0, sizeof(Natural)); // Failures, then clusters.
+
+    register Natural N1 = 0, N2, N3;
+    register Complex C0, C1;
+    register Real R0 = 0.0, R1 = INFINITY; // Tolerance, residual.
+
+    for(N2 = 0; N2 < N0; ++N2) // Frobenius norm.
+        R0 += pow(N2_CvN_R(Chsnq0 + N2 * N0, N2 + 2 < N0 ? N2 + 2 : N0), 2.0);
+
+    R0 = 0x1.0p-52 * (Real) N0 * sqrt(R0); // The QR's own backward error.
+
+    Cp_CvtCvN_0(Cv2, Cvt0, N0);
+
+    for(; N1 < N0; ++N1) {
+        C0 = Cvt0[N1];
+
+        for(N2 = 0; N2 < N0; ++N2) // Starting vector.
+            Cv0[N2] = C_R_C(1.0 / sqrt((Real) N0));
+
+        for(N2 = 0; N2 < RFN0; ++N2) {
+            Shf_ChsnqChsnqtCN_0(Chsnq0, Cm0, C0, N0); // Shift.
+
+            Slv_ChsnqtCvtN_0(Cm0, Cv0, N0); // Inverse iteration.
+            Nz2_CvN_0(Cv0, N0);
+
+            Mv_ChsnqCvCvtN_0(Chsnq0, Cv0, Cv1, N0); // Hessenberg product.
+            C1 = Dot_CrvCcvN_C(Cv1, Cv0, N0); // Rayleigh quotient.
+
+            Ma_CvtCvCN_0(Cv1, Cv0, vnegq_f64(C1), N0); // Residual.
+            R1 = N2_CvN_R(Cv1, N0);
+
+            C0 = C1;
+            if(R1 <= R0) break;
+        }
+
+        // Drifting to another eigenvalue is rejected.
+        if(N2_C_R(S_CC_C(C0, Cvt0[N1])) <= RFN1 * fmax(1.0, N2_C_R(Cvt0[N1])))
+            Cvt0[N1] = C0;
+        else
+            Nv1[N1] = 1;
+
+        if(N2 == RFN0) Nv1[N1] = 1; // Stall.
+    }
+
+    for(N1 = 0; N1 < N0; ++N1) // Collisions.
+        for(N2 = N1 + 1; N2 < N0; ++N2)
+            if(N2_C_R(S_CC_C(Cvt0[N1], Cvt0[N2])) <= sqrt(TOL0) * fmax(1.0, N2_C_R(Cvt0[N1])))
+                Nv1[N1] = Nv1[N2] = 1;
+
+    for(N1 = 0; N1 < N0; ++N1)
+        Nv0[N1] = N1;
+
+    for(N1 = 0; N1 < N0; ++N1) // Clustering around failures, labelled by the first index.
+        for(N2 = N1 + 1; N2 < N0; ++N2) {
+            if(!(Nv1[N1] || Nv1[N2]) || Nv0[N1] == Nv0[N2] || N2_C_R(S_CC_C(Cv2[N1], Cv2[N2])) > RFN2 * fmax(1.0, fmax(N2_C_R(Cv2[N1]), N2_C_R(Cv2[N2])))) continue;
+
+            const register Natural N4 = Nv0[N1] < Nv0[N2] ? Nv0[N1] : Nv0[N2];
+            const register Natural N5 = Nv0[N1] < Nv0[N2] ? Nv0[N2] : Nv0[N1];
+
+            for(N3 = 0; N3 < N0; ++N3) // Merge.
+                if(Nv0[N3] == N5) Nv0[N3] = N4;
+        }
+
+    for(N1 = 0; N1 < N0; ++N1) { // Clusters.
+        if(Nv0[N1] != N1) continue;
+
+        for(N2 = N1, N3 = 0; N2 < N0; ++N2)
+            if(Nv0[N2] == N1) Nv1[N3++] = N2;
+
+        if(N3 > 1) Rfn_ChsnqCvCvtNvCqtNN_0(Chsnq0, Cv2, Cvt0, Nv1, Cm0, N0, N3);
+    }
+
+    for(N1 = 0, N2 = 0; N1 < N0; ++N1) { // Accuracy.
+        Bvt0[N1] = Err_ChsnqCCqtCvtCvtN_R(Chsnq0, Cvt0[N1], Cm0, Cv0, Cv1, N0) <= TOL0 * fmax(1.0, N2_C_R(Cvt0[N1]));
+        N2 += !Bvt0[N1];
+    }
+
+    Fr_P_0(Cm0);
+    Fr_P_0(Cv0);
+    Fr_P_0(Cv1);
+    Fr_P_0(Cv2);
+    Fr_P_0(Nv0);
+    Fr_P_0(Nv1);
+
+    return N2;
+}
+
+// Products.
+
+/**
+ * @brief Mat-vec [Mv].
+ * 
+ * @param Cm0 Complex Matrix [Cm].
+ * @param Cv0 Complex Vector [Cv], N1 entries.
+ * @param Cvt0 Complex Vector [Cv], Target [t], N0 entries.
+ * @param N0 Rows [N].
+ * @param N1 Columns [N].
+ */
+void Mv_CmCvCvtNN_0(const Complex* Cm0, const Complex* Cv0, Complex* Cvt0, const Natural N0, const Natural N1) {
+    register Natural N2 = 0;
+
+    for(; N2 < N0; ++N2)
+        Cvt0[N2] = C_R_C(0.0);
+
+    for(N2 = 0; N2 < N1; ++N2) // By columns.
+        Ma_CvtCvCN_0(Cvt0, Cm0 + N2 * N0, Cv0[N2], N0);
+}
+
+// Spectral bounds.
+
+/**
+ * @brief Gershgorin bounds [Grs].
+ * 
+ * Row and column discs are both accumulated, the spectrum lying in the
+ * intersection of their unions.
+ * 
+ * @param Cq0 Complex Square Matrix [Cq].
+ * @param Rvt0 Real Vector [Rv], Target [t], real part's and imaginary part's lower and upper bounds.
+ * @param N0 Rows and Columns [N].
+ * @return Real Real Number [R], spectral radius' upper bound.
+ */
+Real Grs_CqRvtN_R(const Complex* Cq0, Real* Rvt0, const Natural N0) {
+    register Real* Rv0 = (Real*) Calc_NN_P(2 * N0, sizeof(Real)); // Row sums.
+    register Real* Rv1 = Rv0 + N0; // Column sums.
+
+    register Natural N1 = 0, N2;
+    register Real R0, R1;
+
+    for(; N1 < N0; ++N1) { // Moduli, two entries at once.
+        const register Complex* Ccv0 = Cq0 + N1 * N0;
+        register Real2 Rt0 = {0.0, 0.0};
+
+        for(N2 = 0; N2 + 1 < N0; N2 += 2) {
+            const register Real2 Rt1 = vsqrtq_f64(vpaddq_f64(vmulq_f64(Ccv0[N2], Ccv0[N2]), vmulq_f64(Ccv0[N2 + 1], Ccv0[N2 + 1])));
+
+            vst1q_f64(Rv0 + N2, vaddq_f64(vld1q_f64(Rv0 + N2), Rt1));
+            Rt0 = vaddq_f64(Rt0, Rt1);
+        }
+
+        Rv1[N1] = vaddvq_f64(Rt0);
+
+        if(N2 < N0) {
+            R0 = N2_C_R(Ccv0[N2]);
+
+            Rv0[N2] += R0;
+            Rv1[N1] += R0;
+        }
+    }
+
+    Real Rv2[8] = {HUGE_VAL, -HUGE_VAL, HUGE_VAL, -HUGE_VAL, HUGE_VAL, -HUGE_VAL, HUGE_VAL, -HUGE_VAL}; // Rows' and columns' boxes.
+    register Real R2 = 0.0, R3 = 0.0; // Radii.
+
+    for(N1 = 0; N1 < N0; ++N1) {
+        const register Complex C0 = Cq0[N1 * (N0 + 1)];
+        const register Real R4 = vgetq_lane_f64(C0, 0), R5 = vgetq_lane_f64(C0, 1), R6 = N2_C_R(C0);
+
+        for(N2 = 0; N2 < 2; ++N2) {
+            R0 = (N2 == 0 ? Rv0[N1] : Rv1[N1]) - R6; // Off-diagonal sum.
+            R1 = R6 + R0;
+
+            if(R4 - R0 < Rv2[4 * N2]) Rv2[4 * N2] = R4 - R0;
+            if(R4 + R0 > Rv2[4 * N2 + 1]) Rv2[4 * N2 + 1] = R4 + R0;
+            if(R5 - R0 < Rv2[4 * N2 + 2]) Rv2[4 * N2 + 2] = R5 - R0;
+            if(R5 + R0 > Rv2[4 * N2 + 3]) Rv2[4 * N2 + 3] = R5 + R0;
+
+            if(N2 == 0 && R1 > R2) R2 = R1;
+            if(N2 == 1 && R1 > R3) R3 = R1;
+        }
+    }
+
+    for(N1 = 0; N1 < 4; N1 += 2) { // Intersection.
+        Rvt0[N1] = Rv2[N1] > Rv2[N1 + 4] ? Rv2[N1] : Rv2[N1 + 4];
+        Rvt0[N1 + 1] = Rv2[N1 + 1] < Rv2[N1 + 5] ? Rv2[N1 + 1] : Rv2[N1 + 5];
+    }
+
+    Fr_P_0(Rv0);
+    return R2 < R3 ? R2 : R3;
+}
+
+// Structure.
+
+/**
+ * @brief Structure [Str].
+ * 
+ * Exact probe, a single pass over the entries.
+ * 
+ * @param Cq0 Complex Square Matrix [Cq].
+ * @param Nvt0 Natural Vector [Nv], Target [t], last nonzero row among the first columns, a split following column j when Nvt0[j] <= j.
+ * @param N0 Rows and Columns [N].
+ * @return Natural Structure [N], STR_* flags.
+ */
+Natural Str_CqNvtN_N(const Complex* Cq0, Natural* Nvt0, const Natural N0) {
+    register Natural N1 = 0, N2, N3 = 0; // Last nonzero row.
+    register Natural N4 = STR_UPPER | STR_LOWER | STR_HESSENBERG | STR_REAL | STR_HERMITIAN;
+
+    for(; N1 < N0; ++N1) {
+        const register Complex* Ccv0 = Cq0 + N1 * N0;
+
+        for(N2 = 0; N2 < N0; ++N2) {
+            const register Complex C0 = Ccv0[N2];
+            const register Real R0 = vgetq_lane_f64(C0, 0), R1 = vgetq_lane_f64(C0, 1);
+
+            if(R1 != 0.0) N4 &= ~(Natural) STR_REAL;
+            if(N2 >= N1 && (R0 != vgetq_lane_f64(Cq0[N2 * N0 + N1], 0) || R1 != -vgetq_lane_f64(Cq0[N2 * N0 + N1], 1))) N4 &= ~(Natural) STR_HERMITIAN;
+
+            if(R0 == 0.0 && R1 == 0.0) continue;
+
+            if(N2 > N1) { N4 &= ~(Natural) STR_UPPER; if(N2 > N3) N3 = N2; }
+            if(N2 > N1 + 1) N4 &= ~(Natural) STR_HESSENBERG;
+            if(N2 < N1) N4 &= ~(Natural) STR_LOWER;
+        }
+
+        Nvt0[N1] = N3;
+    }
 
-    free(Cv0);
-    free(Cv1);
+    return N4;
 }
 
 // Output.
@@ -0,0 +1,184 @@
+/**
+ * @file NAQRA_Memory.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief include/Memory.h implementation.
+ * @date 2024-12-06
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE // mmap, madvise.
+#endif
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <memory.h>
+#include <sys/mman.h>
+#include "../include/Memory.h"
+
+// Block kinds.
+
+#define KND_HEAP 0
+#define KND_MAP 1
+#define KND_HOOK 2
+
+// Block header, stored ALN0 bytes before the block.
+typedef struct {
+
+    // Base address.
+    void* P0;
+
+    // Mapped length, bytes.
+    size_t N0;
+
+    // Kind.
+    size_t N1;
+
+    // Release hook.
+    void (*Fr)(void*);
+
+} Header;
+
+_Static_assert(sizeof(Header) <= ALN0, "Header exceeds alignment.");
+
+// State.
+
+static Allocator A0 = {NULL, NULL}; // Allocator.
+static size_t N0 = HGP_TRANSPARENT; // Huge pages.
+
+/**
+ * @brief Set allocator [Sa].
+ * 
+ * @param A1 Allocator [A].
+ */
+void Sa_A_0(const Allocator A1) { A0 = A1; }
+
+/**
+ * @brief Huge pages [Hgp].
+ * 
+ * @param N1 Mode [N], HGP_NONE, HGP_TRANSPARENT or HGP_EXPLICIT.
+ */
+void Hgp_N_0(const size_t N1) { N0 = N1; }
+
+// Mappings.
+
+/**
+ * @brief Map [Map].
+ * 
+ * @param N1 Bytes [N].
+ * @param Nt0 Mapped bytes [N], Target [t].
+ * @return void* Base address, NULL on failure.
+ */
+static void* Map_NNt_P(const size_t N1, size_t* Nt0) {
+    void* P0 = MAP_FAILED;
+
+    #ifdef MAP_HUGETLB
+    if(N0 == HGP_EXPLICIT) { // Explicit huge pages, 2 MiB.
+        *Nt0 = (N1 + (1 << 21) - 1) & ~(size_t) ((1 << 21) - 1);
+        P0 = mmap(NULL, *Nt0, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    }
+    #endif
+
+    if(P0 == MAP_FAILED) { // Regular pages.
+        *Nt0 = N1;
+        P0 = mmap(NULL, N1, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+        #ifdef MADV_HUGEPAGE
+        if(P0 != MAP_FAILED && N0 != HGP_NONE)
+            madvise(P0, N1, MADV_HUGEPAGE);
+        #endif
+    }
+
+    return P0 == MAP_FAILED ? NULL : P0;
+}
+
+// Allocations.
+
+/**
+ * @brief Allocate [Alc], uninitialized.
+ * 
+ * @param N1 Entries [N].
+ * @param N2 Entry size [N].
+ * @return void* Aligned block, NULL on failure.
+ */
+[[nodiscard]] void* Alc_NN_P(const size_t N1, const size_t N2) {
+    const size_t N3 = N1 * N2 + ALN0; // Bytes, header included.
+    Header H0 = {NULL, 0, KND_HEAP, NULL};
+    unsigned char* P0 = NULL;
+
+    if(A0.Alc != NULL) { // Custom allocator.
+        if((H0.P0 = A0.Alc(N3 + ALN0)) == NULL) return NULL;
+
+        P0 = (unsigned char*) (((uintptr_t) H0.P0 + 2 * ALN0 - 1) & ~(uintptr_t) (ALN0 - 1));
+        H0.N1 = KND_HOOK;
+        H0.Fr = A0.Fr;
+    } else if(N3 >= MMP0 && (H0.P0 = Map_NNt_P(N3, &H0.N0)) != NULL) { // Mapping.
+        P0 = (unsigned char*) H0.P0 + ALN0;
+        H0.N1 = KND_MAP;
+    } else { // Heap.
+        if((H0.P0 = aligned_alloc(ALN0, (N3 + ALN0 - 1) & ~(size_t) (ALN0 - 1))) == NULL) return NULL;
+        P0 = (unsigned char*) H0.P0 + ALN0;
+    }
+
+    memcpy(P0 - ALN0, &H0, sizeof(Header));
+    return P0;
+}
+
+/**
+ * @brief Allocate [Calc], zeroed.
+ * 
+ * @param N1 Entries [N].
+ * @param N2 Entry size [N].
+ * @return void* Aligned block, NULL on failure.
+ */
+[[nodiscard]] void* Calc_NN_P(const size_t N1, const size_t N2) {
+    unsigned char* P0 = (unsigned char*) Alc_NN_P(N1, N2);
+    Header H0;
+
+    if(P0 == NULL) return NULL;
+    memcpy(&H0, P0 - ALN0, sizeof(Header));
+
+    if(H0.N1 != KND_MAP) // Mappings are already zeroed.
+        memset(P0, 0, N1 * N2);
+
+    return P0;
+}
+
+/**
+ * @brief Free [Fr].
+ * 
+ * @param P0 Aligned block.
+ */
+void Fr_P_0(void* P0) {
+    Header H0;
+
+    if(P0 == NULL) return;
+    memcpy(&H0, (unsigned char*) P0 - ALN0, sizeof(Header));
+
+    switch(H0.N1) {
+        case KND_MAP: munmap(H0.P0, H0.N0); break;
+        case KND_HOOK: if(H0.Fr != NULL) H0.Fr(H0.P0); break;
+        default: free(H0.P0);
+    }
+}
+
+// Mappings.
+
+/**
+ * @brief Adopt [Adp], a private mapping as an aligned block.
+ * 
+ * The first ALN0 bytes of the mapping are overwritten by the block header,
+ * the block starting right after them.
+ * 
+ * @param P0 Base address, from a private writable mmap.
+ * @param N1 Mapped bytes [N].
+ * @return void* Aligned block, released by Fr_P_0 through munmap.
+ */
+[[nodiscard]] void* Adp_PN_P(void* P0, const size_t N1) {
+    const Header H0 = {P0, N1, KND_MAP, NULL};
+
+    memcpy(P0, &H0, sizeof(Header));
+    return (unsigned char*) P0 + ALN0;
+}
@@ -0,0 +1,661 @@
+/**
+ * @file NAQRA_Parallel.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief include/Parallel.h implementation.
+ * @date 2024-12-02
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ * QR sweeps are pipelined over a team of threads. The calling thread generates
+ * the rotations while the workers apply the published ones to their column
+ * blocks, then the RQ products are split over independent row blocks.
+ * 
+ * Hermitian band matrices are brought to tridiagonal form by pipelined bulge
+ * chasing sweeps, and subsets of their eigenvalues are bisected over
+ * independent index intervals.
+ */
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include "../include/Parallel.h"
+
+// Sweep state, shared by the team.
+typedef struct {
+
+    // Matrix, compact storage.
+    Complex* Chct0;
+
+    // Givens coefficients.
+    Complex* Cv0;
+
+    // Rows and Columns.
+    Natural N0;
+
+    // Last active index.
+    Natural N1;
+
+    // Threads.
+    Natural N2;
+
+    // Columns (rows) per block.
+    Natural N5;
+
+    // Published rotations.
+    _Atomic Natural Nt0;
+
+    // Applied rotations, per column block.
+    _Atomic Natural* Ntv0;
+
+    // Next row block.
+    _Atomic Natural Nt1;
+
+    // Barrier.
+    pthread_mutex_t Mx0;
+    pthread_cond_t Cd0;
+    Natural N3, N4;
+
+    // Stop.
+    bool B0;
+
+} Sweep;
+
+// Worker.
+typedef struct {
+
+    // Sweep.
+    Sweep* Sw0;
+
+    // Index.
+    Natural N0;
+
+} Worker;
+
+// Threads.
+
+/**
+ * @brief Threads [Thr].
+ * 
+ * @return Natural Online processors [N].
+ */
+Natural Thr_0_N(void) {
+    const register long L0 = sysconf(_SC_NPROCESSORS_ONLN);
+    return L0 > 0 ? (Natural) L0 : 1;
+}
+
+// Parallel copy.
+
+// Copy task.
+typedef struct {
+
+    // Target matrix.
+    Complex* Cmt0;
+
+    // Source matrix.
+    const Complex* Cm0;
+
+    // Rows and Columns.
+    Natural N0;
+
+    // Threads.
+    Natural N1;
+
+    // Index.
+    Natural N2;
+
+    // Columns per block.
+    Natural N3;
+
+} Copy;
+
+/**
+ * @brief Copy [Cp], worker side.
+ * 
+ * @param P0 Copy task.
+ * @return void* NULL.
+ */
+static void* Cp_Cp_0(void* P0) {
+    const Copy* Cp0 = (const Copy*) P0;
+    register Natural N0 = Cp0->N2 - 1, N1;
+
+    // Column blocks, round-robin.
+    for(; N0 * Cp0->N3 < Cp0->N0; N0 += Cp0->N1 - 1) {
+        N1 = (N0 + 1) * Cp0->N3 < Cp0->N0 ? Cp0->N3 : Cp0->N0 - N0 * Cp0->N3;
+        Cp_CvtCvN_0(Cp0->Cmt0 + N0 * Cp0->N3 * Cp0->N0, Cp0->Cm0 + N0 * Cp0->N3 * Cp0->N0, N1 * Cp0->N0);
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Copy [Cp], column blocks split over a transient team.
+ * 
+ * Blocks whose thread cannot be created are copied by the caller.
+ * 
+ * @param Cmt0 Complex Matrix [Cm], Target [t].
+ * @param Cm0 Complex Matrix [Cm].
+ * @param N0 Rows and Columns [N].
+ * @param N1 Threads [N].
+ */
+void Cp_CmtCmNN_0(Complex* Cmt0, const Complex* Cm0, const Natural N0, const Natural N1) {
+    if(N1 < 2 || N0 < Tn_0_Tn().N2) { Cp_CvtCvN_0(Cmt0, Cm0, N0 * N0); return; }
+
+    pthread_t* Th0 = (pthread_t*) Alc_NN_P(N1 - 1, sizeof(pthread_t));
+    Copy* Cp0 = (Copy*) Alc_NN_P(N1 - 1, sizeof(Copy));
+    bool* B0 = (bool*) Alc_NN_P(N1 - 1, sizeof(bool)); // Started.
+    register Natural N2 = 0;
+
+    for(; N2 < N1 - 1; ++N2) {
+        Cp0[N2] = (Copy) {.Cmt0 = Cmt0, .Cm0 = Cm0, .N0 = N0, .N1 = N1, .N2 = N2 + 1, .N3 = Tn_0_Tn().N3};
+        B0[N2] = pthread_create(Th0 + N2, NULL, Cp_Cp_0, Cp0 + N2) == 0;
+    }
+
+    for(N2 = 0; N2 < N1 - 1; ++N2)
+        if(B0[N2]) pthread_join(Th0[N2], NULL);
+        else Cp_Cp_0(Cp0 + N2); // Fallback.
+
+    Fr_P_0(Th0);
+    Fr_P_0(Cp0);
+    Fr_P_0(B0);
+}
+
+// Synchronization.
+
+/**
+ * @brief Barrier [Brr].
+ * 
+ * @param Sw0 Sweep [Sw].
+ */
+static void Brr_Sw_0(Sweep* Sw0) {
+    pthread_mutex_lock(&Sw0->Mx0);
+
+    const register Natural N0 = Sw0->N4; // Generation.
+
+    if(++Sw0->N3 == Sw0->N2) {
+        Sw0->N3 = 0;
+        ++Sw0->N4;
+
+        pthread_cond_broadcast(&Sw0->Cd0);
+    } else
+        while(N0 == Sw0->N4)
+            pthread_cond_wait(&Sw0->Cd0, &Sw0->Mx0);
+
+    pthread_mutex_unlock(&Sw0->Mx0);
+}
+
+// Sweep phases.
+
+/**
+ * @brief Required rotations [Rqr], column block.
+ * 
+ * @param Sw0 Sweep [Sw].
+ * @param N0 Block [N].
+ * @return Natural Rotations [N].
+ */
+static inline Natural Rqr_SwN_N(const Sweep* Sw0, const Natural N0) {
+    register Natural N1 = (N0 + 1) * Sw0->N5; if(N1 > Sw0->N0) N1 = Sw0->N0; // Block's end.
+
+    // Rotation N2 reaches the block's columns from N2 + 2 onwards.
+    N1 = N1 < 2 ? 0 : N1 - 2;
+    return N1 < Sw0->N1 ? N1 : Sw0->N1;
+}
+
+/**
+ * @brief QR products [Qr], worker side.
+ * 
+ * @param Sw0 Sweep [Sw].
+ * @param N0 Worker index [N], from 1.
+ */
+static void Qr_SwN_0(Sweep* Sw0, const Natural N0) {
+    const register Natural N1 = (Sw0->N0 + Sw0->N5 - 1) / Sw0->N5; // Blocks.
+    register Natural N2, N3, N4, N5;
+    register bool B0 = false;
+
+    while(!B0)
+        for(B0 = true, N2 = N0 - 1; N2 < N1; N2 += Sw0->N2 - 1) {
+            N3 = atomic_load_explicit(Sw0->Ntv0 + N2, memory_order_relaxed); // Applied.
+            N4 = Rqr_SwN_N(Sw0, N2); // Required.
+
+            if(N3 >= N4) continue;
+            B0 = false;
+
+            N5 = atomic_load_explicit(&Sw0->Nt0, memory_order_acquire); // Published.
+            if(N5 > N4) N5 = N4;
+
+            if(N3 == N5) { sched_yield(); continue; } // Nothing new.
+
+            // Leading columns are left to the generator.
+            Gvsl_ChctCvNNNNN_0(Sw0->Chct0, Sw0->Cv0, N3, N5, N2 * Sw0->N5, (N2 + 1) * Sw0->N5 < Sw0->N0 ? (N2 + 1) * Sw0->N5 : Sw0->N0, 2);
+            atomic_store_explicit(Sw0->Ntv0 + N2, N5, memory_order_release);
+        }
+}
+
+/**
+ * @brief QR products [Qr], generator side.
+ * 
+ * @param Sw0 Sweep [Sw].
+ */
+static void Qr_Sw_0(Sweep* Sw0) {
+    Complex* Chct0 = Sw0->Chct0;
+    Complex* Cv0 = Sw0->Cv0;
+
+    register Natural N1 = 0;
+    register Real R0;
+
+    for(; N1 < Sw0->N1 + 1; ++N1) {
+        if(N1 > 0) { // Leading column, last rotation.
+            while(atomic_load_explicit(Sw0->Ntv0 + N1 / Sw0->N5, memory_order_acquire) < N1 - 1)
+                sched_yield();
+
+            Gvsl_ChctCvNNNNN_0(Chct0, Cv0, N1 - 1, N1, N1, N1 + 1, 1);
+        }
+
+        if(N1 == Sw0->N1) break;
+
+        Cp_CvtCvN_0(Cv0 + 2 * N1, Chct0 + Cx_NN_N(N1, N1), 2); // Copy.
+
+        R0 = N2_CvN_R(Cv0 + 2 * N1, 2); // Norm.
+        D_CvR_0(Cv0 + 2 * N1, R0, 2); // Normalization.
+
+        // First product.
+        Chct0[Cx_NN_N(N1, N1)] = C_R_C(R0);
+        Chct0[Cx_NN_N(N1 + 1, N1)] = C_R_C(0.0);
+
+        atomic_store_explicit(&Sw0->Nt0, N1 + 1, memory_order_release); // Publication.
+    }
+}
+
+/**
+ * @brief RQ products [Rq].
+ * 
+ * @param Sw0 Sweep [Sw].
+ */
+static void Rq_Sw_0(Sweep* Sw0) {
+    register Natural N0;
+
+    // Rows are independent, heavier blocks come first.
+    while((N0 = Sw0->N5 * atomic_fetch_add_explicit(&Sw0->Nt1, 1, memory_order_relaxed)) < Sw0->N1 + 1)
+        Gvsrhr_ChctCvNNNN_0(Sw0->Chct0, Sw0->Cv0, 0, Sw0->N1, N0, N0 + Sw0->N5 < Sw0->N1 + 1 ? N0 + Sw0->N5 : Sw0->N1 + 1);
+}
+
+/**
+ * @brief Worker loop [Wrk].
+ * 
+ * @param P0 Worker.
+ * @return void* NULL.
+ */
+static void* Wrk_W_0(void* P0) {
+    Worker* W0 = (Worker*) P0;
+    Sweep* Sw0 = W0->Sw0;
+
+    for(;;) {
+        Brr_Sw_0(Sw0); // Start.
+        if(Sw0->B0) break;
+
+        Qr_SwN_0(Sw0, W0->N0);
+        Brr_Sw_0(Sw0); // QR.
+
+        Rq_Sw_0(Sw0);
+        Brr_Sw_0(Sw0); // RQ.
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Shifted QR step [Qrs], multithreaded.
+ * 
+ * @param Sw0 Sweep [Sw].
+ * @param C0 Complex Number [C], Shift.
+ * @param N1 Last active index [N].
+ */
+static void Qrs_SwCN_0(Sweep* Sw0, const Complex C0, const Natural N1) {
+    const register Natural N0 = Sw0->N0;
+    register Natural N2;
+
+    for(N2 = 0; N2 < N1 + 1; ++N2) // Shift (-).
+        Sw0->Chct0[Cx_NN_N(N2, N2)] = S_CC_C(Sw0->Chct0[Cx_NN_N(N2, N2)], C0);
+
+    // Team reset, workers are waiting.
+    Sw0->N1 = N1;
+    atomic_store_explicit(&Sw0->Nt0, 0, memory_order_relaxed);
+    atomic_store_explicit(&Sw0->Nt1, 0, memory_order_relaxed);
+
+    for(N2 = 0; N2 < (N0 + Sw0->N5 - 1) / Sw0->N5; ++N2)
+        atomic_store_explicit(Sw0->Ntv0 + N2, 0, memory_order_relaxed);
+
+    Brr_Sw_0(Sw0); // Start.
+
+    Qr_Sw_0(Sw0);
+    Brr_Sw_0(Sw0); // QR.
+
+    Rq_Sw_0(Sw0);
+    Brr_Sw_0(Sw0); // RQ.
+
+    for(N2 = 0; N2 < N1 + 1; ++N2) // Shift (+).
+        Sw0->Chct0[Cx_NN_N(N2, N2)] = A_CC_C(Sw0->Chct0[Cx_NN_N(N2, N2)], C0);
+}
+
+// QR algorithm.
+
+/**
+ * @brief Eigenvalues [Eig], multithreaded, compact storage, warm-started, streamed, within a budget.
+ * 
+ * Threads that cannot be created shrink the team, down to serial sweeps.
+ * 
+ * @param Chct0 Complex Hessenberg Compact Matrix [Chc], Target [t].
+ * @param Cvt0 Complex Vector [Cv], Target [t], previous eigenvalues by index, replaced by the new ones, NULL for none.
+ * @param Df0 Deflation callback [Df], NULL for none.
+ * @param P0 Callback's data.
+ * @param Bg0 Budget [Bg], NULL for none.
+ * @param N0 Rows and Columns [N].
+ * @param N1 Threads [N].
+ * @return Natural Status [N].
+ */
+Natural Eig_ChctCvtDfPBgNN_N(Complex* Chct0, Complex* Cvt0, const Deflation Df0, void* P0, const Budget* Bg0, const Natural N0, const Natural N1) {
+    const Tuning Tn0 = Tn_0_Tn();
+
+    if(N1 < 2 || N0 < Tn0.N2)
+        return Cvt0 != NULL ? Eig_ChctCvtDfPBgN_N(Chct0, Cvt0, Df0, P0, Bg0, N0) : Eig_ChctDfPBgN_N(Chct0, Df0, P0, Bg0, N0);
+
+    register Complex* Cv0 = (Complex*) Calc_NN_P(2 * (N0 - 1), sizeof(Complex));
+    register Complex C0; // Shift.
+
+    register Natural N2 = 0, N3 = N0 - 1, N4, N5 = STS_CONVERGED, N6 = 0;
+    const register Real R0 = Bg0 != NULL && Bg0->R0 > 0.0 ? Tm_0_R() : 0.0; // Start.
+
+    // Team.
+
+    Sweep Sw0 = {.Chct0 = Chct0, .Cv0 = Cv0, .N0 = N0, .N1 = 0, .N2 = N1, .N3 = 0, .N4 = 0, .N5 = Tn0.N3, .B0 = false};
+    Sw0.Ntv0 = (_Atomic Natural*) Calc_NN_P((N0 + Tn0.N3 - 1) / Tn0.N3, sizeof(_Atomic Natural));
+
+    pthread_mutex_init(&Sw0.Mx0, NULL);
+    pthread_cond_init(&Sw0.Cd0, NULL);
+
+    pthread_t* Th0 = (pthread_t*) Alc_NN_P(N1 - 1, sizeof(pthread_t));
+    Worker* W0 = (Worker*) Alc_NN_P(N1 - 1, sizeof(Worker));
+
+    for(N4 = 0; N4 < N1 - 1; ++N4) {
+        W0[N4].Sw0 = &Sw0;
+        W0[N4].N0 = N4 + 1;
+
+        if(pthread_create(Th0 + N4, NULL, Wrk_W_0, W0 + N4) != 0) break; // Smaller team.
+    }
+
+    // Workers wait at the start barrier, whose count is set under its lock.
+    pthread_mutex_lock(&Sw0.Mx0);
+    Sw0.N2 = N4 + 1;
+    pthread_mutex_unlock(&Sw0.Mx0);
+
+    #ifndef NVERBOSE
+    printf("--- QR Algorithm, %zu threads\n", Sw0.N2);
+    #endif
+
+    for(;; ++N2) {
+
+        if(N3 == 0) break; // Stop.
+        if((N5 = Chk_BgRN_N(Bg0, R0, N2)) != STS_CONVERGED) break; // Budget.
+
+        if(N2_C_R(Chct0[Cx_NN_N(N3, N3 - 1)]) <= TOL0) { // Deflation.
+            if(Df0 != NULL && !Df0(N3, Chct0[Cx_NN_N(N3, N3)], N2, P0)) { N5 = STS_CANCELLED; break; }
+            if(Cvt0 != NULL) Wrm_CvtCN_0(Cvt0, Chct0[Cx_NN_N(N3, N3)], N3);
+
+            --N3;
+            N6 = 0;
+            continue;
+        }
+
+        N4 = 1; // Steps.
+
+        if(++N6 % EXC0 == 0) // Exceptional shift.
+            C0 = A_CC_C(Chct0[Cx_NN_N(N3, N3)], C_R_C(0.75 * N2_C_R(Chct0[Cx_NN_N(N3, N3 - 1)])));
+        else if(Cvt0 != NULL && N6 == 1) { // Warm shift, twice.
+            C0 = Cvt0[N3];
+            N4 = 2;
+        } else {
+            register Complex* Cv2 = Eig_CCCC_C(Chct0[Cx_NN_N(N3 - 1, N3 - 1)], Chct0[Cx_NN_N(N3 - 1, N3)], Chct0[Cx_NN_N(N3, N3 - 1)], Chct0[Cx_NN_N(N3, N3)]); // Wilkinson's shift, the closest root.
+            C0 = N2_C_R(S_CC_C(Cv2[0], Chct0[Cx_NN_N(N3, N3)])) <= N2_C_R(S_CC_C(Cv2[1], Chct0[Cx_NN_N(N3, N3)])) ? Cv2[0] : Cv2[1];
+            Fr_P_0(Cv2);
+        }
+
+        for(; N4 > 0; --N4)
+            if(N3 + 1 < Tn0.N2 || Sw0.N2 < 2) // Small or no team.
+                Qrs_ChctCvtCNN_0(Chct0, Cv0, C0, N0, N3);
+            else
+                Qrs_SwCN_0(&Sw0, C0, N3);
+    }
+
+    #ifndef NVERBOSE
+    printf("Exited after %zu iterations.\n", N2 + 1);
+    printf("---\n");
+    #endif
+
+    // Team release.
+
+    Sw0.B0 = true;
+    Brr_Sw_0(&Sw0);
+
+    for(N4 = 0; N4 < Sw0.N2 - 1; ++N4)
+        pthread_join(Th0[N4], NULL);
+
+    pthread_mutex_destroy(&Sw0.Mx0);
+    pthread_cond_destroy(&Sw0.Cd0);
+
+    Fr_P_0(Th0);
+    Fr_P_0(W0);
+    Fr_P_0((void*) Sw0.Ntv0);
+    Fr_P_0(Cv0);
+
+    if(N5 == STS_CONVERGED && Df0 != NULL) // Last eigenvalue.
+        Df0(0, Chct0[0], N2, P0);
+
+    if(N5 == STS_CONVERGED && Cvt0 != NULL)
+        *Cvt0 = Chct0[0];
+
+    return N5;
+}
+
+/**
+ * @brief Eigenvalues [Eig], multithreaded, compact storage, streamed, within a budget.
+ * 
+ * @param Chct0 Complex Hessenberg Compact Matrix [Chc], Target [t].
+ * @param Df0 Deflation callback [Df], NULL for none.
+ * @param P0 Callback's data.
+ * @param Bg0 Budget [Bg], NULL for none.
+ * @param N0 Rows and Columns [N].
+ * @param N1 Threads [N].
+ * @return Natural Status [N].
+ */
+Natural Eig_ChctDfPBgNN_N(Complex* Chct0, const Deflation Df0, void* P0, const Budget* Bg0, const Natural N0, const Natural N1) {
+    return Eig_ChctCvtDfPBgNN_N(Chct0, NULL, Df0, P0, Bg0, N0, N1);
+}
+
+/**
+ * @brief Eigenvalues [Eig], multithreaded, compact storage.
+ * 
+ * @param Chct0 Complex Hessenberg Compact Matrix [Chc], Target [t].
+ * @param N0 Rows and Columns [N].
+ * @param N1 Threads [N].
+ */
+void Eig_ChctNN_0(Complex* Chct0, const Natural N0, const Natural N1) {
+    Eig_ChctDfPBgNN_N(Chct0, NULL, NULL, NULL, N0, N1);
+}
+
+/**
+ * @brief Eigenvalues [Eig], multithreaded.
+ * 
+ * @param Chsnqt0 Complex Hessenberg Square Matrix [Chsnq], Target [t].
+ * @param N0 Rows and Columns [N].
+ * @param N1 Threads [N].
+ */
+void Eig_ChsnqtNN_0(Complex* Chsnqt0, const Natural N0, const Natural N1) {
+    Cpt_ChsnqtN_0(Chsnqt0, N0);
+    Eig_ChctNN_0(Chsnqt0, N0, N1);
+    Xpd_ChctN_0(Chsnqt0, N0);
+}
+
+// Bulge chasing.
+
+// Chase task.
+typedef struct {
+
+    // Band matrix.
+    Complex* Chbt0;
+
+    // Completed tasks, per sweep.
+    _Atomic Natural* Ntv0;
+
+    // Next sweep, shared.
+    _Atomic Natural Nt0;
+
+    // Rows and Columns.
+    Natural N0;
+
+    // Bandwidth.
+    Natural N1;
+
+} Chase;
+
+/**
+ * @brief Bulge chasing [Chs], one thread.
+ * 
+ * Sweeps are claimed in order, so that the previous one always has a running
+ * owner and any team size works. A task waits for the previous sweep to be
+ * three tasks ahead, the order of overlapping updates being the serial one.
+ * 
+ * @param P0 Chase task, shared.
+ * @return void* NULL.
+ */
+static void* Chs_Ch_0(void* P0) {
+    Chase* Ch0 = (Chase*) P0;
+    register Complex* Cv0 = (Complex*) Alc_NN_P(2 * Ch0->N1, sizeof(Complex));
+    register Natural N0, N1;
+
+    while((N0 = atomic_fetch_add_explicit(&Ch0->Nt0, 1, memory_order_relaxed)) + 2 < Ch0->N0) {
+        for(N1 = 0;; ++N1) {
+            if(N0 > 0)
+                while(atomic_load_explicit(Ch0->Ntv0 + N0 - 1, memory_order_acquire) < N1 + 3)
+                    sched_yield();
+
+            if(!Chs_ChbtCvtNNNN_N(Ch0->Chbt0, Cv0, Ch0->N0, Ch0->N1, N0, N1)) break;
+            atomic_store_explicit(Ch0->Ntv0 + N0, N1 + 1, memory_order_release);
+        }
+
+        atomic_store_explicit(Ch0->Ntv0 + N0, SIZE_MAX, memory_order_release); // Sweep done.
+    }
+
+    Fr_P_0(Cv0);
+    return NULL;
+}
+
+/**
+ * @brief Tridiagonal form [Trd], band, multithreaded.
+ * 
+ * @param Chbt0 Complex Hermitian Band Matrix [Chb], Target [t], overwritten.
+ * @param Rvt0 Real Vector [Rv], Target [t], diagonal.
+ * @param Rvt1 Real Vector [Rv], Target [t], off-diagonal.
+ * @param N0 Rows and Columns [N].
+ * @param N1 Bandwidth [N].
+ * @param N2 Threads [N].
+ */
+void Trd_ChbtRvtRvtNNN_0(Complex* Chbt0, Real* Rvt0, Real* Rvt1, const Natural N0, const Natural N1, const Natural N2) {
+    if(N2 < 2 || N0 < Tn_0_Tn().N2) { Trd_ChbtRvtRvtNN_0(Chbt0, Rvt0, Rvt1, N0, N1); return; }
+
+    _Atomic Natural* Ntv0 = (_Atomic Natural*) Calc_NN_P(N0, sizeof(_Atomic Natural));
+    pthread_t* Th0 = (pthread_t*) Alc_NN_P(N2 - 1, sizeof(pthread_t));
+    Chase Ch0 = {.Chbt0 = Chbt0, .Ntv0 = Ntv0, .Nt0 = 0, .N0 = N0, .N1 = N1};
+    register Natural N3 = 0, N4;
+
+    for(; N3 < N2 - 1; ++N3)
+        if(pthread_create(Th0 + N3, NULL, Chs_Ch_0, &Ch0) != 0) break; // Smaller team.
+
+    Chs_Ch_0(&Ch0);
+
+    for(N4 = 0; N4 < N3; ++N4)
+        pthread_join(Th0[N4], NULL);
+
+    Dgs_ChbRvtRvtNN_0(Chbt0, Rvt0, Rvt1, N0, N1);
+
+    Fr_P_0((void*) Ntv0);
+    Fr_P_0(Th0);
+}
+
+// Subset eigenvalues.
+
+// Subset task.
+typedef struct {
+
+    // Tridiagonal matrix.
+    const Real* Rv0;
+    const Real* Rv1;
+
+    // Eigenvalues.
+    Real* Rvt0;
+
+    // Rows and Columns.
+    Natural N0;
+
+    // Indices, last excluded.
+    Natural N1, N2;
+
+} Interval;
+
+/**
+ * @brief Subset eigenvalues [Sbs], one interval.
+ * 
+ * @param P0 Subset task.
+ * @return void* NULL.
+ */
+static void* Sbs_It_0(void* P0) {
+    const Interval* It0 = (const Interval*) P0;
+    Sbs_RvRvRvtNNN_0(It0->Rv0, It0->Rv1, It0->Rvt0, It0->N0, It0->N1, It0->N2);
+
+    return NULL;
+}
+
+/**
+ * @brief Subset eigenvalues [Sbs], by index, multithreaded.
+ * 
+ * Indices are split into contiguous intervals, one per thread, each being
+ * bisected on its own. Intervals whose thread cannot be created are handled by
+ * the caller.
+ * 
+ * @param Rv0 Real Vector [Rv], diagonal.
+ * @param Rv1 Real Vector [Rv], off-diagonal.
+ * @param Rvt0 Real Vector [Rv], Target [t], N2 - N1 ascending eigenvalues.
+ * @param N0 Rows and Columns [N].
+ * @param N1 First index [N].
+ * @param N2 Last index, excluded [N].
+ * @param N3 Threads [N].
+ */
+void Sbs_RvRvRvtNNNN_0(const Real* Rv0, const Real* Rv1, Real* Rvt0, const Natural N0, const Natural N1, const Natural N2, const Natural N3) {
+    const register Natural N4 = N2 > N1 ? N2 - N1 : 0; // Eigenvalues.
+    const register Natural N5 = N3 < N4 ? N3 : N4; // Intervals.
+
+    if(N5 < 2 || N0 < Tn_0_Tn().N2) { Sbs_RvRvRvtNNN_0(Rv0, Rv1, Rvt0, N0, N1, N2); return; }
+
+    pthread_t* Th0 = (pthread_t*) Alc_NN_P(N5 - 1, sizeof(pthread_t));
+    Interval* It0 = (Interval*) Alc_NN_P(N5, sizeof(Interval));
+    register Natural N6 = 0, N7;
+
+    for(; N6 < N5; ++N6)
+        It0[N6] = (Interval) {.Rv0 = Rv0, .Rv1 = Rv1, .Rvt0 = Rvt0 + N6 * N4 / N5, .N0 = N0, .N1 = N1 + N6 * N4 / N5, .N2 = N1 + (N6 + 1) * N4 / N5};
+
+    for(N6 = 1; N6 < N5; ++N6)
+        if(pthread_create(Th0 + N6 - 1, NULL, Sbs_It_0, It0 + N6) != 0) break; // Smaller team.
+
+    for(N7 = N6; N7 < N5; ++N7) // Fallback.
+        Sbs_It_0(It0 + N7);
+
+    Sbs_It_0(It0);
+
+    for(N7 = 1; N7 < N6; ++N7)
+        pthread_join(Th0[N7 - 1], NULL);
+
+    Fr_P_0(Th0);
+    Fr_P_0(It0);
+}
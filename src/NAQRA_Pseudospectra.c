@@ -0,0 +1,218 @@
+/**
+ * @file NAQRA_Pseudospectra.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief include/Pseudospectra.h implementation.
+ * @date 2024-12-19
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <pthread.h>
+#include "../include/Pseudospectra.h"
+
+// Schur form.
+
+/**
+ * @brief Schur form [Sch].
+ * 
+ * Hessenberg form and QR algorithm, the deflated subdiagonal being zeroed.
+ * 
+ * @param Cqt0 Complex Square Matrix [Cq], Target [t], upper triangular Schur form on exit if converged.
+ * @param N0 Rows and Columns [N].
+ * @return Natural Status [N], STS_*.
+ */
+Natural Sch_CqtN_N(Complex* Cqt0, const Natural N0) {
+    register Natural N1, N2;
+
+    if(N0 < 2) return STS_CONVERGED; // Already triangular.
+
+    if(N0 > 2) Hsn_CqtN_0(Cqt0, N0); // Hessenberg.
+    const register Natural N3 = Eig_ChsnqtDfPBgN_N(Cqt0, NULL, NULL, NULL, N0); // Schur.
+
+    if(N3 != STS_CONVERGED) return N3;
+
+    for(N1 = 0; N1 < N0; ++N1) // Zeroing.
+        for(N2 = N1 + 1; N2 < N0; ++N2)
+            Cqt0[N1 * N0 + N2] = C_R_C(0.0);
+
+    return STS_CONVERGED;
+}
+
+// Smallest singular values.
+
+/**
+ * @brief Smallest singular value [Smn], inverse Lanczos, given the scratch.
+ * 
+ * Lanczos on ((zI - T)^H (zI - T))^-1, applied through a forward solve with
+ * (zI - T)^H and a backward one with zI - T, until the largest Ritz value
+ * settles within PSD0.
+ * 
+ * @param Cu0 Complex Upper Triangular Matrix [Cu].
+ * @param C0 Complex Number [C], point.
+ * @param Cv0 Complex Vector [Cv], scratch, 3 * N0 entries.
+ * @param Rv0 Real Vector [Rv], scratch, 4 * PSD1 entries.
+ * @param N0 Rows and Columns [N].
+ * @return Real Smallest singular value of zI - T.
+ */
+static Real Smn_CuCCvRvN_R(const Complex* Cu0, const Complex C0, Complex* Cv0, Real* Rv0, const Natural N0) {
+    register Complex* Cv1 = Cv0; // Previous Lanczos vector.
+    register Complex* Cv2 = Cv0 + N0; // Lanczos vector.
+    register Complex* Cv3 = Cv0 + 2 * N0; // Next Lanczos vector.
+    register Complex* Cv4;
+
+    register Natural N1, N2;
+    register Real R0 = 0.0, R1 = 0.0, R2; // Largest Ritz value, off-diagonal, diagonal.
+
+    for(N1 = 0; N1 < N0; ++N1) // Eigenvalue.
+        if(N2_C_R(S_CC_C(C0, Cu0[N1 * (N0 + 1)])) == 0.0) return 0.0;
+
+    for(N1 = 0; N1 < N0; ++N1) { // Starting vector, unit modulus entries of scattered phases.
+        Cv1[N1] = C_R_C(0.0);
+        Cv2[N1] = C_RR_C(cos(0.5 * (Real) (N1 * N1)), sin(0.5 * (Real) (N1 * N1)));
+    }
+
+    D_CvR_0(Cv2, sqrt((Real) N0), N0);
+
+    for(N1 = 0; N1 < PSD1; ++N1) {
+        Cp_CvtCvN_0(Cv3, Cv2, N0);
+
+        for(N2 = 0; N2 < N0; ++N2) // (zI - T)^-H, forward.
+            Cv3[N2] = D_CC_C(A_CC_C(Cv3[N2], Dot_CrvCcvN_C(Cv3, Cu0 + N2 * N0, N2)), Cj_C_C(S_CC_C(C0, Cu0[N2 * (N0 + 1)])));
+
+        for(N2 = N0; N2-- > 0;) { // (zI - T)^-1, backward.
+            Cv3[N2] = D_CC_C(Cv3[N2], S_CC_C(C0, Cu0[N2 * (N0 + 1)]));
+            Ma_CvtCvCN_0(Cv3, Cu0 + N2 * N0, Cv3[N2], N2);
+        }
+
+        // Three-term recurrence.
+
+        Ma_CvtCvCN_0(Cv3, Cv1, C_R_C(-R1), N0);
+        R2 = vgetq_lane_f64(Dot_CrvCcvN_C(Cv3, Cv2, N0), 0);
+        Ma_CvtCvCN_0(Cv3, Cv2, C_R_C(-R2), N0);
+        R1 = N2_CvN_R(Cv3, N0);
+
+        Rv0[N1] = R2;
+        Rv0[PSD1 + N1] = R1;
+
+        // Largest Ritz value.
+
+        for(N2 = 0; N2 <= N1; ++N2) {
+            Rv0[2 * PSD1 + N2] = Rv0[N2];
+            Rv0[3 * PSD1 + N2] = Rv0[PSD1 + N2];
+        }
+
+        Eig_RvtRvtN_0(Rv0 + 2 * PSD1, Rv0 + 3 * PSD1, N1 + 1);
+        R2 = Rv0[2 * PSD1 + N1];
+
+        if(fabs(R2 - R0) <= PSD0 * R2 || R1 <= TOL0 * R2) { R0 = R2; break; } // Convergence or invariant subspace.
+        R0 = R2;
+
+        D_CvR_0(Cv3, R1, N0);
+
+        Cv4 = Cv1; // Rotation.
+        Cv1 = Cv2;
+        Cv2 = Cv3;
+        Cv3 = Cv4;
+    }
+
+    return R0 > 0.0 ? 1.0 / sqrt(R0) : 0.0;
+}
+
+/**
+ * @brief Smallest singular value [Smn], inverse Lanczos.
+ * 
+ * @param Cu0 Complex Upper Triangular Matrix [Cu].
+ * @param C0 Complex Number [C], point.
+ * @param N0 Rows and Columns [N].
+ * @return Real Smallest singular value of zI - T.
+ */
+Real Smn_CuCN_R(const Complex* Cu0, const Complex C0, const Natural N0) {
+    Complex* Cv0 = (Complex*) Alc_NN_P(3 * N0, sizeof(Complex));
+    Real* Rv0 = (Real*) Alc_NN_P(4 * PSD1, sizeof(Real));
+
+    const register Real R0 = Smn_CuCCvRvN_R(Cu0, C0, Cv0, Rv0, N0);
+
+    Fr_P_0(Cv0);
+    Fr_P_0(Rv0);
+
+    return R0;
+}
+
+// Pseudospectrum task.
+typedef struct {
+
+    // Upper triangular matrix.
+    const Complex* Cu0;
+
+    // Points.
+    const Complex* Cv0;
+
+    // Smallest singular values.
+    Real* Rvt0;
+
+    // Rows and Columns.
+    Natural N0;
+
+    // Points' count.
+    Natural N1;
+
+    // Next point, shared.
+    atomic_size_t* N2;
+
+} Grid;
+
+/**
+ * @brief Smallest singular values [Psd], one thread.
+ * 
+ * @param P0 Pseudospectrum task.
+ * @return void* NULL.
+ */
+static void* Psd_Gr_0(void* P0) {
+    const Grid* Gr0 = (const Grid*) P0;
+    Complex* Cv0 = (Complex*) Alc_NN_P(3 * Gr0->N0, sizeof(Complex));
+    Real* Rv0 = (Real*) Alc_NN_P(4 * PSD1, sizeof(Real));
+    register Natural N0;
+
+    while((N0 = atomic_fetch_add_explicit(Gr0->N2, 1, memory_order_relaxed)) < Gr0->N1)
+        Gr0->Rvt0[N0] = Smn_CuCCvRvN_R(Gr0->Cu0, Gr0->Cv0[N0], Cv0, Rv0, Gr0->N0);
+
+    Fr_P_0(Cv0);
+    Fr_P_0(Rv0);
+
+    return NULL;
+}
+
+/**
+ * @brief Smallest singular values [Psd], multithreaded.
+ * 
+ * Points are handed out one at a time, as their iterations vary, so that
+ * threads which cannot be created simply leave theirs to the others.
+ * 
+ * @param Cu0 Complex Upper Triangular Matrix [Cu].
+ * @param Cv0 Complex Vector [Cv], points.
+ * @param Rvt0 Real Vector [Rv], Target [t], smallest singular values of zI - T.
+ * @param N0 Rows and Columns [N].
+ * @param N1 Points [N].
+ * @param N2 Threads [N].
+ */
+void Psd_CuCvRvtNNN_0(const Complex* Cu0, const Complex* Cv0, Real* Rvt0, const Natural N0, const Natural N1, const Natural N2) {
+    const register Natural N3 = N2 < N1 ? N2 : N1; // Threads.
+    atomic_size_t N4 = 0; // Next point.
+    const Grid Gr0 = {.Cu0 = Cu0, .Cv0 = Cv0, .Rvt0 = Rvt0, .N0 = N0, .N1 = N1, .N2 = &N4};
+
+    if(N3 < 2) { Psd_Gr_0((void*) &Gr0); return; }
+
+    pthread_t* Th0 = (pthread_t*) Alc_NN_P(N3 - 1, sizeof(pthread_t));
+    register Natural N5, N6;
+
+    for(N5 = 1; N5 < N3; ++N5)
+        if(pthread_create(Th0 + N5 - 1, NULL, Psd_Gr_0, (void*) &Gr0) != 0) break; // Smaller team.
+
+    Psd_Gr_0((void*) &Gr0);
+
+    for(N6 = 1; N6 < N5; ++N6)
+        pthread_join(Th0[N6 - 1], NULL);
+
+    Fr_P_0(Th0);
+}
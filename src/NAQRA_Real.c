@@ -0,0 +1,301 @@
+/**
+ * @file NAQRA_Real.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief include/Real.h implementation.
+ * @date 2024-12-13
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "../include/Real.h"
+#include "../include/Generic.h"
+
+// Balancing.
+
+/**
+ * @brief Balance [Bln], diagonal similarity by powers of 2.
+ *
+ * Rows and columns are scaled until their off-diagonal 1-norms are within a
+ * factor of 2 of each other, as in LAPACK's dgebal. The scaling is exact and
+ * keeps the eigenvalues and the Hessenberg form.
+ *
+ * @param Rqt0 Real Square Matrix [Rq], Target [t].
+ * @param N0 Rows and Columns [N].
+ */
+void Bln_RqtN_0(Real* Rqt0, const Natural N0) {
+    register Natural N1, N2;
+    register Real R0, R1, R2, R3, R4;
+    register bool B0 = true; // Unbalanced.
+
+    while(B0) {
+        B0 = false;
+
+        for(N1 = 0; N1 < N0; ++N1) {
+            for(N2 = 0, R0 = 0.0, R1 = 0.0; N2 < N0; ++N2) { // Column and row norms.
+                if(N2 == N1) continue;
+
+                R0 += fabs(Rqt0[N1 * N0 + N2]);
+                R1 += fabs(Rqt0[N2 * N0 + N1]);
+            }
+
+            if(R0 == 0.0 || R1 == 0.0) continue;
+
+            R3 = 1.0; // Column's factor.
+            R4 = R0 + R1;
+
+            for(R2 = R1 / 2.0; R0 < R2; R0 *= 4.0, R3 *= 2.0); // Column norm, times the factor squared.
+            for(R2 = R1 * 2.0; R0 > R2; R0 /= 4.0, R3 /= 2.0);
+
+            if((R0 + R1) / R3 >= 0.95 * R4) continue;
+
+            B0 = true;
+
+            for(N2 = 0; N2 < N0; ++N2) { // Scaling.
+                Rqt0[N1 * N0 + N2] *= R3;
+                Rqt0[N2 * N0 + N1] /= R3;
+            }
+        }
+    }
+}
+
+// Hessenberg form.
+
+/**
+ * @brief Hessenberg form [Hsn].
+ *
+ * @param Rqt0 Real Square Matrix [Rq], Target [t].
+ * @param N0 Rows and Columns [N].
+ */
+void Hsn_RqtN_0(Real* Rqt0, const Natural N0) {
+    register Real* Rv0 = (Real*) Alc_NN_P(N0, sizeof(Real)); // Householder vector.
+    register Real* Rv1 = (Real*) Alc_NN_P(N0, sizeof(Real)); // Products.
+
+    register Natural N1 = 0, N2, N3;
+    register Real R0, R1;
+
+    for(; N1 + 2 < N0; ++N1) {
+        const register Natural N4 = N0 - N1 - 1; // Entries.
+        Real* Rv2 = Rqt0 + N1 * (N0 + 1) + 1; // Subcolumn.
+
+        // Householder vector.
+
+        if((R0 = N2g_RvN_R(Rv2, N4)) == 0.0) continue; // Reduced column.
+
+        R0 = copysign(R0, Rv2[0]);
+
+        for(N2 = 0; N2 < N4; ++N2)
+            Rv0[N2] = Rv2[N2];
+
+        Rv0[0] += R0;
+
+        R1 = N2g_RvN_R(Rv0, N4);
+        R1 = 2.0 / (R1 * R1);
+
+        // Householder products, left.
+
+        for(N2 = N1 + 1; N2 < N0; ++N2) {
+            Real* Rv3 = Rqt0 + N2 * N0 + N1 + 1;
+            Mag_RvtRvRN_0(Rv3, Rv0, -R1 * Dotg_RvRvN_R(Rv3, Rv0, N4), N4);
+        }
+
+        // Householder products, right.
+
+        for(N2 = 0; N2 < N0; ++N2)
+            Rv1[N2] = 0.0;
+
+        for(N3 = 0; N3 < N4; ++N3)
+            Mag_RvtRvRN_0(Rv1, Rqt0 + (N1 + 1 + N3) * N0, Rv0[N3], N0);
+
+        for(N3 = 0; N3 < N4; ++N3)
+            Mag_RvtRvRN_0(Rqt0 + (N1 + 1 + N3) * N0, Rv1, -R1 * Rv0[N3], N0);
+
+        // Zeroing.
+
+        Rv2[0] = -R0;
+
+        for(N2 = 1; N2 < N4; ++N2)
+            Rv2[N2] = 0.0;
+    }
+
+    Fr_P_0(Rv0);
+    Fr_P_0(Rv1);
+}
+
+// QR algorithm.
+
+/**
+ * @brief Eigenvalues [Eig], Francis double shifted QR.
+ *
+ * Only the active block is updated, the Schur form being left incomplete.
+ * Subdiagonals deflate against their neighbourhood to the unit roundoff, as
+ * in LAPACK's dlahqr, so that zero diagonals do not fall back to the norm.
+ *
+ * @param Rhsnqt0 Real Hessenberg Square Matrix [Rhsnq], Target [t].
+ * @param Cvt0 Complex Vector [Cv], Target [t], eigenvalues.
+ * @param N0 Rows and Columns [N].
+ * @return bool Convergence, false if an eigenvalue took more than RQR0 steps.
+ */
+bool Eig_RhsnqtCvtN_B(Real* Rhsnqt0, Complex* Cvt0, const Natural N0) {
+    register Integer I0 = (Integer) N0 - 1, I1, I2, I3, I4, I5; // Last active row, split, start, step, loops.
+    register Natural N1 = 0, N2 = 0; // Steps, total steps.
+    register Real R1 = 0.0; // Accumulated shift.
+    register Real R2, R3, R4, R5, R6 = 0.0, R7 = 0.0, R8 = 0.0, R9, R10, R11;
+
+    const register Real R0 = 0x1.0p-1022 * ((Real) N0 / RQR2); // Negligible entries.
+
+    while(I0 >= 0) {
+        for(I1 = I0; I1 > 0; --I1) { // Deflation.
+            R9 = fabs(Rhsnqt0[(I1 - 1) * (N0 + 1) + 1]); // Subdiagonal.
+            if(R9 <= R0) break;
+
+            R5 = fabs(Rhsnqt0[(I1 - 1) * (N0 + 1)]) + fabs(Rhsnqt0[I1 * (N0 + 1)]);
+
+            if(R5 == 0.0) { // Neighbouring subdiagonals.
+                if(I1 > 1) R5 += fabs(Rhsnqt0[(I1 - 2) * (N0 + 1) + 1]);
+                if(I1 < I0) R5 += fabs(Rhsnqt0[I1 * (N0 + 1) + 1]);
+            }
+
+            if(R9 > RQR2 * R5) continue;
+
+            R10 = fabs(Rhsnqt0[I1 * N0 + I1 - 1]); // Superdiagonal.
+            R6 = fmax(R9, R10); R7 = fmin(R9, R10);
+
+            R10 = fabs(Rhsnqt0[I1 * (N0 + 1)]);
+            R11 = fabs(Rhsnqt0[(I1 - 1) * (N0 + 1)] - Rhsnqt0[I1 * (N0 + 1)]);
+            R8 = fmax(R10, R11); R10 = fmin(R10, R11);
+
+            R11 = R8 + R6;
+            if(R7 * (R6 / R11) <= fmax(R0, RQR2 * (R10 * (R8 / R11)))) break;
+        }
+
+        if(I1 > 0) Rhsnqt0[(I1 - 1) * (N0 + 1) + 1] = 0.0;
+
+        R2 = Rhsnqt0[I0 * (N0 + 1)];
+
+        if(I1 == I0) { // Single root.
+            Cvt0[I0--] = C_RR_C(R2 + R1, 0.0);
+            N1 = 0;
+            continue;
+        }
+
+        R3 = Rhsnqt0[(I0 - 1) * (N0 + 1)];
+        R4 = Rhsnqt0[(I0 - 1) * (N0 + 1) + 1] * Rhsnqt0[I0 * N0 + I0 - 1];
+
+        if(I1 == I0 - 1) { // Double root.
+            R6 = 0.5 * (R3 - R2);
+            R7 = R6 * R6 + R4;
+            R8 = sqrt(fabs(R7));
+            R2 += R1;
+
+            if(R7 >= 0.0) { // Real pair.
+                R8 = R6 + copysign(R8, R6);
+                Cvt0[I0 - 1] = C_RR_C(R2 + R8, 0.0);
+                Cvt0[I0] = C_RR_C(R8 != 0.0 ? R2 - R4 / R8 : R2 + R8, 0.0);
+            } else { // Complex conjugate pair.
+                Cvt0[I0 - 1] = C_RR_C(R2 + R6, -R8);
+                Cvt0[I0] = C_RR_C(R2 + R6, R8);
+            }
+
+            I0 -= 2;
+            N1 = 0;
+            continue;
+        }
+
+        if(N1 >= RQR0) break; // Unconverged.
+
+        if(N1 > 0 && N1 % RQR1 == 0) { // Exceptional shift.
+            R1 += R2;
+
+            for(I5 = 0; I5 <= I0; ++I5)
+                Rhsnqt0[I5 * (N0 + 1)] -= R2;
+
+            R5 = fabs(Rhsnqt0[(I0 - 1) * (N0 + 1) + 1]) + fabs(Rhsnqt0[(I0 - 2) * (N0 + 1) + 1]);
+            R2 = R3 = 0.75 * R5;
+            R4 = -0.4375 * R5 * R5;
+        }
+
+        ++N1;
+        ++N2;
+
+        // Start, two consecutive small subdiagonals.
+
+        for(I2 = I0 - 2; I2 >= I1; --I2) {
+            R9 = Rhsnqt0[I2 * (N0 + 1)];
+            R8 = R2 - R9;
+            R5 = R3 - R9;
+            R6 = (R8 * R5 - R4) / Rhsnqt0[I2 * (N0 + 1) + 1] + Rhsnqt0[(I2 + 1) * N0 + I2];
+            R7 = Rhsnqt0[(I2 + 1) * (N0 + 1)] - R9 - R8 - R5;
+            R8 = Rhsnqt0[(I2 + 1) * (N0 + 1) + 1];
+            R5 = fabs(R6) + fabs(R7) + fabs(R8);
+            R6 /= R5; R7 /= R5; R8 /= R5;
+
+            if(I2 == I1) break;
+
+            R10 = fabs(Rhsnqt0[(I2 - 1) * (N0 + 1) + 1]) * (fabs(R7) + fabs(R8));
+            R11 = fabs(R6) * (fabs(Rhsnqt0[(I2 - 1) * (N0 + 1)]) + fabs(R9) + fabs(Rhsnqt0[(I2 + 1) * (N0 + 1)]));
+
+            if(R10 <= RQR2 * R11) break;
+        }
+
+        for(I5 = I2 + 2; I5 <= I0; ++I5) { // Bulge's room.
+            Rhsnqt0[(I5 - 2) * N0 + I5] = 0.0;
+            if(I5 != I2 + 2) Rhsnqt0[(I5 - 3) * N0 + I5] = 0.0;
+        }
+
+        // Bulge chasing, 3 x 3 reflectors.
+
+        for(I3 = I2; I3 < I0; ++I3) {
+            if(I3 != I2) {
+                R6 = Rhsnqt0[(I3 - 1) * N0 + I3];
+                R7 = Rhsnqt0[(I3 - 1) * N0 + I3 + 1];
+                R8 = I3 != I0 - 1 ? Rhsnqt0[(I3 - 1) * N0 + I3 + 2] : 0.0;
+
+                if((R2 = fabs(R6) + fabs(R7) + fabs(R8)) != 0.0) { R6 /= R2; R7 /= R2; R8 /= R2; }
+            }
+
+            if((R5 = copysign(sqrt(R6 * R6 + R7 * R7 + R8 * R8), R6)) == 0.0) continue;
+
+            if(I3 == I2) {
+                if(I1 != I2) Rhsnqt0[(I3 - 1) * N0 + I3] = -Rhsnqt0[(I3 - 1) * N0 + I3];
+            } else
+                Rhsnqt0[(I3 - 1) * N0 + I3] = -R5 * R2;
+
+            R6 += R5;
+            R2 = R6 / R5; R3 = R7 / R5; R9 = R8 / R5;
+            R7 /= R6; R8 /= R6;
+
+            for(I4 = I3; I4 <= I0; ++I4) { // Rows.
+                Real* Rv0 = Rhsnqt0 + I4 * N0 + I3;
+
+                R6 = Rv0[0] + R7 * Rv0[1];
+
+                if(I3 != I0 - 1) {
+                    R6 += R8 * Rv0[2];
+                    Rv0[2] -= R6 * R9;
+                }
+
+                Rv0[1] -= R6 * R3;
+                Rv0[0] -= R6 * R2;
+            }
+
+            for(I5 = I1; I5 <= (I0 < I3 + 3 ? I0 : I3 + 3); ++I5) { // Columns.
+                R6 = R2 * Rhsnqt0[I3 * N0 + I5] + R3 * Rhsnqt0[(I3 + 1) * N0 + I5];
+
+                if(I3 != I0 - 1) {
+                    R6 += R9 * Rhsnqt0[(I3 + 2) * N0 + I5];
+                    Rhsnqt0[(I3 + 2) * N0 + I5] -= R6 * R8;
+                }
+
+                Rhsnqt0[(I3 + 1) * N0 + I5] -= R6 * R7;
+                Rhsnqt0[I3 * N0 + I5] -= R6;
+            }
+        }
+    }
+
+    #ifndef NVERBOSE
+    printf("--- Real QR Algorithm\nExited after %zu iterations%s.\n---\n", N2, I0 >= 0 ? ", unconverged" : "");
+    #endif
+
+    return I0 < 0;
+}
@@ -0,0 +1,362 @@
+/**
+ * @file NAQRA_Single.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief include/Single.h implementation.
+ * @date 2024-12-04
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <stdlib.h>
+#include <memory.h>
+#include "../include/Single.h"
+#include "../include/Generic.h"
+
+// Single complex arithmetic.
+
+/**
+ * @brief Multiply [M].
+ * 
+ * @param Cs0 Single Complex Number [Cs].
+ * @param Cs1 Single Complex Number [Cs].
+ * @return Complexs Single Complex Number [Cs].
+ */
+static inline Complexs M_CsCs_Cs(const Complexs Cs0, const Complexs Cs1) { return vget_low_f32(M_Cs2Cs2_Cs2(Dp_Cs_Cs2(Cs0), Dp_Cs_Cs2(Cs1))); }
+
+/**
+ * @brief Conjugate [Cj].
+ * 
+ * @param Cs0 Single Complex Number [Cs].
+ * @return Complexs Single Complex Number [Cs].
+ */
+static inline Complexs Cj_Cs_Cs(const Complexs Cs0) { const register Complexs Cs1 = {1.0f, -1.0f}; return vmul_f32(Cs0, Cs1); }
+
+// Vectors.
+
+// Copy.
+
+/**
+ * @brief Copy [Cp].
+ * 
+ * @param Csvt0 Single Complex Vector [Csv], Target [t].
+ * @param Csv0 Single Complex Vector [Csv].
+ * @param N0 Entries [N].
+ */
+void Cp_CsvtCsvN_0(Complexs* Csvt0, const Complexs* Csv0, const Natural N0) {
+    memcpy(Csvt0, Csv0, N0 * sizeof(Complexs));
+}
+
+/**
+ * @brief Demote [Dm].
+ * 
+ * @param Csvt0 Single Complex Vector [Csv], Target [t].
+ * @param Cv0 Complex Vector [Cv].
+ * @param N0 Entries [N].
+ */
+void Dm_CsvtCvN_0(Complexs* Csvt0, const Complex* Cv0, const Natural N0) {
+    register Natural N1 = 0;
+
+    for(; N1 < N0; ++N1)
+        Csvt0[N1] = Dm_C_Cs(Cv0[N1]);
+}
+
+/**
+ * @brief Promote [Pm].
+ * 
+ * @param Cvt0 Complex Vector [Cv], Target [t].
+ * @param Csv0 Single Complex Vector [Csv].
+ * @param N0 Entries [N].
+ */
+void Pm_CvtCsvN_0(Complex* Cvt0, const Complexs* Csv0, const Natural N0) {
+    register Natural N1 = 0;
+
+    for(; N1 < N0; ++N1)
+        Cvt0[N1] = Pm_Cs_C(Csv0[N1]);
+}
+
+// Complex-Real arithmetic.
+
+/**
+ * @brief Multiply [M].
+ * 
+ * @param Csvt0 Single Complex Vector [Csv], Target [t].
+ * @param Rs0 Single Real Number [Rs].
+ * @param N0 Entries [N].
+ */
+void M_CsvRs_0(Complexs* Csvt0, const Reals Rs0, const Natural N0) {
+    register Natural N1 = 0;
+    const register Complexs2 Cs20 = vdupq_n_f32(Rs0);
+
+    for(; N1 + 3 < N0; N1 += 4) {
+        St_CsvtCs2_0(Csvt0 + N1, vmulq_f32(Ld_Csv_Cs2(Csvt0 + N1), Cs20));
+        St_CsvtCs2_0(Csvt0 + N1 + 2, vmulq_f32(Ld_Csv_Cs2(Csvt0 + N1 + 2), Cs20));
+    }
+
+    for(; N1 < N0; ++N1)
+        Csvt0[N1] = vmul_f32(Csvt0[N1], vget_low_f32(Cs20));
+}
+
+/**
+ * @brief Divide [D].
+ * 
+ * @param Csvt0 Single Complex Vector [Csv], Target [t].
+ * @param Rs0 Single Real Number [Rs].
+ * @param N0 Entries [N].
+ */
+void D_CsvRs_0(Complexs* Csvt0, const Reals Rs0, const Natural N0) {
+    register Natural N1 = 0;
+    const register Complexs2 Cs20 = vdupq_n_f32(Rs0);
+
+    for(; N1 + 3 < N0; N1 += 4) {
+        St_CsvtCs2_0(Csvt0 + N1, vdivq_f32(Ld_Csv_Cs2(Csvt0 + N1), Cs20));
+        St_CsvtCs2_0(Csvt0 + N1 + 2, vdivq_f32(Ld_Csv_Cs2(Csvt0 + N1 + 2), Cs20));
+    }
+
+    for(; N1 < N0; ++N1)
+        Csvt0[N1] = vdiv_f32(Csvt0[N1], vget_low_f32(Cs20));
+}
+
+// Dot product.
+
+/**
+ * @brief Dot [Dot].
+ * 
+ * @param Csrv0 Single Complex Row Vector [Csrv].
+ * @param Cscv0 Single Complex Column Vector [Cscv].
+ * @param N0 Entries [N].
+ * @return Complexs Single Complex Number [Cs].
+ */
+Complexs Dot_CsrvCscvN_Cs(const Complexs* Csrv0, const Complexs* Cscv0, const Natural N0) { return Dotg_CsvCsvN_Cs(Csrv0, Cscv0, N0); }
+
+// Norms.
+
+/**
+ * @brief Norm 2 [N2].
+ * 
+ * @param Csv0 Single Complex Vector [Csv].
+ * @param N0 Entries [N].
+ * @return Reals Single Real Number [Rs].
+ */
+Reals N2_CsvN_Rs(const Complexs* Csv0, const Natural N0) { return N2g_CsvN_Rs(Csv0, N0); }
+
+/**
+ * @brief Normalize 2 [Nz2].
+ * 
+ * @param Csvt0 Single Complex Vector [Csv], Target [t].
+ * @param N0 Entries [N].
+ */
+void Nz2_CsvN_0(Complexs* Csvt0, const Natural N0) { const register Reals Rs0 = N2_CsvN_Rs(Csvt0, N0); D_CsvRs_0(Csvt0, Rs0, N0); }
+
+// Matrices.
+
+// Householder products.
+
+/**
+ * @brief Householder Left [Hsl].
+ * 
+ * @param Csqt0 Single Complex Square Matrix [Csq], Target [t].
+ * @param Csv0 Single Complex Vector [Csv].
+ * @param N0 Rows and Columns [N].
+ * @param N1 Entries [N].
+ */
+void Hsl_CsqtCsvNN_0(Complexs* Csqt0, const Complexs* Csv0, const Natural N0, const Natural N1) { Hslg_CsqtCsvNN_0(Csqt0, Csv0, N0, N1); }
+
+/**
+ * @brief Householder Right [Hsr].
+ * 
+ * @param Csqt0 Single Complex Square Matrix [Csq], Target [t].
+ * @param Csv0 Single Complex Vector [Csv].
+ * @param N0 Rows and Columns [N].
+ * @param N1 Entries [N].
+ */
+void Hsr_CsqtCsvNN_0(Complexs* Csqt0, const Complexs* Csv0, const Natural N0, const Natural N1) { Hsrg_CsqtCsvNN_0(Csqt0, Csv0, N0, N1); }
+
+// Givens products.
+
+/**
+ * @brief Givens Left [Gvl].
+ * 
+ * @param Cshsnqt0 Single Complex Hessenberg Square Matrix [Cshsnq], Target [t].
+ * @param Cs0 Single Complex Number [Cs].
+ * @param Cs1 Single Complex Number [Cs].
+ * @param N0 Rows and Columns [N].
+ * @param N1 Index [N].
+ */
+void Gvl_CshsnqtCsCsNN_0(Complexs* Cshsnqt0, const Complexs Cs0, const Complexs Cs1, const Natural N0, const Natural N1) {
+    register Natural N2 = (N1 + 1) * N0 + N1;
+
+    // Both rows of a column fit a single register.
+    const register Complexs2 Cs20 = vcombine_f32(Cj_Cs_Cs(Cs0), Cs0);
+    const register Complexs2 Cs21 = vcombine_f32(Cj_Cs_Cs(Cs1), vneg_f32(Cs1));
+
+    for(; N2 < N0 * N0; N2 += N0) {
+        const register Complexs2 Cs22 = Ld_Csv_Cs2(Cshsnqt0 + N2);
+        St_CsvtCs2_0(Cshsnqt0 + N2, vaddq_f32(M_Cs2Cs2_Cs2(Cs20, Cs22), M_Cs2Cs2_Cs2(Cs21, vextq_f32(Cs22, Cs22, 2))));
+    }
+}
+
+/**
+ * @brief Hermitian Givens Right [Gvrhr].
+ * 
+ * @param Cshsnqt0 Single Complex Hessenberg Square Matrix [Cshsnq], Target [t].
+ * @param Cs0 Single Complex Number [Cs].
+ * @param Cs1 Single Complex Number [Cs].
+ * @param N0 Rows and Columns [N].
+ * @param N1 Index [N].
+ */
+void Gvrhr_CshsnqtCsCsNN_0(Complexs* Cshsnqt0, const Complexs Cs0, const Complexs Cs1, const Natural N0, const Natural N1) { Gvrhrg_CshsnqtCsCsNN_0(Cshsnqt0, Cs0, Cs1, N0, N1); }
+
+// Hessenberg form.
+
+/**
+ * @brief Hessenberg form [Hsn].
+ * 
+ * @param Csqt0 Single Complex Square Matrix [Csq], Target [t].
+ * @param N0 Rows and Columns [N].
+ */
+void Hsn_CsqtN_0(Complexs* Csqt0, const Natural N0) {
+    register Natural N1 = 0;
+    register Complexs* Csv0 = (Complexs*) Calc_NN_P(N0, sizeof(Complexs));
+    register Complexs* Csv1 = (Complexs*) Calc_NN_P(N0 - 2, sizeof(Complexs)); // Zeros.
+
+    for(; N1 < N0 - 2; ++N1) {
+
+        const register Natural N3 = N0 - N1 - 1; // Entries.
+
+        // Householder vector.
+
+        Cp_CsvtCsvN_0(Csv0 + N1 + 1, Csqt0 + N1 * (N0 + 1) + 1, N3); // Copy.
+
+        const register Real R0 = (Real) N2_CsvN_Rs(Csv0 + N1 + 1, N3);
+        if(R0 == 0.0) continue; // Reduced column.
+
+        // Direction, any phase for a zero leading entry.
+        const register Complex C0 = Pm_Cs_C(Csv0[N1 + 1]);
+        Csv0[N1 + 1] = Dm_C_Cs(A_CC_C(C0, M_CR_C(N2_C_R(C0) > 0.0 ? Nzd2_C_C(C0) : C_R_C(1.0), R0)));
+        Nz2_CsvN_0(Csv0 + N1 + 1, N3); // Normalization.
+
+        // Householder products.
+
+        Hsl_CsqtCsvNN_0(Csqt0, Csv0, N0, N3);
+        Hsr_CsqtCsvNN_0(Csqt0, Csv0, N0, N3);
+
+        // Zeroing.
+
+        Cp_CsvtCsvN_0(Csqt0 + N1 * (N0 + 1) + 2, Csv1, N0 - N1 - 2);
+    }
+
+    Fr_P_0(Csv0);
+    Fr_P_0(Csv1);
+}
+
+// QR algorithm.
+
+/**
+ * @brief Shifted QR step [Qrs].
+ * 
+ * @param Cshsnqt0 Single Complex Hessenberg Square Matrix [Cshsnq], Target [t].
+ * @param Csvt0 Single Complex Vector [Csv], Target [t], Givens coefficients.
+ * @param Cs0 Single Complex Number [Cs], Shift.
+ * @param N0 Rows and Columns [N].
+ * @param N1 Last active index [N].
+ */
+void Qrs_CshsnqtCsvtCsNN_0(Complexs* Cshsnqt0, Complexs* Csvt0, const Complexs Cs0, const Natural N0, const Natural N1) {
+    register Natural N2;
+
+    for(N2 = 0; N2 < N1 + 1; ++N2) // Shift (-).
+        Cshsnqt0[N2 * (N0 + 1)] = vsub_f32(Cshsnqt0[N2 * (N0 + 1)], Cs0);
+
+    for(N2 = 0; N2 < N1; ++N2) { // QR.
+        const register Complex C0 = Pm_Cs_C(Cshsnqt0[N2 * (N0 + 1)]);
+        const register Complex C1 = Pm_Cs_C(Cshsnqt0[N2 * (N0 + 1) + 1]);
+
+        const register Real R0 = sqrt(vaddvq_f64(vmulq_f64(C0, C0)) + vaddvq_f64(vmulq_f64(C1, C1))); // Norm.
+
+        // Normalization.
+        Csvt0[2 * N2] = Dm_C_Cs(D_CR_C(C0, R0));
+        Csvt0[2 * N2 + 1] = Dm_C_Cs(D_CR_C(C1, R0));
+
+        // First product.
+        Cshsnqt0[N2 * (N0 + 1)] = Dm_C_Cs(C_R_C(R0));
+        Cshsnqt0[N2 * (N0 + 1) + 1] = vdup_n_f32(0.0f);
+
+        // Other products.
+        Gvl_CshsnqtCsCsNN_0(Cshsnqt0, Csvt0[2 * N2], Csvt0[2 * N2 + 1], N0, N2);
+    }
+
+    for(N2 = 0; N2 < N1; ++N2) // RQ.
+        Gvrhr_CshsnqtCsCsNN_0(Cshsnqt0, Csvt0[2 * N2], Csvt0[2 * N2 + 1], N0, N2);
+
+    for(N2 = 0; N2 < N1 + 1; ++N2) // Shift (+).
+        Cshsnqt0[N2 * (N0 + 1)] = vadd_f32(Cshsnqt0[N2 * (N0 + 1)], Cs0);
+}
+
+/**
+ * @brief Eigenvalues [Eig].
+ * 
+ * @param Cshsnqt0 Single Complex Hessenberg Square Matrix [Cshsnq], Target [t].
+ * @param N0 Rows and Columns [N].
+ */
+void Eig_CshsnqtN_0(Complexs* Cshsnqt0, const Natural N0) {
+    register Complexs* Csv0 = (Complexs*) Calc_NN_P(2 * (N0 - 1), sizeof(Complexs));
+    register Complexs* Csv1 = (Complexs*) Calc_NN_P(2, sizeof(Complexs));
+
+    register Natural N1 = 0, N3 = N0 - 1, N4;
+
+    #ifndef NVERBOSE
+    printf("--- QR Algorithm, single precision\n");
+    #endif
+
+    for(; N1 < ITM0; ++N1) {
+
+        if(N3 == 0) break; // Stop.
+
+        const register Complex C0 = Pm_Cs_C(Cshsnqt0[(N3 - 1) * (N0 + 1)]);
+        const register Complex C1 = Pm_Cs_C(Cshsnqt0[(N3 - 1) * (N0 + 1) + 1]);
+        const register Complex C2 = Pm_Cs_C(Cshsnqt0[N3 * N0 + N3 - 1]);
+        const register Complex C3 = Pm_Cs_C(Cshsnqt0[N3 * (N0 + 1)]);
+
+        if(N2_C_R(C1) <= TOLs0 * (N2_C_R(C0) + N2_C_R(C3))) { --N3; continue; } // Deflation, relative.
+
+        register Complex* Cv0 = Eig_CCCC_C(C0, C2, C1, C3); // Double Wilkinson's shift.
+        *Csv1 = Dm_C_Cs(*Cv0);
+        Fr_P_0(Cv0);
+
+        for(N4 = 0; N4 < 2; ++N4) // Double shift.
+            Qrs_CshsnqtCsvtCsNN_0(Cshsnqt0, Csv0, Csv1[N4], N0, N3);
+    }
+
+    #ifndef NVERBOSE
+    printf("Exited after %zu iterations.\n", N1 + 1);
+    printf("---\n");
+    #endif
+
+    Fr_P_0(Csv0);
+    Fr_P_0(Csv1);
+}
+
+
+// Output.
+
+/**
+ * @brief Print with new line [Pn].
+ * 
+ * @param Csm0 Single Complex Matrix [Csm].
+ * @param N0 Rows [N].
+ * @param N1 Columns [N].
+ */
+void Pn_CsmNN_0(const Complexs* Csm0, const Natural N0, const Natural N1) {
+    register Natural N2 = 0, N3;
+
+    printf("--- Matrix\n");
+
+    for(; N2 < N0; ++N2) {
+        for(N3 = 0; N3 < N1 - 1; ++N3)
+            P_C_0(Pm_Cs_C(Csm0[N2 + N3 * N0]));
+
+        Pn_C_0(Pm_Cs_C(Csm0[N2 + (N1 - 1) * N0]));
+    }
+
+    printf("---\n");
+}
\ No newline at end of file
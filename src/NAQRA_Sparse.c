@@ -0,0 +1,414 @@
+/**
+ * @file NAQRA_Sparse.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief include/Sparse.h implementation.
+ * @date 2024-12-12
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include <stdlib.h>
+#include "../include/Sparse.h"
+
+// Compressed sparse row product.
+
+/**
+ * @brief Mat-vec [Mv], compressed sparse rows.
+ *
+ * @param Cv0 Complex Vector [Cv], values.
+ * @param Nv0 Natural Vector [Nv], N0 + 1 row pointers.
+ * @param Nv1 Natural Vector [Nv], column indices.
+ * @param Cv1 Complex Vector [Cv].
+ * @param Cvt0 Complex Vector [Cv], Target [t].
+ * @param N0 Rows [N].
+ */
+void Mv_CvNvNvCvCvtN_0(const Complex* Cv0, const Natural* Nv0, const Natural* Nv1, const Complex* Cv1, Complex* Cvt0, const Natural N0) {
+    register Natural N1 = 0, N2;
+
+    for(; N1 < N0; ++N1) {
+        register Complex C0 = {0.0, 0.0}, C1 = {0.0, 0.0};
+
+        for(N2 = Nv0[N1]; N2 + 1 < Nv0[N1 + 1]; N2 += 2) {
+            C0 = A_CC_C(C0, M_CC_C(Cv0[N2], Cv1[Nv1[N2]]));
+            C1 = A_CC_C(C1, M_CC_C(Cv0[N2 + 1], Cv1[Nv1[N2 + 1]]));
+        }
+
+        if(N2 < Nv0[N1 + 1])
+            C0 = A_CC_C(C0, M_CC_C(Cv0[N2], Cv1[Nv1[N2]]));
+
+        Cvt0[N1] = A_CC_C(C0, C1);
+    }
+}
+
+// Implicitly restarted Arnoldi.
+
+/**
+ * @brief Random vector [Rnd], normalized.
+ *
+ * @param Cvt0 Complex Vector [Cv], Target [t].
+ * @param N0 Entries [N].
+ * @param N1 Seed [N].
+ */
+static void Rnd_CvtNN_0(Complex* Cvt0, const Natural N0, const Natural N1) {
+    register unsigned long long L0 = 0x9E3779B97F4A7C15ULL * (N1 + 1);
+
+    for(register Natural N2 = 0; N2 < N0; ++N2) { // Xorshift.
+        L0 ^= L0 << 13; L0 ^= L0 >> 7; L0 ^= L0 << 17;
+        const register Real R0 = (Real) (L0 >> 11) / 9007199254740992.0 - 0.5;
+
+        L0 ^= L0 << 13; L0 ^= L0 >> 7; L0 ^= L0 << 17;
+        Cvt0[N2] = C_RR_C(R0, (Real) (L0 >> 11) / 9007199254740992.0 - 0.5);
+    }
+
+    Nz2_CvN_0(Cvt0, N0);
+}
+
+/**
+ * @brief Orthogonalization [Ort], classical Gram-Schmidt, twice.
+ *
+ * @param Cm0 Complex Matrix [Cm], orthonormal columns.
+ * @param Cvt0 Complex Vector [Cv], Target [t].
+ * @param Cvt1 Complex Vector [Cv], Target [t], coefficients, accumulated.
+ * @param N0 Rows [N].
+ * @param N1 Columns [N].
+ */
+static void Ort_CmCvtCvtNN_0(const Complex* Cm0, Complex* Cvt0, Complex* Cvt1, const Natural N0, const Natural N1) {
+    register Natural N2, N3;
+
+    for(N2 = 0; N2 < 2; ++N2) {
+        for(N3 = 0; N3 < N1; ++N3) {
+            const register Complex C0 = Dot_CrvCcvN_C(Cvt0, Cm0 + N3 * N0, N0);
+
+            Cvt1[N3] = A_CC_C(Cvt1[N3], C0);
+            Ma_CvtCvCN_0(Cvt0, Cm0 + N3 * N0, M_CR_C(C0, -1.0), N0);
+        }
+    }
+}
+
+/**
+ * @brief Arnoldi factorization [Arn], extension.
+ *
+ * @param Op0 Operator [Op].
+ * @param P0 Operator's data.
+ * @param Cmt0 Complex Matrix [Cm], Target [t], N2 + 1 basis columns.
+ * @param Chsnqt0 Complex Hessenberg Square Matrix [Chsnq], Target [t], N2 rows and columns.
+ * @param N0 Rows [N].
+ * @param N1 First new column [N].
+ * @param N2 Columns [N].
+ * @return Real Real Number [R], residual's norm.
+ */
+static Real Arn_OpPCmtChsnqtNNN_R(const Operator Op0, void* P0, Complex* Cmt0, Complex* Chsnqt0, const Natural N0, const Natural N1, const Natural N2) {
+    register Natural N3 = N1, N4;
+    register Real R0 = 0.0;
+
+    for(; N3 < N2; ++N3) {
+        Complex* Cv0 = Cmt0 + (N3 + 1) * N0;
+
+        Op0(Cmt0 + N3 * N0, Cv0, P0);
+
+        for(N4 = 0; N4 < N2; ++N4)
+            Chsnqt0[N3 * N2 + N4] = C_R_C(0.0);
+
+        Ort_CmCvtCvtNN_0(Cmt0, Cv0, Chsnqt0 + N3 * N2, N0, N3 + 1);
+
+        if((R0 = N2_CvN_R(Cv0, N0)) <= KRY0 * N2_CvN_R(Chsnqt0 + N3 * N2, N3 + 1)) { // Invariant subspace.
+            Complex* Cv1 = (Complex*) Calc_NN_P(N3 + 1, sizeof(Complex));
+
+            Rnd_CvtNN_0(Cv0, N0, N3);
+            Ort_CmCvtCvtNN_0(Cmt0, Cv0, Cv1, N0, N3 + 1);
+            Nz2_CvN_0(Cv0, N0);
+
+            Fr_P_0(Cv1);
+            R0 = 0.0;
+        } else
+            D_CvR_0(Cv0, R0, N0);
+
+        if(N3 + 1 < N2)
+            Chsnqt0[N3 * N2 + N3 + 1] = C_R_C(R0);
+    }
+
+    return R0;
+}
+
+/**
+ * @brief Magnitude order.
+ *
+ * @param P0 Complex Number.
+ * @param P1 Complex Number.
+ * @return int Comparison.
+ */
+static int Cmp_PP_I(const void* P0, const void* P1) {
+    const register Real R0 = N2_C_R(*(const Complex*) P0), R1 = N2_C_R(*(const Complex*) P1);
+    return (R0 < R1) - (R0 > R1);
+}
+
+/**
+ * @brief Real part order.
+ *
+ * @param P0 Complex Number.
+ * @param P1 Complex Number.
+ * @return int Comparison.
+ */
+static int Cmpr_PP_I(const void* P0, const void* P1) {
+    const register Real R0 = vgetq_lane_f64(*(const Complex*) P0, 0), R1 = vgetq_lane_f64(*(const Complex*) P1, 0);
+    return (R0 < R1) - (R0 > R1);
+}
+
+/**
+ * @brief Eigenvalues [Ira], implicitly restarted Arnoldi.
+ *
+ * The unwanted Ritz values of the projected Hessenberg matrix are used as
+ * exact shifts, the basis being compressed to N1 columns at each restart.
+ * Wanted Ritz values whose estimate has not converged after KRY1 restarts
+ * are returned as NaN.
+ *
+ * @param Op0 Operator [Op].
+ * @param P0 Operator's data.
+ * @param Cvt0 Complex Vector [Cv], Target [t], N1 eigenvalues, NaN if not converged.
+ * @param N0 Rows and Columns [N].
+ * @param N1 Wanted eigenvalues [N].
+ * @param N2 Basis size [N], N1 < N2 <= N0.
+ * @param N3 Ordering [N], SRT_MAGNITUDE or SRT_REAL.
+ * @return Natural Converged eigenvalues [N].
+ */
+Natural Ira_OpPCvtNNNN_N(const Operator Op0, void* P0, Complex* Cvt0, const Natural N0, const Natural N1, const Natural N2, const Natural N3) {
+    register Complex* Cm0 = (Complex*) Alc_NN_P(N0 * (N2 + 1), sizeof(Complex)); // Basis.
+    register Complex* Chsnq0 = (Complex*) Calc_NN_P(N2 * N2, sizeof(Complex)); // Projection.
+    register Complex* Chsnq1 = (Complex*) Alc_NN_P(N2 * N2, sizeof(Complex)); // Projection, copy.
+    register Complex* Cq0 = (Complex*) Alc_NN_P(N2 * N2, sizeof(Complex)); // Shifts' rotations.
+    register Complex* Cv0 = (Complex*) Alc_NN_P(2 * N2, sizeof(Complex)); // Givens coefficients.
+    register Complex* Cv1 = (Complex*) Alc_NN_P(N2, sizeof(Complex)); // Ritz values.
+    register Complex* Cv2 = (Complex*) Alc_NN_P(N2, sizeof(Complex)); // Ritz vector.
+    register Complex* Cm1 = (Complex*) Alc_NN_P(RBK0 * (N1 + 1), sizeof(Complex)); // Basis block.
+    register bool* Bv0 = (bool*) Alc_NN_P(N1, sizeof(bool)); // Converged, by Ritz value.
+
+    register Natural N4 = 0, N5, N6, N7, N8 = 0;
+    register Real R0;
+
+    Rnd_CvtNN_0(Cm0, N0, 0);
+    R0 = Arn_OpPCmtChsnqtNNN_R(Op0, P0, Cm0, Chsnq0, N0, 0, N2);
+
+    for(; N4 < KRY1; ++N4) {
+
+        // Ritz values.
+
+        Cp_CvtCvN_0(Chsnq1, Chsnq0, N2 * N2);
+        Eig_ChsnqtN_0(Chsnq1, N2);
+
+        for(N5 = 0; N5 < N2; ++N5)
+            Cv1[N5] = Chsnq1[N5 * (N2 + 1)];
+
+        qsort(Cv1, N2, sizeof(Complex), N3 == SRT_REAL ? Cmpr_PP_I : Cmp_PP_I);
+
+        // Ritz estimates, inverse iteration on the projection.
+
+        for(N5 = 0, N8 = 0; N5 < N1; ++N5) {
+            for(N6 = 0; N6 < N2; ++N6)
+                Cv2[N6] = C_R_C(1.0);
+
+            for(N7 = 0; N7 < 2; ++N7) {
+                Cp_CvtCvN_0(Chsnq1, Chsnq0, N2 * N2);
+
+                for(N6 = 0; N6 < N2; ++N6)
+                    Chsnq1[N6 * (N2 + 1)] = S_CC_C(Chsnq1[N6 * (N2 + 1)], Cv1[N5]);
+
+                Slv_ChsnqtCvtN_0(Chsnq1, Cv2, N2);
+                Nz2_CvN_0(Cv2, N2);
+            }
+
+            if((Bv0[N5] = R0 * N2_C_R(Cv2[N2 - 1]) <= KRY0 * (N2_C_R(Cv1[N5]) > TOL0 ? N2_C_R(Cv1[N5]) : TOL0))) ++N8;
+        }
+
+        if(N8 == N1) break;
+
+        // Exact shifts.
+
+        for(N5 = 0; N5 < N2 * N2; ++N5)
+            Cq0[N5] = C_R_C(N5 % (N2 + 1) == 0 ? 1.0 : 0.0);
+
+        for(N5 = N1; N5 < N2; ++N5) {
+            Qrs_ChsnqtCvtCNN_0(Chsnq0, Cv0, Cv1[N5], N2, N2 - 1);
+
+            for(N6 = 0; N6 + 1 < N2; ++N6) // Accumulation, Q = Q G^H.
+                for(N7 = 0; N7 < N2; ++N7) {
+                    const register Complex C0 = Cq0[N6 * N2 + N7], C1 = Cq0[(N6 + 1) * N2 + N7];
+
+                    Cq0[N6 * N2 + N7] = A_CC_C(M_CC_C(C0, Cv0[2 * N6]), M_CC_C(C1, Cv0[2 * N6 + 1]));
+                    Cq0[(N6 + 1) * N2 + N7] = S_CC_C(M_CCcj_C(C1, Cv0[2 * N6]), M_CCcj_C(C0, Cv0[2 * N6 + 1]));
+                }
+        }
+
+        // Compressed basis, V Q, and residual, by row blocks.
+
+        const register Complex C2 = Chsnq0[(N1 - 1) * N2 + N1]; // Subdiagonal entry.
+        const register Complex C3 = M_CR_C(Cq0[(N1 - 1) * N2 + N2 - 1], R0); // Old residual's weight.
+
+        for(N5 = 0; N5 < N0; N5 += RBK0) {
+            const register Natural N9 = N5 + RBK0 < N0 ? RBK0 : N0 - N5;
+
+            for(N6 = 0; N6 < (N1 + 1) * RBK0; ++N6)
+                Cm1[N6] = C_R_C(0.0);
+
+            for(N6 = 0; N6 <= N1; ++N6)
+                for(N7 = 0; N7 < N2; ++N7)
+                    Ma_CvtCvCN_0(Cm1 + N6 * RBK0, Cm0 + N7 * N0 + N5, Cq0[N6 * N2 + N7], N9);
+
+            // Residual, f = V Q e_k h + f Q[m, k].
+            for(N6 = 0; N6 < N9; ++N6)
+                Cm1[N1 * RBK0 + N6] = A_CC_C(M_CC_C(Cm1[N1 * RBK0 + N6], C2), M_CC_C(Cm0[N2 * N0 + N5 + N6], C3));
+
+            for(N6 = 0; N6 <= N1; ++N6)
+                Cp_CvtCvN_0(Cm0 + N6 * N0 + N5, Cm1 + N6 * RBK0, N9);
+        }
+
+        // Truncated factorization.
+
+        for(N5 = N1; N5 < N2; ++N5)
+            for(N6 = 0; N6 < N2; ++N6)
+                Chsnq0[N5 * N2 + N6] = C_R_C(0.0);
+
+        if((R0 = N2_CvN_R(Cm0 + N1 * N0, N0)) > TOL1) // Residual in column N1.
+            D_CvR_0(Cm0 + N1 * N0, R0, N0);
+        else { // Invariant subspace.
+            for(N6 = 0; N6 < N1; ++N6)
+                Cv2[N6] = C_R_C(0.0);
+
+            Rnd_CvtNN_0(Cm0 + N1 * N0, N0, N4 + 1);
+            Ort_CmCvtCvtNN_0(Cm0, Cm0 + N1 * N0, Cv2, N0, N1);
+            Nz2_CvN_0(Cm0 + N1 * N0, N0);
+
+            R0 = 0.0;
+        }
+
+        Chsnq0[(N1 - 1) * N2 + N1] = C_R_C(R0);
+        R0 = Arn_OpPCmtChsnqtNNN_R(Op0, P0, Cm0, Chsnq0, N0, N1, N2);
+    }
+
+    #ifndef NVERBOSE
+    printf("--- Arnoldi, %zu restarts, %zu converged\n---\n", N4, N8);
+    #endif
+
+    for(N5 = 0; N5 < N1; ++N5)
+        Cvt0[N5] = Bv0[N5] ? Cv1[N5] : C_RR_C(NAN, NAN);
+
+    Fr_P_0(Cm0);
+    Fr_P_0(Chsnq0);
+    Fr_P_0(Chsnq1);
+    Fr_P_0(Cq0);
+    Fr_P_0(Cv0);
+    Fr_P_0(Cv1);
+    Fr_P_0(Cv2);
+    Fr_P_0(Cm1);
+    Fr_P_0(Bv0);
+
+    return N8;
+}
+
+// Block power iteration.
+
+/**
+ * @brief Dominant eigenvalues [Bpw], block power iteration.
+ *
+ * Subspace iteration with a Rayleigh-Ritz projection, reducing to power
+ * iteration with the Rayleigh quotient for a single vector.
+ *
+ * @param Op0 Operator [Op].
+ * @param P0 Operator's data.
+ * @param Cvt0 Complex Vector [Cv], Target [t], N1 eigenvalues, largest magnitude first.
+ * @param R0 Real Number [R], tolerance, residual relative to the projection.
+ * @param N0 Rows and Columns [N].
+ * @param N1 Block size [N].
+ * @param N2 Maximum iterations [N].
+ * @return Natural Iterations [N], N2 if not converged.
+ */
+Natural Bpw_OpPCvtRNNN_N(const Operator Op0, void* P0, Complex* Cvt0, const Real R0, const Natural N0, const Natural N1, const Natural N2) {
+    register Complex* Cm0 = (Complex*) Alc_NN_P(N0 * N1, sizeof(Complex)); // Basis.
+    register Complex* Cm1 = (Complex*) Alc_NN_P(N0 * N1, sizeof(Complex)); // Images.
+    register Complex* Cq0 = (Complex*) Alc_NN_P(N1 * N1, sizeof(Complex)); // Projection.
+    register Complex* Cv0 = (Complex*) Alc_NN_P(N1, sizeof(Complex)); // Coefficients.
+    register Complex* Cv1 = (Complex*) Alc_NN_P(N0, sizeof(Complex)); // Residual.
+
+    register Natural N3 = 0, N4, N5;
+    register Real R1, R2;
+
+    for(N4 = 0; N4 < N1; ++N4) { // Random, orthonormal basis.
+        for(N5 = 0; N5 < N4; ++N5)
+            Cv0[N5] = C_R_C(0.0);
+
+        Rnd_CvtNN_0(Cm0 + N4 * N0, N0, N4);
+        Ort_CmCvtCvtNN_0(Cm0, Cm0 + N4 * N0, Cv0, N0, N4);
+        Nz2_CvN_0(Cm0 + N4 * N0, N0);
+    }
+
+    for(; N3 < N2; ++N3) {
+        for(N4 = 0; N4 < N1; ++N4) // Images.
+            Op0(Cm0 + N4 * N0, Cm1 + N4 * N0, P0);
+
+        // Projection, V^H A V.
+
+        for(N4 = 0; N4 < N1; ++N4)
+            for(N5 = 0; N5 < N1; ++N5)
+                Cq0[N4 * N1 + N5] = Dot_CrvCcvN_C(Cm1 + N4 * N0, Cm0 + N5 * N0, N0);
+
+        // Residual, A V - V H.
+
+        for(N4 = 0, R1 = 0.0; N4 < N1; ++N4) {
+            Cp_CvtCvN_0(Cv1, Cm1 + N4 * N0, N0);
+
+            for(N5 = 0; N5 < N1; ++N5)
+                Ma_CvtCvCN_0(Cv1, Cm0 + N5 * N0, M_CR_C(Cq0[N4 * N1 + N5], -1.0), N0);
+
+            R2 = N2_CvN_R(Cv1, N0);
+            R1 += R2 * R2;
+        }
+
+        if(sqrt(R1) <= R0 * N2_CvN_R(Cq0, N1 * N1)) break;
+
+        // Orthonormal images as the new basis.
+
+        Complex* Cm2 = Cm0; Cm0 = Cm1; Cm1 = Cm2;
+
+        for(N4 = 0; N4 < N1; ++N4) {
+            for(N5 = 0; N5 < N4; ++N5)
+                Cv0[N5] = C_R_C(0.0);
+
+            R1 = N2_CvN_R(Cm0 + N4 * N0, N0);
+            Ort_CmCvtCvtNN_0(Cm0, Cm0 + N4 * N0, Cv0, N0, N4);
+
+            if((R2 = N2_CvN_R(Cm0 + N4 * N0, N0)) <= KRY0 * R1) { // Rank deficiency.
+                for(N5 = 0; N5 < N4; ++N5)
+                    Cv0[N5] = C_R_C(0.0);
+
+                Rnd_CvtNN_0(Cm0 + N4 * N0, N0, (N3 + 1) * N1 + N4);
+                Ort_CmCvtCvtNN_0(Cm0, Cm0 + N4 * N0, Cv0, N0, N4);
+                Nz2_CvN_0(Cm0 + N4 * N0, N0);
+            } else
+                D_CvR_0(Cm0 + N4 * N0, R2, N0);
+        }
+    }
+
+    // Ritz values.
+
+    if(N1 > 1) {
+        if(N1 > 2) Hsn_CqtN_0(Cq0, N1);
+        Eig_ChsnqtN_0(Cq0, N1);
+    }
+
+    for(N4 = 0; N4 < N1; ++N4)
+        Cvt0[N4] = Cq0[N4 * (N1 + 1)];
+
+    qsort(Cvt0, N1, sizeof(Complex), Cmp_PP_I);
+
+    #ifndef NVERBOSE
+    printf("--- Block power, %zu iterations\n---\n", N3);
+    #endif
+
+    Fr_P_0(Cm0);
+    Fr_P_0(Cm1);
+    Fr_P_0(Cq0);
+    Fr_P_0(Cv0);
+    Fr_P_0(Cv1);
+
+    return N3;
+}
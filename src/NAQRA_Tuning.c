@@ -0,0 +1,330 @@
+/**
+ * @file NAQRA_Tuning.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief include/Tuning.h implementation.
+ * @date 2024-12-14
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include <string.h>
+#include "../include/Interface.h"
+
+// Profile keys, in field order.
+static const char* Sv0[6] = {"hsl", "seq", "par", "blk", "bnd", "trd"};
+
+_Static_assert(sizeof(Tuning) == 6 * sizeof(Natural), "Tuning is not a plain array of fields.");
+
+// State.
+
+static Tuning Tn0 = {HSL0, SEQ0, PAR0, BLK0, BND0, TRD0}; // Tuning.
+static _Thread_local const Tuning* Tn1 = NULL; // Candidate, autotuning thread only.
+
+/**
+ * @brief Tuning [Tn], the autotuning candidate on the autotuning thread.
+ *
+ * @return Tuning Tuning [Tn].
+ */
+Tuning Tn_0_Tn(void) { return Tn1 != NULL ? *Tn1 : Tn0; }
+
+/**
+ * @brief Set tuning [St], out of range values being clamped.
+ *
+ * @param Tn1 Tuning [Tn].
+ */
+void St_Tn_0(const Tuning Tn1) {
+    Tn0 = Tn1;
+
+    if(Tn0.N0 < 4) Tn0.N0 = 4; // Unrolled products need 4 entries.
+    if(Tn0.N1 < 1) Tn0.N1 = 1;
+    if(Tn0.N3 < 1) Tn0.N3 = 1;
+    if(Tn0.N4 < 2) Tn0.N4 = 2;
+}
+
+// Profiles.
+
+/**
+ * @brief Path [Pth], NAQRA_TUNING or ~/.naqra.
+ *
+ * @return const char* Path, NULL if none.
+ */
+static const char* Pth_0_S(void) {
+    static char S0[4096];
+    const char* S1 = getenv("NAQRA_TUNING");
+
+    if(S1 != NULL) return S1;
+    if((S1 = getenv("HOME")) == NULL) return NULL;
+
+    snprintf(S0, sizeof(S0), "%s/.naqra", S1);
+    return S0;
+}
+
+/**
+ * @brief Load [Ld], unknown keys being ignored.
+ *
+ * @param S0 Path, NULL for the default one.
+ * @return Natural Read values [N].
+ */
+Natural Ld_S_N(const char* S0) {
+    if(S0 == NULL && (S0 = Pth_0_S()) == NULL) return 0;
+
+    FILE* F0 = fopen(S0, "r");
+    if(F0 == NULL) return 0;
+
+    Tuning Tn1 = Tn0;
+    Natural* Nv0 = (Natural*) &Tn1.N0; // Fields.
+
+    char S1[256], S2[16];
+    register Natural N0 = 0, N1;
+    size_t N2;
+
+    while(fgets(S1, sizeof(S1), F0) != NULL) {
+        if(S1[0] == '#' || sscanf(S1, "%15s %zu", S2, &N2) != 2) continue; // Comments.
+
+        for(N1 = 0; N1 < 6; ++N1)
+            if(strcmp(S2, Sv0[N1]) == 0) {
+                Nv0[N1] = N2;
+                ++N0;
+            }
+    }
+
+    fclose(F0);
+
+    St_Tn_0(Tn1);
+    return N0;
+}
+
+/**
+ * @brief Save [Sv].
+ *
+ * @param S0 Path, NULL for the default one.
+ * @return Natural Written values [N].
+ */
+Natural Sv_S_N(const char* S0) {
+    if(S0 == NULL && (S0 = Pth_0_S()) == NULL) return 0;
+
+    FILE* F0 = fopen(S0, "w");
+    if(F0 == NULL) return 0;
+
+    const Natural* Nv0 = (const Natural*) &Tn0.N0; // Fields.
+    register Natural N0 = 0;
+
+    fprintf(F0, "# NAQRA tuning profile.\n");
+
+    for(; N0 < 6; ++N0)
+        fprintf(F0, "%s %zu\n", Sv0[N0], Nv0[N0]);
+
+    fclose(F0);
+    return N0;
+}
+
+/**
+ * @brief Profile loading [Ld], at load time.
+ */
+__attribute__((constructor)) static void Ld_0_0(void) { Ld_S_N(NULL); }
+
+// Autotuning.
+
+/**
+ * @brief Random matrix [Rnd].
+ *
+ * @param Cmt0 Complex Matrix [Cm], Target [t].
+ * @param N0 Entries [N].
+ */
+static void Rnd_CmtN_0(Complex* Cmt0, const Natural N0) {
+    register unsigned long L0 = 0x9E3779B97F4A7C15UL; // Xorshift state.
+
+    for(register Natural N1 = 0; N1 < N0; ++N1) {
+        L0 ^= L0 << 13; L0 ^= L0 >> 7; L0 ^= L0 << 17;
+        const register Real R0 = (Real) (L0 >> 11) / 9007199254740992.0 - 0.5;
+        L0 ^= L0 << 13; L0 ^= L0 >> 7; L0 ^= L0 << 17;
+
+        Cmt0[N1] = C_RR_C(R0, (Real) (L0 >> 11) / 9007199254740992.0 - 0.5);
+    }
+}
+
+/**
+ * @brief Hermitian matrix [Hrm], packed, from a random one.
+ *
+ * @param Chpt0 Complex Hermitian Packed Matrix [Chp], Target [t].
+ * @param Cm0 Complex Matrix [Cm], at least N0 * (N0 + 1) / 2 entries.
+ * @param N0 Rows and Columns [N].
+ */
+static void Hrm_ChptCmN_0(Complex* Chpt0, const Complex* Cm0, const Natural N0) {
+    Cp_CvtCvN_0(Chpt0, Cm0, N0 * (N0 + 1) / 2);
+
+    for(register Natural N1 = 0; N1 < N0; ++N1) // Real diagonal.
+        Chpt0[Pk_NNN_N(N1, N1, N0)] = C_R_C(vgetq_lane_f64(Chpt0[Pk_NNN_N(N1, N1, N0)], 0));
+}
+
+/**
+ * @brief Timing [Tm], best of ATN0 runs of a QR phase or a Hessenberg reduction.
+ *
+ * @param Cm0 Complex Matrix [Cm], square.
+ * @param Cmt0 Complex Matrix [Cm], Target [t], workspace.
+ * @param N0 Rows and Columns [N].
+ * @param N1 Threads [N], 0 for the Hessenberg reduction.
+ * @return Real Real Number [R], seconds.
+ */
+static Real Tm_CmCmtNN_R(const Complex* Cm0, Complex* Cmt0, const Natural N0, const Natural N1) {
+    const Budget Bg0 = {.R0 = 0.0, .N0 = ATN1, .B0 = NULL};
+    register Real R0 = INFINITY, R1;
+
+    for(register Natural N2 = 0; N2 < ATN0; ++N2) {
+        Cp_CvtCvN_0(Cmt0, Cm0, N0 * N0);
+
+        if(N1 == 0) {
+            R1 = Tm_0_R();
+            Hsn_CqtN_0(Cmt0, N0);
+        } else {
+            Hsn_CqtN_0(Cmt0, N0);
+            Cpt_ChsnqtN_0(Cmt0, N0);
+
+            R1 = Tm_0_R();
+            Eig_ChctDfPBgNN_N(Cmt0, NULL, NULL, &Bg0, N0, N1);
+        }
+
+        if((R1 = Tm_0_R() - R1) < R0) R0 = R1;
+    }
+
+    return R0;
+}
+
+/**
+ * @brief Timing [Tm], best of ATN0 Hermitian tridiagonal reductions.
+ *
+ * @param Chp0 Complex Hermitian Packed Matrix [Chp].
+ * @param N0 Rows and Columns [N].
+ * @return Real Real Number [R], seconds.
+ */
+static Real Tm_ChpN_R(const Complex* Chp0, const Natural N0) {
+    HermitianMatrix H0 = {.Chp0 = (Complex*) Chp0, .N0 = N0};
+    register Real R0 = INFINITY, R1;
+
+    for(register Natural N1 = 0; N1 < ATN0; ++N1) {
+        R1 = Tm_0_R();
+        Vector* V0 = HermitianEigenvalues(&H0);
+
+        if((R1 = Tm_0_R() - R1) < R0) R0 = R1;
+        FreeVector(V0);
+    }
+
+    return R0;
+}
+
+/**
+ * @brief Autotuning [Atn].
+ *
+ * Each parameter is benchmarked over its candidates in turn, the others being
+ * kept fixed. Candidates are seen by the calling thread alone, the resulting
+ * profile being applied at the end.
+ *
+ * @return Tuning Tuning [Tn], applied.
+ */
+Tuning Atn_0_Tn(void) {
+    static const Natural Nv0[4] = {4, 8, 16, 32}; // Cutoffs.
+    static const Natural Nv1[4] = {8, 16, 32, 64}; // Block sizes.
+    static const Natural Nv2[4] = {64, 128, 256, 512}; // Thresholds.
+
+    const register Natural N0 = ATN2, N1 = Thr_0_N();
+    const register Natural N4 = 2 * N0 > Nv2[3] ? 2 * N0 : Nv2[3]; // Largest size.
+    register Natural N2, N3;
+    register Real R0, R1;
+
+    Complex* Cm0 = (Complex*) Alc_NN_P(N4 * N4, sizeof(Complex));
+    Complex* Cm1 = (Complex*) Alc_NN_P(N4 * N4, sizeof(Complex));
+    Complex* Chp0 = (Complex*) Alc_NN_P(N4 * (N4 + 1) / 2, sizeof(Complex));
+
+    if(Cm0 == NULL || Cm1 == NULL || Chp0 == NULL) {
+        Fr_P_0(Cm0);
+        Fr_P_0(Cm1);
+        Fr_P_0(Chp0);
+        return Tn0;
+    }
+
+    Rnd_CmtN_0(Cm0, N4 * N4);
+
+    Tuning Tn2 = Tn0, Tn3 = Tn0; // Result, candidate.
+    Tn1 = &Tn3;
+
+    // Householder products' cutoff.
+
+    for(N2 = 0, R0 = INFINITY, N3 = Tn2.N0; N2 < 4; ++N2) {
+        Tn3.N0 = Nv0[N2];
+        if((R1 = Tm_CmCmtNN_R(Cm0, Cm1, N0, 0)) < R0) { R0 = R1; N3 = Nv0[N2]; }
+    }
+
+    Tn3.N0 = Tn2.N0 = N3;
+
+    // Givens sequences' blocks.
+
+    for(N2 = 0, R0 = INFINITY, N3 = Tn2.N1; N2 < 4; ++N2) {
+        Tn3.N1 = Nv1[N2];
+        if((R1 = Tm_CmCmtNN_R(Cm0, Cm1, N0, 1)) < R0) { R0 = R1; N3 = Nv1[N2]; }
+    }
+
+    Tn3.N1 = Tn2.N1 = N3;
+
+    if(N1 > 1) {
+
+        // Multithreaded sweeps' blocks, on twice the size.
+
+        Tn3.N2 = 0;
+
+        for(N2 = 0, R0 = INFINITY, N3 = Tn2.N3; N2 < 4; ++N2) {
+            Tn3.N3 = Nv1[N2];
+            if((R1 = Tm_CmCmtNN_R(Cm0, Cm1, 2 * N0, N1)) < R0) { R0 = R1; N3 = Nv1[N2]; }
+        }
+
+        Tn3.N3 = Tn2.N3 = N3;
+
+        // Multithreaded sweeps' threshold, the smallest size at which the team wins.
+
+        for(N2 = 0, N3 = 2 * Nv2[3]; N2 < 4; ++N2) {
+            Tn3.N2 = 0;
+            R0 = Tm_CmCmtNN_R(Cm0, Cm1, Nv2[N2], N1);
+
+            Tn3.N2 = (Natural) -1;
+            R1 = Tm_CmCmtNN_R(Cm0, Cm1, Nv2[N2], N1);
+
+            if(R0 < R1) { N3 = Nv2[N2]; break; }
+        }
+
+        Tn3.N2 = Tn2.N2 = N3;
+    }
+
+    // Two-stage tridiagonal form, on a Hermitian matrix of twice the size.
+
+    Hrm_ChptCmN_0(Chp0, Cm0, 2 * N0);
+    Tn3.N5 = 0;
+
+    for(N2 = 0, R0 = INFINITY, N3 = Tn2.N4; N2 < 4; ++N2) {
+        Tn3.N4 = Nv1[N2];
+        if((R1 = Tm_ChpN_R(Chp0, 2 * N0)) < R0) { R0 = R1; N3 = Nv1[N2]; }
+    }
+
+    Tn3.N4 = Tn2.N4 = N3;
+
+    for(N2 = 0, N3 = 2 * Nv2[3]; N2 < 4; ++N2) { // Smallest size at which the band wins.
+        Hrm_ChptCmN_0(Chp0, Cm0, Nv2[N2]);
+
+        Tn3.N5 = 0;
+        R0 = Tm_ChpN_R(Chp0, Nv2[N2]);
+
+        Tn3.N5 = (Natural) -1;
+        R1 = Tm_ChpN_R(Chp0, Nv2[N2]);
+
+        if(R0 < R1) { N3 = Nv2[N2]; break; }
+    }
+
+    Tn2.N5 = N3;
+
+    Fr_P_0(Cm0);
+    Fr_P_0(Cm1);
+    Fr_P_0(Chp0);
+
+    Tn1 = NULL;
+    St_Tn_0(Tn2);
+    return Tn0;
+}
@@ -10,7 +10,51 @@
 
 #include <math.h>
 #include <memory.h>
+#include <pthread.h>
+#include <string.h>
+#include <sys/auxv.h>
 #include "../include/Vector.h"
+#include "../include/Generic.h"
+
+#ifndef HWCAP_FCMA
+#define HWCAP_FCMA (1 << 14)
+#endif
+
+// Kernels.
+
+// Selected kernels, KRN_*.
+static Natural Krn0 = KRN_BASELINE;
+
+// Selection, once.
+static pthread_once_t Krn1 = PTHREAD_ONCE_INIT;
+
+/**
+ * @brief Kernels' selection [Sl], from the hardware capabilities.
+ * 
+ * NAQRA_KERNEL=baseline forces the baseline kernels and NAQRA_KERNEL=fcma the
+ * FCMA ones, even when the capabilities do not report FCMA, as under some
+ * emulators and older kernels. Otherwise, FCMA is used where reported.
+ */
+static void Sl_0_0(void) {
+    const char* S0 = getenv("NAQRA_KERNEL"); // Override.
+
+    if(S0 != NULL && strcmp(S0, "baseline") == 0)
+        Krn0 = KRN_BASELINE;
+    else if(S0 != NULL && strcmp(S0, "fcma") == 0)
+        Krn0 = KRN_FCMA;
+    else
+        Krn0 = (getauxval(AT_HWCAP) & HWCAP_FCMA) != 0 ? KRN_FCMA : KRN_BASELINE;
+}
+
+/**
+ * @brief Kernels [Krn], selected once, on the first call.
+ * 
+ * @return Natural Kernels [N], KRN_*.
+ */
+Natural Krn_0_N(void) {
+    pthread_once(&Krn1, Sl_0_0);
+    return Krn0;
+}
 
 // Copy.
 
@@ -71,17 +115,39 @@ void D_CvR_0(Complex* Cvt0, const Real R0, const Natural N0) {
         Cvt0[N1] = vdivq_f64(Cvt0[N1], Rt0);
 }
 
-// Dot product.
+// Kernel variants, the baseline ones being generated, see include/Generic.h.
 
 /**
- * @brief Dot [D].
+ * @brief Multiply-Add [Ma], FCMA.
+ * 
+ * @param Cvt0 Complex Vector [Cv], Target [t].
+ * @param Cv0 Complex Vector [Cv].
+ * @param C0 Complex Number [C].
+ * @param N0 Entries [N].
+ */
+FCM0 static void Mafc_CvtCvCN_0(Complex* Cvt0, const Complex* Cv0, const Complex C0, const Natural N0) {
+    register Natural N1 = 0;
+
+    for(; N1 + 3 < N0; N1 += 4) {
+        Cvt0[N1] = Fma_CCC_C(Cvt0[N1], Cv0[N1], C0);
+        Cvt0[N1 + 1] = Fma_CCC_C(Cvt0[N1 + 1], Cv0[N1 + 1], C0);
+        Cvt0[N1 + 2] = Fma_CCC_C(Cvt0[N1 + 2], Cv0[N1 + 2], C0);
+        Cvt0[N1 + 3] = Fma_CCC_C(Cvt0[N1 + 3], Cv0[N1 + 3], C0);
+    }
+
+    for(; N1 < N0; ++N1)
+        Cvt0[N1] = Fma_CCC_C(Cvt0[N1], Cv0[N1], C0);
+}
+
+/**
+ * @brief Dot [D], FCMA.
  * 
  * @param Crv0 Complex Row Vector [Crv].
  * @param Ccv0 Complex Column Vector [Ccv].
  * @param N0 Entries [N].
  * @return Complex Complex Number [C].
  */
-Complex Dot_CrvCcvN_C(const Complex* Crv0, const Complex* Ccv0, const Natural N0) {
+FCM0 static Complex Dotfc_CrvCcvN_C(const Complex* Crv0, const Complex* Ccv0, const Natural N0) {
     register Natural N1 = 0;
 
     register Complex C0 = {0.0, 0.0};
@@ -90,47 +156,67 @@ Complex Dot_CrvCcvN_C(const Complex* Crv0, const Complex* Ccv0, const Natural N0
     register Complex C3 = {0.0, 0.0};
 
     for(; N1 + 3 < N0; N1 += 4) {
-        C0 = vaddq_f64(C0, M_CCcj_C(Crv0[N1], Ccv0[N1]));
-        C1 = vaddq_f64(C1, M_CCcj_C(Crv0[N1 + 1], Ccv0[N1 + 1]));
-        C2 = vaddq_f64(C2, M_CCcj_C(Crv0[N1 + 2], Ccv0[N1 + 2]));
-        C3 = vaddq_f64(C3, M_CCcj_C(Crv0[N1 + 3], Ccv0[N1 + 3]));
+        C0 = Fma_CCcjC_C(C0, Ccv0[N1], Crv0[N1]);
+        C1 = Fma_CCcjC_C(C1, Ccv0[N1 + 1], Crv0[N1 + 1]);
+        C2 = Fma_CCcjC_C(C2, Ccv0[N1 + 2], Crv0[N1 + 2]);
+        C3 = Fma_CCcjC_C(C3, Ccv0[N1 + 3], Crv0[N1 + 3]);
     }
 
     for(; N1 < N0; ++N1)
-        C0 = vaddq_f64(C0, M_CCcj_C(Crv0[N1], Ccv0[N1]));
+        C0 = Fma_CCcjC_C(C0, Ccv0[N1], Crv0[N1]);
 
     return vaddq_f64(vaddq_f64(C0, C1), vaddq_f64(C2, C3));
 }
 
-// Norms.
+// Kernels' selection.
+
+static void (*Kn0)(Complex*, const Complex*, const Complex, const Natural) = Mag_CvtCvCN_0; // Multiply-Add.
+static Complex (*Kn1)(const Complex*, const Complex*, const Natural) = Dotg_CvCvN_C; // Dot.
 
 /**
- * @brief Norm 2 [N2].
+ * @brief Kernels' selection [Krn], at load time.
+ */
+__attribute__((constructor)) static void Krn_0_0(void) {
+    if(Krn_0_N() != KRN_FCMA) return;
+
+    Kn0 = Mafc_CvtCvCN_0;
+    Kn1 = Dotfc_CrvCcvN_C;
+}
+
+// Complex-Complex arithmetic.
+
+/**
+ * @brief Multiply-Add [Ma].
  * 
+ * @param Cvt0 Complex Vector [Cv], Target [t].
  * @param Cv0 Complex Vector [Cv].
+ * @param C0 Complex Number [C].
  * @param N0 Entries [N].
- * @return Real Real Number [R].
  */
-Real N2_CvN_R(const Complex* Cv0, const Natural N0) {
-    register Natural N1 = 0;
+void Ma_CvtCvCN_0(Complex* Cvt0, const Complex* Cv0, const Complex C0, const Natural N0) { Kn0(Cvt0, Cv0, C0, N0); }
 
-    register Real2 Rt0 = {0.0, 0.0};
-    register Real2 Rt1 = {0.0, 0.0};
-    register Real2 Rt2 = {0.0, 0.0};
-    register Real2 Rt3 = {0.0, 0.0};
+// Dot product.
 
-    for(; N1 + 3 < N0; N1 += 4) {
-        Rt0 = vaddq_f64(Rt0, vmulq_f64(Cv0[N1], Cv0[N1]));
-        Rt1 = vaddq_f64(Rt1, vmulq_f64(Cv0[N1 + 1], Cv0[N1 + 1]));
-        Rt2 = vaddq_f64(Rt2, vmulq_f64(Cv0[N1 + 2], Cv0[N1 + 2]));
-        Rt3 = vaddq_f64(Rt3, vmulq_f64(Cv0[N1 + 3], Cv0[N1 + 3]));
-    }
+/**
+ * @brief Dot [D].
+ * 
+ * @param Crv0 Complex Row Vector [Crv].
+ * @param Ccv0 Complex Column Vector [Ccv].
+ * @param N0 Entries [N].
+ * @return Complex Complex Number [C].
+ */
+Complex Dot_CrvCcvN_C(const Complex* Crv0, const Complex* Ccv0, const Natural N0) { return Kn1(Crv0, Ccv0, N0); }
 
-    for(; N1 < N0; ++N1)
-        Rt0 = vaddq_f64(Rt0, vmulq_f64(Cv0[N1], Cv0[N1]));
+// Norms.
 
-    return sqrt(vaddvq_f64(Rt0) + vaddvq_f64(Rt1) + vaddvq_f64(Rt2) + vaddvq_f64(Rt3));
-}
+/**
+ * @brief Norm 2 [N2].
+ * 
+ * @param Cv0 Complex Vector [Cv].
+ * @param N0 Entries [N].
+ * @return Real Real Number [R].
+ */
+Real N2_CvN_R(const Complex* Cv0, const Natural N0) { return N2g_CvN_R(Cv0, N0); }
 
 /**
  * @brief Normalize 2 [Nz2].
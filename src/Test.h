@@ -18,4 +18,28 @@
 // Interface.
 #include "../include/Interface.h"
 
+/**
+ * @brief Distance [Dst], largest from an eigenvalue to the nearest reference one, relative.
+ * 
+ * @param Cv0 Complex Vector [Cv], eigenvalues.
+ * @param Cv1 Complex Vector [Cv], reference eigenvalues.
+ * @param N0 Size [N].
+ * @return Real Distance, relative to the largest reference modulus.
+ */
+static inline Real Dst_CvCvN_R(const Complex* Cv0, const Complex* Cv1, const Natural N0) {
+    register Real R0 = 0.0, R1 = 0.0, R2;
+
+    for(register Natural N1 = 0; N1 < N0; ++N1) {
+        R1 = fmax(R1, N2_C_R(Cv1[N1]));
+        R2 = INFINITY;
+
+        for(register Natural N2 = 0; N2 < N0; ++N2)
+            R2 = fmin(R2, N2_C_R(S_CC_C(Cv0[N1], Cv1[N2])));
+
+        R0 = fmax(R0, R2);
+    }
+
+    return R1 > 0.0 ? R0 / R1 : R0;
+}
+
 #endif
\ No newline at end of file
@@ -0,0 +1,129 @@
+/**
+ * @file Test_Budget.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief QR Algorithm test within budgets, and on a cyclic matrix stalling Wilkinson's shift, against Eigenvalues.
+ * @date 2024-12-20
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include "./Test.h"
+
+/**
+ * @brief Distance [Dst], largest from a partial result to the nearest reference eigenvalue, relative.
+ * 
+ * @param V0 Vector, partial result, NULL for none.
+ * @param V1 Vector, reference.
+ * @return Real Distance, relative to the largest reference modulus.
+ */
+static Real Dst_VV_R(const Vector* V0, const Vector* V1) {
+    register Real R0 = 0.0, R1 = 0.0, R2;
+
+    for(register Natural N0 = 0; N0 < V1->N0; ++N0)
+        R1 = fmax(R1, N2_C_R(V1->Cv0[N0]));
+
+    for(register Natural N0 = 0; V0 != NULL && N0 < V0->N0; ++N0) {
+        R2 = INFINITY;
+
+        for(register Natural N1 = 0; N1 < V1->N0; ++N1)
+            R2 = fmin(R2, N2_C_R(S_CC_C(V0->Cv0[N0], V1->Cv0[N1])));
+
+        R0 = fmax(R0, R2);
+    }
+
+    return R1 > 0.0 ? R0 / R1 : R0;
+}
+
+/**
+ * @brief Budget check [Chk].
+ * 
+ * @param M0 Matrix.
+ * @param V0 Vector, reference eigenvalues.
+ * @param Bg0 Budget [Bg], NULL for none.
+ * @param N0 Expected status [N].
+ * @param S0 Description.
+ * @return bool Passed.
+ */
+static bool Chk_MVBgNS_B(const Matrix* M0, const Vector* V0, const Budget* Bg0, const Natural N0, const char* S0) {
+    Natural N1 = STS_FAILED;
+    Vector* V1 = BudgetEigenvalues(M0, Bg0, &N1);
+
+    const register Natural N2 = V1 != NULL ? V1->N0 : 0; // Converged.
+    const register Real R0 = Dst_VV_R(V1, V0);
+
+    #ifndef NVERBOSE
+    printf("%s, status: %zu, %zu converged, largest relative distance from Eigenvalues: %.2e.\n", S0, N1, N2, R0);
+    #endif
+
+    if(V1 != NULL) FreeVector(V1);
+
+    // Every eigenvalue on convergence, fewer otherwise.
+    return N1 == N0 && (N0 == STS_CONVERGED ? N2 == M0->N0 : N2 < M0->N0) && R0 <= 1.0E-10;
+}
+
+int main(int argc, char **argv) {
+    if(argc < 4) {
+        printf("Usage: %s N (Rows and Columns) R R (Range) * (Output, optional)\n", argv[0]);
+        return -1;
+    }
+
+    // Size.
+    const register Natural N0 = (Natural) atoi(argv[1]);
+
+    if(N0 == 0) {
+        printf("At least 1 row and column is needed.\n");
+        return -1;
+    }
+
+    // Interval.
+    const register Real R0 = (Real) atof(argv[2]), R1 = (Real) atof(argv[3]);
+    const register Real R2 = R1 - R0;
+
+    // Matrices, random and cyclic, A[i][i + 1] = A[N - 1][0] = 1.
+    Matrix* M0 = NewMatrix(N0, N0);
+    Matrix* M1 = NewMatrix(N0, N0);
+
+    srand(time(NULL));
+    for(register Natural N1 = 0; N1 < N0 * N0; ++N1) // Random filling.
+        M0->Cm0[N1] = C_RR_C(R0 + R2 * (Real) rand() / RAND_MAX, R0 + R2 * (Real) rand() / RAND_MAX);
+
+    for(register Natural N1 = 0; N1 < N0; ++N1)
+        M1->Cm0[N1 * N0 + (N1 + 1) % N0] = C_R_C(1.0);
+
+    #ifndef NVERBOSE
+    printf("Testing on a complex %zu x %zu matrix within budgets, then on a cyclic one.\n", N0, N0);
+    printf("Coefficients generated in [%.1f, %.1f] x [%.1f, %.1f].\n\n", R0, R1, R0, R1);
+    #endif
+
+    Vector* V0 = Eigenvalues(M0); // References.
+    Vector* V1 = Eigenvalues(M1);
+
+    register bool B0 = Chk_MVBgNS_B(M0, V0, NULL, STS_CONVERGED, "No budget");
+
+    if(N0 > 2) {
+        atomic_bool B1 = true;
+
+        const Budget Bg0 = {.R0 = 0.0, .N0 = N0 / 4 + 1, .B0 = NULL}; // Iterations, too few.
+        const Budget Bg1 = {.R0 = 1.0E-12, .N0 = 0, .B0 = NULL}; // Time, too little.
+        const Budget Bg2 = {.R0 = 0.0, .N0 = 0, .B0 = &B1}; // Cancelled.
+
+        B0 = Chk_MVBgNS_B(M0, V0, &Bg0, STS_ITERATIONS, "Iterations") && B0;
+        B0 = Chk_MVBgNS_B(M0, V0, &Bg1, STS_DEADLINE, "Deadline") && B0;
+        B0 = Chk_MVBgNS_B(M0, V0, &Bg2, STS_CANCELLED, "Cancellation") && B0;
+    }
+
+    // Unshifted steps leave the cyclic matrix unchanged, exceptional shifts are needed.
+    B0 = Chk_MVBgNS_B(M1, V1, NULL, STS_CONVERGED, "Cyclic matrix") && B0;
+
+    #ifndef NVERBOSE
+    if(argc > 4)
+        Pn_CcvN_0(V1->Cv0, N0);
+    #endif
+
+    FreeVector(V0);
+    FreeVector(V1);
+    FreeMatrix(M0);
+    FreeMatrix(M1);
+    return B0 ? 0 : -1;
+}
\ No newline at end of file
@@ -0,0 +1,141 @@
+/**
+ * @file Test_Core.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Out-of-core QR Algorithm test on a complex matrix saved to disk, against Eigenvalues.
+ * @date 2024-12-16
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE // mkstemp.
+#endif
+
+#include <unistd.h>
+
+#include "./Test.h"
+
+// Collected eigenvalues.
+typedef struct {
+
+    // Eigenvalues.
+    Complex* Cv0;
+
+    // Collected.
+    Natural N0;
+
+    // Output.
+    bool B0;
+
+} Collection;
+
+/**
+ * @brief Deflation printer [Out], collecting the eigenvalues.
+ * 
+ * @param N0 Deflation index.
+ * @param C0 Eigenvalue.
+ * @param N1 Iterations so far.
+ * @param P0 Collection.
+ * @return true Always, no cancellation.
+ */
+static bool Out_NCNP_B(const Natural N0, const Complex C0, const Natural N1, void* P0) {
+    Collection* Cl0 = (Collection*) P0;
+    Cl0->Cv0[Cl0->N0++] = C0;
+
+    #ifndef NVERBOSE
+    if(Cl0->B0) {
+        printf("%zu, after %zu iterations: ", N0, N1);
+        Pn_C_0(C0);
+    }
+    #endif
+
+    return true;
+}
+
+int main(int argc, char **argv) {
+    if(argc < 4) {
+        printf("Usage: %s N (Rows and Columns) R R (Range) * (Output, optional)\n", argv[0]);
+        return -1;
+    }
+
+    // Size.
+    const register Natural N0 = (Natural) atoi(argv[1]);
+
+    if(N0 == 0) {
+        printf("At least 1 row and column is needed.\n");
+        return -1;
+    }
+
+    // Interval.
+    const register Real R0 = (Real) atof(argv[2]), R1 = (Real) atof(argv[3]);
+    const register Real R2 = R1 - R0;
+
+    // Matrix.
+    Matrix* M0 = NewMatrix(N0, N0);
+
+    srand(time(NULL));
+    for(register Natural N1 = 0; N1 < N0 * N0; ++N1) { // Random filling.
+        const register Real R3 = R0 + R2 * (Real) rand() / RAND_MAX;
+        const register Real R4 = R0 + R2 * (Real) rand() / RAND_MAX;
+
+        M0->Cm0[N1] = C_RR_C(R3, R4);
+    }
+
+    // Matrix file, in NAQRA_SCRATCH or the working directory.
+    const char* S0 = getenv("NAQRA_SCRATCH");
+    char S1[4096];
+
+    snprintf(S1, sizeof(S1), "%s/naqra.XXXXXX", S0 != NULL ? S0 : ".");
+
+    const register int I0 = mkstemp(S1);
+
+    if(I0 < 0 || SaveMatrix(S1, M0, STR_GENERAL) != N0 * N0) {
+        printf("Could not save the matrix to %s.\n", S1);
+
+        if(I0 >= 0) {
+            close(I0);
+            unlink(S1);
+        }
+
+        FreeMatrix(M0);
+        return -1;
+    }
+
+    close(I0);
+
+    // Memory, an eighth of the matrix, out-of-core, then the whole matrix, in memory.
+    const size_t Nv0[2] = {N0 * N0 * sizeof(Complex) / 8, N0 * N0 * sizeof(Complex)};
+
+    #ifndef NVERBOSE
+    printf("Testing on a complex %zu x %zu matrix, out-of-core.\n", N0, N0);
+    printf("Coefficients generated in [%.1f, %.1f] x [%.1f, %.1f].\n", R0, R1, R0, R1);
+    #endif
+
+    Vector* V0 = Eigenvalues(M0); // Reference.
+    Collection Cl0 = {.Cv0 = (Complex*) calloc(N0, sizeof(Complex)), .B0 = argc > 4};
+    register bool B0 = true;
+
+    for(register Natural N1 = 0; N1 < 2; ++N1) {
+        #ifndef NVERBOSE
+        printf("\nMemory for the reduction: %zu bytes.\n", Nv0[N1]);
+        #endif
+
+        Cl0.N0 = 0;
+
+        const register Natural N2 = OutOfCoreEigenvalues(S1, Nv0[N1], Out_NCNP_B, &Cl0, NULL); // Eigenvalues.
+        const register Real R3 = Cl0.N0 == N0 ? Dst_CvCvN_R(Cl0.Cv0, V0->Cv0, N0) : INFINITY;
+
+        #ifndef NVERBOSE
+        printf("Status: %zu, largest relative distance from Eigenvalues: %.2e.\n", N2, R3);
+        #endif
+
+        B0 = B0 && N2 == STS_CONVERGED && R3 <= 1.0E-10;
+    }
+
+    unlink(S1);
+    free(Cl0.Cv0);
+    FreeVector(V0);
+    FreeMatrix(M0);
+    return B0 ? 0 : -1;
+}
\ No newline at end of file
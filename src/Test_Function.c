@@ -0,0 +1,96 @@
+/**
+ * @file Test_Function.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Matrix functions test on a complex matrix, exponential and logarithm.
+ * @date 2024-12-21
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include "./Test.h"
+
+int main(int argc, char **argv) {
+    if(argc < 4) {
+        printf("Usage: %s N (Rows and Columns) R R (Range) * (Output, optional)\n", argv[0]);
+        return -1;
+    }
+
+    // Size.
+    const register Natural N0 = (Natural) atoi(argv[1]);
+
+    if(N0 == 0) {
+        printf("At least 1 row and column is needed.\n");
+        return -1;
+    }
+
+    // Index.
+    register Natural N1 = 0;
+
+    // Interval.
+    const register Real R0 = (Real) atof(argv[2]), R1 = (Real) atof(argv[3]);
+    const register Real R2 = R1 - R0;
+
+    // Status.
+    Natural N2, N3, N4 = STS_FAILED;
+
+    // Matrix.
+    Matrix* M0 = NewMatrix(N0, N0);
+
+    srand(time(NULL));
+    for(; N1 < N0 * N0; ++N1) { // Random filling.
+        const register Real R3 = R0 + R2 * (Real) rand() / RAND_MAX;
+        const register Real R4 = R0 + R2 * (Real) rand() / RAND_MAX;
+
+        M0->Cm0[N1] = C_RR_C(R3, R4);
+    }
+
+    #ifndef NVERBOSE
+    printf("Testing on a complex %zu x %zu matrix.\n", N0, N0);
+    printf("Coefficients generated in [%.1f, %.1f] x [%.1f, %.1f].\n\n", R0, R1, R0, R1);
+    #endif
+
+    SchurDecomposition* S0 = NewSchurDecomposition(M0); // Schur decomposition, shared.
+
+    Matrix* M1 = MatrixExponential(S0, &N2); // exp(A).
+    Matrix* M2 = MatrixLogarithm(S0, &N3); // log(A).
+
+    // Round trip, exp(log(A)) against A.
+    register Real R5 = 0.0, R6 = 0.0;
+
+    if(M2 != NULL) {
+        SchurDecomposition* S1 = NewSchurDecomposition(M2);
+        Matrix* M3 = MatrixExponential(S1, &N4);
+
+        if(M3 != NULL) {
+            for(N1 = 0; N1 < N0 * N0; ++N1) {
+                R5 = fmax(R5, N2_C_R(S_CC_C(M3->Cm0[N1], M0->Cm0[N1])));
+                R6 = fmax(R6, N2_C_R(M0->Cm0[N1]));
+            }
+
+            FreeMatrix(M3);
+        }
+
+        FreeSchurDecomposition(S1);
+    }
+
+    #ifndef NVERBOSE
+    printf("Clusters: %zu.\n", S0->N1);
+    printf("Status: exp(A) %zu, log(A) %zu, exp(log(A)) %zu.\n", N2, N3, N4);
+
+    if(N4 == STS_CONVERGED)
+        printf("exp(log(A)) - A: %.3e, relative.\n", R5 / R6);
+
+    if(argc > 4) {
+        if(M1 != NULL) Pn_CmNN_0(M1->Cm0, N0, N0);
+        if(M2 != NULL) Pn_CmNN_0(M2->Cm0, N0, N0);
+    }
+    #endif
+
+    if(M1 != NULL) FreeMatrix(M1);
+    if(M2 != NULL) FreeMatrix(M2);
+
+    FreeMatrix(M0);
+    FreeSchurDecomposition(S0);
+    return N2 == STS_CONVERGED && N4 == STS_CONVERGED ? 0 : -1;
+}
\ No newline at end of file
@@ -0,0 +1,282 @@
+/**
+ * @file Test_Generic.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Type-generic kernels test, every instance against reference loops and the library's own kernels.
+ * @date 2024-12-20
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include "./Test.h"
+
+// References, double precision complex.
+
+/**
+ * @brief Relative error [Err], Frobenius.
+ * 
+ * @param Cv0 Complex Vector [Cv].
+ * @param Cv1 Complex Vector [Cv], reference.
+ * @param N0 Entries [N].
+ * @return Real Error.
+ */
+static Real Err_CvCvN_R(const Complex* Cv0, const Complex* Cv1, const Natural N0) {
+    register Real R0 = 0.0, R1 = 0.0;
+
+    for(register Natural N1 = 0; N1 < N0; ++N1) {
+        R0 += pow(N2_C_R(S_CC_C(Cv0[N1], Cv1[N1])), 2.0);
+        R1 += pow(N2_C_R(Cv1[N1]), 2.0);
+    }
+
+    return R1 > 0.0 ? sqrt(R0 / R1) : sqrt(R0);
+}
+
+/**
+ * @brief Householder Left [Hslrf], reference.
+ * 
+ * @param Cqt0 Complex Square Matrix [Cq], Target [t].
+ * @param Cv0 Complex Vector [Cv].
+ * @param N0 Rows and Columns [N].
+ * @param N1 Entries [N].
+ */
+static void Hslrf_CqtCvNN_0(Complex* Cqt0, const Complex* Cv0, const Natural N0, const Natural N1) {
+    for(register Natural N2 = 0; N2 < N0; ++N2) {
+        register Complex C0 = C_R_C(0.0);
+
+        for(register Natural N3 = N0 - N1; N3 < N0; ++N3)
+            C0 = A_CC_C(C0, M_CcjC_C(Cv0[N3], Cqt0[N2 * N0 + N3]));
+
+        for(register Natural N3 = N0 - N1; N3 < N0; ++N3)
+            Cqt0[N2 * N0 + N3] = S_CC_C(Cqt0[N2 * N0 + N3], M_CR_C(M_CC_C(Cv0[N3], C0), 2.0));
+    }
+}
+
+/**
+ * @brief Householder Right [Hsrrf], reference.
+ * 
+ * @param Cqt0 Complex Square Matrix [Cq], Target [t].
+ * @param Cv0 Complex Vector [Cv].
+ * @param N0 Rows and Columns [N].
+ * @param N1 Entries [N].
+ */
+static void Hsrrf_CqtCvNN_0(Complex* Cqt0, const Complex* Cv0, const Natural N0, const Natural N1) {
+    for(register Natural N2 = 0; N2 < N0; ++N2) {
+        register Complex C0 = C_R_C(0.0);
+
+        for(register Natural N3 = N0 - N1; N3 < N0; ++N3)
+            C0 = A_CC_C(C0, M_CC_C(Cqt0[N3 * N0 + N2], Cv0[N3]));
+
+        for(register Natural N3 = N0 - N1; N3 < N0; ++N3)
+            Cqt0[N3 * N0 + N2] = S_CC_C(Cqt0[N3 * N0 + N2], M_CR_C(M_CCcj_C(C0, Cv0[N3]), 2.0));
+    }
+}
+
+/**
+ * @brief Givens Left [Gvlrf], reference, columns N1 + 1 onwards.
+ * 
+ * @param Cqt0 Complex Square Matrix [Cq], Target [t].
+ * @param C0 Complex Number [C].
+ * @param C1 Complex Number [C].
+ * @param N0 Rows and Columns [N].
+ * @param N1 Index [N].
+ */
+static void Gvlrf_CqtCCNN_0(Complex* Cqt0, const Complex C0, const Complex C1, const Natural N0, const Natural N1) {
+    for(register Natural N2 = N1 + 1; N2 < N0; ++N2) {
+        const register Complex C2 = Cqt0[N2 * N0 + N1], C3 = Cqt0[N2 * N0 + N1 + 1];
+
+        Cqt0[N2 * N0 + N1] = A_CC_C(M_CcjC_C(C0, C2), M_CcjC_C(C1, C3));
+        Cqt0[N2 * N0 + N1 + 1] = S_CC_C(M_CC_C(C0, C3), M_CC_C(C1, C2));
+    }
+}
+
+/**
+ * @brief Hermitian Givens Right [Gvrhrrf], reference, rows up to N1 + 1.
+ * 
+ * @param Cqt0 Complex Square Matrix [Cq], Target [t].
+ * @param C0 Complex Number [C].
+ * @param C1 Complex Number [C].
+ * @param N0 Rows and Columns [N].
+ * @param N1 Index [N].
+ */
+static void Gvrhrrf_CqtCCNN_0(Complex* Cqt0, const Complex C0, const Complex C1, const Natural N0, const Natural N1) {
+    for(register Natural N2 = 0; N2 < N1 + 2; ++N2) {
+        const register Complex C2 = Cqt0[N1 * N0 + N2], C3 = Cqt0[(N1 + 1) * N0 + N2];
+
+        Cqt0[N1 * N0 + N2] = A_CC_C(M_CC_C(C2, C0), M_CC_C(C3, C1));
+        Cqt0[(N1 + 1) * N0 + N2] = S_CC_C(M_CCcj_C(C3, C0), M_CCcj_C(C2, C1));
+    }
+}
+
+// Instances, through the type-generic selection.
+
+/**
+ * @brief Random [Rn] entry in [-1, 1], real or complex.
+ * 
+ * @param B0 Real.
+ * @return Complex Complex Number [C].
+ */
+static Complex Rn_B_C(const bool B0) {
+    const register Real R0 = 2.0 * (Real) rand() / RAND_MAX - 1.0;
+    return C_RR_C(R0, B0 ? 0.0 : 2.0 * (Real) rand() / RAND_MAX - 1.0);
+}
+
+// Conversions, to and from Complex, by type.
+#define TC_R(X) C_R_C(X)
+#define FC_R(C) vgetq_lane_f64((C), 0)
+#define TC_RS(X) C_R_C((Real) (X))
+#define FC_RS(C) ((Reals) vgetq_lane_f64((C), 0))
+#define TC_C(X) (X)
+#define FC_C(C) (C)
+#define TC_CS(X) Pm_Cs_C(X)
+#define FC_CS(C) Dm_C_Cs(C)
+
+/**
+ * @brief Instance test, every kernel of type T against the references.
+ * 
+ * Inputs are drawn as complex numbers, real parts only for real types, and
+ * the references run on their rounded values. The largest relative error is
+ * stored in E.
+ * 
+ * @param T Scalar type.
+ * @param U Real type.
+ * @param TC To Complex, from T.
+ * @param FC From Complex, to T.
+ * @param RE Real entries.
+ * @param N0 Rows and Columns.
+ * @param E Error, updated.
+ */
+#define TST(T, U, TC, FC, RE, N0, E) do { \
+    const Natural N4 = 7 * (N0) + 3, N5 = (N0) * (N0); /* Vector entries, matrix entries. */ \
+    T* Tv0 = (T*) malloc(N4 * sizeof(T)); T* Tv1 = (T*) malloc(N4 * sizeof(T)); T* Tv2 = (T*) malloc(N5 * sizeof(T)); T* Tv3 = (T*) malloc((N0) * sizeof(T)); \
+    Complex* Cv0 = (Complex*) malloc(N4 * sizeof(Complex)); Complex* Cv1 = (Complex*) malloc(N4 * sizeof(Complex)); \
+    Complex* Cv2 = (Complex*) malloc(N5 * sizeof(Complex)); Complex* Cv3 = (Complex*) malloc(N5 * sizeof(Complex)); Complex* Cv4 = (Complex*) malloc((N0) * sizeof(Complex)); \
+    Natural N6; \
+    for(N6 = 0; N6 < N4; ++N6) { Tv0[N6] = FC(Rn_B_C(RE)); Tv1[N6] = FC(Rn_B_C(RE)); Cv0[N6] = TC(Tv0[N6]); Cv1[N6] = TC(Tv1[N6]); } \
+    /* Dot product and norm. */ \
+    register Complex C5 = C_R_C(0.0); register Real R5 = 0.0; \
+    for(N6 = 0; N6 < N4; ++N6) { C5 = A_CC_C(C5, M_CCcj_C(Cv0[N6], Cv1[N6])); R5 += pow(N2_C_R(Cv0[N6]), 2.0); } \
+    const T T0 = DotProduct(Tv0, Tv1, N4); \
+    (E) = fmax((E), N2_C_R(S_CC_C(TC(T0), C5)) / sqrt(R5 * N4)); \
+    const U U0 = EuclideanNorm(Tv0, N4); \
+    (E) = fmax((E), fabs((Real) U0 - sqrt(R5)) / sqrt(R5)); \
+    /* Multiply-add. */ \
+    const T T1 = FC(Rn_B_C(RE)); \
+    MultiplyAdd(Tv1, Tv0, T1, N4); \
+    for(N6 = 0; N6 < N4; ++N6) Cv1[N6] = A_CC_C(Cv1[N6], M_CC_C(Cv0[N6], TC(T1))); \
+    for(N6 = 0; N6 < N4; ++N6) Cv0[N6] = TC(Tv1[N6]); \
+    (E) = fmax((E), Err_CvCvN_R(Cv0, Cv1, N4)); \
+    /* Householder products, last N0 - 3 entries. */ \
+    for(N6 = 0; N6 < N5; ++N6) { Tv2[N6] = FC(Rn_B_C(RE)); Cv2[N6] = TC(Tv2[N6]); } \
+    for(N6 = 0, R5 = 0.0; N6 < (N0); ++N6) { Cv4[N6] = Rn_B_C(RE); R5 += pow(N2_C_R(Cv4[N6]), 2.0); } \
+    for(N6 = 0; N6 < (N0); ++N6) { Tv3[N6] = FC(M_CR_C(Cv4[N6], 1.0 / sqrt(R5))); Cv4[N6] = TC(Tv3[N6]); } \
+    HouseholderLeft(Tv2, Tv3, (N0), (N0) - 3); \
+    Hslrf_CqtCvNN_0(Cv2, Cv4, (N0), (N0) - 3); \
+    for(N6 = 0; N6 < N5; ++N6) Cv3[N6] = TC(Tv2[N6]); \
+    (E) = fmax((E), Err_CvCvN_R(Cv3, Cv2, N5)); \
+    for(N6 = 0; N6 < N5; ++N6) Cv2[N6] = TC(Tv2[N6]); \
+    HouseholderRight(Tv2, Tv3, (N0), (N0) - 3); \
+    Hsrrf_CqtCvNN_0(Cv2, Cv4, (N0), (N0) - 3); \
+    for(N6 = 0; N6 < N5; ++N6) Cv3[N6] = TC(Tv2[N6]); \
+    (E) = fmax((E), Err_CvCvN_R(Cv3, Cv2, N5)); \
+    /* Givens products, every index. */ \
+    for(N6 = 0; N6 < N5; ++N6) Cv2[N6] = TC(Tv2[N6]); \
+    for(N6 = 0; N6 + 1 < (N0); ++N6) { \
+        const T T2 = FC(Rn_B_C(RE)), T3 = FC(Rn_B_C(RE)); \
+        GivensLeft(Tv2, T2, T3, (N0), N6); \
+        Gvlrf_CqtCCNN_0(Cv2, TC(T2), TC(T3), (N0), N6); \
+        GivensRight(Tv2, T2, T3, (N0), N6); \
+        Gvrhrrf_CqtCCNN_0(Cv2, TC(T2), TC(T3), (N0), N6); \
+    } \
+    for(N6 = 0; N6 < N5; ++N6) Cv3[N6] = TC(Tv2[N6]); \
+    (E) = fmax((E), Err_CvCvN_R(Cv3, Cv2, N5)); \
+    /* Householder QR, Q R against the matrix. */ \
+    for(N6 = 0; N6 < N5; ++N6) { Tv2[N6] = FC(Rn_B_C(RE)); Cv2[N6] = TC(Tv2[N6]); } \
+    HouseholderQR(Tv2, Tv3, (N0)); \
+    for(N6 = 0; N6 < N5; ++N6) Cv3[N6] = N6 % (N0) <= N6 / (N0) ? TC(Tv2[N6]) : C_R_C(0.0); /* R. */ \
+    for(N6 = (N0); N6-- > 0;) { \
+        for(Natural N7 = 0; N7 < (N0); ++N7) Cv4[N7] = N7 < N6 ? C_R_C(0.0) : (N7 == N6 ? TC(Tv3[N6]) : TC(Tv2[N6 * (N0) + N7])); \
+        Hslrf_CqtCvNN_0(Cv3, Cv4, (N0), (N0) - N6); \
+    } \
+    (E) = fmax((E), Err_CvCvN_R(Cv3, Cv2, N5)); \
+    free(Tv0); free(Tv1); free(Tv2); free(Tv3); free(Cv0); free(Cv1); free(Cv2); free(Cv3); free(Cv4); \
+} while(0)
+
+int main(int argc, char **argv) {
+    if(argc < 2) {
+        printf("Usage: %s N (Rows and Columns) * (Optional)\n", argv[0]);
+        return -1;
+    }
+
+    // Size.
+    const register Natural N0 = (Natural) atoi(argv[1]);
+
+    if(N0 < 4) {
+        printf("At least 4 rows and columns are needed.\n");
+        return -1;
+    }
+
+    srand(time(NULL));
+
+    // Errors, by instance, and against the library's kernels, double and single precision.
+    Real R0 = 0.0, R1 = 0.0, R2 = 0.0, R3 = 0.0, R4 = 0.0, R5 = 0.0;
+
+    TST(Real, Real, TC_R, FC_R, true, N0, R0);
+    TST(Reals, Reals, TC_RS, FC_RS, true, N0, R1);
+    TST(Complex, Real, TC_C, FC_C, false, N0, R2);
+    TST(Complexs, Reals, TC_CS, FC_CS, false, N0, R3);
+
+    // Library's kernels, the dispatched variants and the range and paired Givens products.
+
+    Complex* Cv0 = (Complex*) malloc(N0 * N0 * sizeof(Complex));
+    Complex* Cv1 = (Complex*) malloc(N0 * N0 * sizeof(Complex));
+    Complexs* Csv0 = (Complexs*) malloc(N0 * N0 * sizeof(Complexs));
+    Complexs* Csv1 = (Complexs*) malloc(N0 * N0 * sizeof(Complexs));
+    register Natural N1;
+
+    for(N1 = 0; N1 < N0 * N0; ++N1) {
+        Cv0[N1] = Cv1[N1] = Rn_B_C(false);
+        Csv0[N1] = Csv1[N1] = Dm_C_Cs(Cv0[N1]);
+    }
+
+    R4 = fmax(R4, N2_C_R(S_CC_C(Dot_CrvCcvN_C(Cv0, Cv1 + N0, N0 * (N0 - 1)), Dotg_CvCvN_C(Cv0, Cv1 + N0, N0 * (N0 - 1)))) / (Real) (N0 * N0));
+
+    for(N1 = 0; N1 + 1 < N0; ++N1) {
+        const register Complex C0 = Rn_B_C(false), C1 = Rn_B_C(false);
+
+        Gvl_ChsnqtCCNNNN_0(Cv0, C0, C1, N0, N1, N1 + 1, N0);
+        Gvlg_ChsnqtCCNN_0(Cv1, C0, C1, N0, N1);
+        Gvrhr_ChsnqtCCNNNN_0(Cv0, C0, C1, N0, N1, 0, N1 + 2);
+        Gvrhrg_ChsnqtCCNN_0(Cv1, C0, C1, N0, N1);
+
+        Gvl_CshsnqtCsCsNN_0(Csv0, Dm_C_Cs(C0), Dm_C_Cs(C1), N0, N1);
+        Gvlg_CshsnqtCsCsNN_0(Csv1, Dm_C_Cs(C0), Dm_C_Cs(C1), N0, N1);
+    }
+
+    Ma_CvtCvCN_0(Cv0, Cv0 + N0, C_RR_C(0.5, -0.25), N0 * (N0 - 1));
+    Mag_CvtCvCN_0(Cv1, Cv1 + N0, C_RR_C(0.5, -0.25), N0 * (N0 - 1));
+
+    R4 = fmax(R4, Err_CvCvN_R(Cv0, Cv1, N0 * N0));
+
+    for(N1 = 0; N1 < N0 * N0; ++N1) {
+        Cv0[N1] = Pm_Cs_C(Csv0[N1]);
+        Cv1[N1] = Pm_Cs_C(Csv1[N1]);
+    }
+
+    R5 = Err_CvCvN_R(Cv0, Cv1, N0 * N0);
+
+    #ifndef NVERBOSE
+    printf("Testing the type-generic kernels on %zu x %zu matrices and vectors of %zu entries.\n\n", N0, N0, 7 * N0 + 3);
+    printf("Real, double precision, largest relative error: %.2e.\n", R0);
+    printf("Real, single precision, largest relative error: %.2e.\n", R1);
+    printf("Complex, double precision, largest relative error: %.2e.\n", R2);
+    printf("Complex, single precision, largest relative error: %.2e.\n", R3);
+    printf("Against the library's kernels, largest relative error: %.2e, %.2e in single precision.\n", R4, R5);
+    #endif
+
+    free(Cv0);
+    free(Cv1);
+    free(Csv0);
+    free(Csv1);
+
+    return (R0 <= 1.0E-12 && R1 <= 1.0E-4 && R2 <= 1.0E-12 && R3 <= 1.0E-4 && R4 <= 1.0E-12 && R5 <= 1.0E-4) ? 0 : -1;
+}
\ No newline at end of file
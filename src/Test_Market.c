@@ -0,0 +1,189 @@
+/**
+ * @file Test_Market.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Matrix Market reader test on every layout and symmetry, against the written matrices and their Eigenvalues.
+ * @date 2024-12-20
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE // mkstemp.
+#endif
+
+#include <unistd.h>
+
+#include "./Test.h"
+
+// Stored part.
+
+#define PRT_GENERAL 0 // Every entry.
+#define PRT_LOWER 1 // Lower triangle, diagonal included.
+#define PRT_STRICT 2 // Lower triangle, diagonal excluded.
+
+/**
+ * @brief Matrix Market writer [Sv], arrays by column, coordinates by row.
+ * 
+ * @param S0 Path.
+ * @param S1 Banner's qualifiers.
+ * @param M0 Matrix.
+ * @param B0 Coordinates.
+ * @param B1 Complex values.
+ * @param N0 Stored part [N], PRT_*.
+ * @return bool Written.
+ */
+static bool Sv_SSMBBN_B(const char* S0, const char* S1, const Matrix* M0, const bool B0, const bool B1, const Natural N0) {
+    FILE* F0 = fopen(S0, "w");
+    if(F0 == NULL) return false;
+
+    const register Natural N1 = M0->N0;
+    register Natural N2, N3, N4 = 0;
+
+    for(N2 = 0; N2 < N1; ++N2) // Stored entries.
+        for(N3 = 0; N3 < N1; ++N3)
+            N4 += N0 == PRT_GENERAL || N2 > N3 || (N0 == PRT_LOWER && N2 == N3);
+
+    fprintf(F0, "%%%%MatrixMarket matrix %s %s\n%% NAQRA test.\n\n", B0 ? "coordinate" : "array", S1);
+
+    if(B0) fprintf(F0, "%zu %zu %zu\n", N1, N1, N4);
+    else fprintf(F0, "%zu %zu\n", N1, N1);
+
+    for(N2 = 0; N2 < N1; ++N2)
+        for(N3 = 0; N3 < N1; ++N3) {
+            const register Natural N5 = B0 ? N2 : N3, N6 = B0 ? N3 : N2; // Row, column.
+            if(!(N0 == PRT_GENERAL || N5 > N6 || (N0 == PRT_LOWER && N5 == N6))) continue;
+
+            const register Complex C0 = GetMatrixAt(M0, N5, N6);
+
+            if(B0) fprintf(F0, "%zu %zu ", N5 + 1, N6 + 1);
+            fprintf(F0, B1 ? "%.17g %.17g\n" : "%.17g\n", vgetq_lane_f64(C0, 0), vgetq_lane_f64(C0, 1));
+        }
+
+    return fclose(F0) == 0;
+}
+
+int main(int argc, char **argv) {
+    if(argc < 4) {
+        printf("Usage: %s N (Rows and Columns) R R (Range) * (Output, optional)\n", argv[0]);
+        return -1;
+    }
+
+    // Size.
+    const register Natural N0 = (Natural) atoi(argv[1]);
+
+    if(N0 == 0) {
+        printf("At least 1 row and column is needed.\n");
+        return -1;
+    }
+
+    // Interval.
+    const register Real R0 = (Real) atof(argv[2]), R1 = (Real) atof(argv[3]);
+    const register Real R2 = R1 - R0;
+
+    // Indices.
+    register Natural N1, N2;
+
+    // Matrices, complex general, complex hermitian, real symmetric and real skew-symmetric.
+    Matrix* Mv0[4] = {NewMatrix(N0, N0), NewMatrix(N0, N0), NewMatrix(N0, N0), NewMatrix(N0, N0)};
+
+    srand(time(NULL));
+    for(N1 = 0; N1 < N0; ++N1) // Random filling.
+        for(N2 = 0; N2 < N0; ++N2) {
+            const register Real R3 = R0 + R2 * (Real) rand() / RAND_MAX;
+            const register Real R4 = R0 + R2 * (Real) rand() / RAND_MAX;
+
+            SetMatrixAt(Mv0[0], N1, N2, C_RR_C(R3, R4));
+            if(N1 < N2) continue;
+
+            SetMatrixAt(Mv0[1], N1, N2, N1 == N2 ? C_R_C(R3) : C_RR_C(R3, R4));
+            SetMatrixAt(Mv0[1], N2, N1, N1 == N2 ? C_R_C(R3) : C_RR_C(R3, -R4));
+            SetMatrixAt(Mv0[2], N1, N2, C_R_C(R3));
+            SetMatrixAt(Mv0[2], N2, N1, C_R_C(R3));
+
+            if(N1 == N2) continue;
+
+            SetMatrixAt(Mv0[3], N1, N2, C_R_C(R4));
+            SetMatrixAt(Mv0[3], N2, N1, C_R_C(-R4));
+        }
+
+    // Cases: matrix, banner's qualifiers, coordinates, complex values, stored part and expected structure.
+    const struct { Natural N0; const char* S0; bool B0, B1; Natural N1, N2; } Csv0[7] = {
+        {0, "complex general", false, true, PRT_GENERAL, STR_GENERAL},
+        {0, "complex general", true, true, PRT_GENERAL, STR_GENERAL},
+        {1, "complex hermitian", false, true, PRT_LOWER, STR_HERMITIAN},
+        {1, "complex hermitian", true, true, PRT_LOWER, STR_HERMITIAN},
+        {2, "real symmetric", false, false, PRT_LOWER, STR_REAL | STR_HERMITIAN},
+        {2, "real symmetric", true, false, PRT_LOWER, STR_REAL | STR_HERMITIAN},
+        {3, "real skew-symmetric", false, false, PRT_STRICT, STR_REAL},
+    };
+
+    // Matrix file, in NAQRA_SCRATCH or the working directory.
+    const char* S0 = getenv("NAQRA_SCRATCH");
+    char S1[4096];
+
+    snprintf(S1, sizeof(S1), "%s/naqra.XXXXXX", S0 != NULL ? S0 : ".");
+
+    const register int I0 = mkstemp(S1);
+
+    if(I0 < 0) {
+        printf("Could not create a file at %s.\n", S1);
+
+        for(N1 = 0; N1 < 4; ++N1) FreeMatrix(Mv0[N1]);
+        return -1;
+    }
+
+    close(I0);
+
+    #ifndef NVERBOSE
+    printf("Testing on %zu x %zu Matrix Market files.\n", N0, N0);
+    printf("Coefficients generated in [%.1f, %.1f] x [%.1f, %.1f].\n\n", R0, R1, R0, R1);
+    #endif
+
+    register bool B0 = true;
+
+    for(N1 = 0; N1 < 7; ++N1) {
+        const Matrix* M0 = Mv0[Csv0[N1].N0];
+        Natural N3 = (Natural) -1;
+
+        Matrix* M1 = Sv_SSMBBN_B(S1, Csv0[N1].S0, M0, Csv0[N1].B0, Csv0[N1].B1, Csv0[N1].N1) ? ReadMatrixMarket(S1, &N3) : NULL;
+
+        if(M1 == NULL || M1->N0 != N0 || M1->N1 != N0) {
+            #ifndef NVERBOSE
+            printf("%s %s: not read.\n", Csv0[N1].B0 ? "Coordinate" : "Array", Csv0[N1].S0);
+            #endif
+
+            if(M1 != NULL) FreeMatrix(M1);
+            B0 = false;
+            continue;
+        }
+
+        register Real R3 = 0.0; // Entries' error.
+
+        for(N2 = 0; N2 < N0 * N0; ++N2)
+            R3 = fmax(R3, N2_C_R(S_CC_C(M1->Cm0[N2], M0->Cm0[N2])));
+
+        Vector* V0 = Eigenvalues(M1);
+        Vector* V1 = Eigenvalues(M0); // Reference.
+
+        const register Real R4 = Dst_CvCvN_R(V0->Cv0, V1->Cv0, N0);
+
+        #ifndef NVERBOSE
+        printf("%s %s, structure: %zu, largest entry error: %.2e, largest relative distance from Eigenvalues: %.2e.\n", Csv0[N1].B0 ? "Coordinate" : "Array", Csv0[N1].S0, N3, R3, R4);
+
+        if(argc > 4)
+            Pn_CcvN_0(V0->Cv0, N0);
+        #endif
+
+        B0 = B0 && N3 == Csv0[N1].N2 && R3 == 0.0 && R4 <= 1.0E-10;
+
+        FreeVector(V0);
+        FreeVector(V1);
+        FreeMatrix(M1);
+    }
+
+    unlink(S1);
+
+    for(N1 = 0; N1 < 4; ++N1) FreeMatrix(Mv0[N1]);
+    return B0 ? 0 : -1;
+}
\ No newline at end of file
@@ -0,0 +1,80 @@
+/**
+ * @file Test_Pseudospectra.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Pseudospectra test on a complex matrix, over its Gershgorin box.
+ * @date 2024-12-19
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include "./Test.h"
+
+// Grid points per side.
+#define GRD0 16
+
+int main(int argc, char **argv) {
+    if(argc < 4) {
+        printf("Usage: %s N (Rows and Columns) R R (Range) * (Output, optional)\n", argv[0]);
+        return -1;
+    }
+
+    // Size.
+    const register Natural N0 = (Natural) atoi(argv[1]);
+
+    if(N0 == 0) {
+        printf("At least 1 row and column is needed.\n");
+        return -1;
+    }
+
+    // Index.
+    register Natural N1 = 0;
+
+    // Interval.
+    const register Real R0 = (Real) atof(argv[2]), R1 = (Real) atof(argv[3]);
+    const register Real R2 = R1 - R0;
+
+    // Matrix.
+    Matrix* M0 = NewMatrix(N0, N0);
+
+    srand(time(NULL));
+    for(; N1 < N0 * N0; ++N1) { // Random filling.
+        const register Real R3 = R0 + R2 * (Real) rand() / RAND_MAX;
+        const register Real R4 = R0 + R2 * (Real) rand() / RAND_MAX;
+
+        M0->Cm0[N1] = C_RR_C(R3, R4);
+    }
+
+    #ifndef NVERBOSE
+    printf("Testing on a complex %zu x %zu matrix, %d x %d grid.\n", N0, N0, GRD0, GRD0);
+    printf("Coefficients generated in [%.1f, %.1f] x [%.1f, %.1f].\n\n", R0, R1, R0, R1);
+    #endif
+
+    Vector* V0 = SpectralBounds(M0); // Corners.
+    Pseudospectrum* P0 = Pseudospectra(M0, V0->Cv0[0], V0->Cv0[1], GRD0, GRD0); // Smallest singular values.
+
+    // Range of the smallest singular values.
+    register Real R5 = INFINITY, R6 = 0.0;
+
+    for(N1 = 0; N1 < GRD0 * GRD0; ++N1) {
+        R5 = fmin(R5, P0->Rm0[N1]);
+        R6 = fmax(R6, P0->Rm0[N1]);
+    }
+
+    #ifndef NVERBOSE
+    if(argc > 4) {
+        printf("--- Pseudospectrum, real imaginary value\n");
+        SavePseudospectrum(NULL, P0);
+        printf("---\n");
+    }
+
+    printf("Status: %zu, smallest singular values in [%.3e, %.3e].\n", P0->N2, R5, R6);
+    #endif
+
+    const register int I0 = P0->N2 == STS_CONVERGED ? 0 : -1;
+
+    FreeMatrix(M0);
+    FreeVector(V0);
+    FreePseudospectrum(P0);
+    return I0;
+}
\ No newline at end of file
@@ -0,0 +1,98 @@
+/**
+ * @file Test_Roots.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Companion QR test on a complex polynomial.
+ * @date 2024-12-17
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include "./Test.h"
+
+int main(int argc, char **argv) {
+    if(argc < 4) {
+        printf("Usage: %s N (Degree) R R (Range) * (Output, optional)\n", argv[0]);
+        return -1;
+    }
+
+    // Degree.
+    const register Natural N0 = (Natural) atoi(argv[1]);
+
+    if(N0 == 0) {
+        printf("At least degree 1 is needed.\n");
+        return -1;
+    }
+
+    // Indices.
+    register Natural N1 = 0, N2;
+
+    // Interval.
+    const register Real R0 = (Real) atof(argv[2]), R1 = (Real) atof(argv[3]);
+    const register Real R2 = R1 - R0;
+
+    // Random value.
+    register Real R3, R4;
+
+    // Coefficients, ascending powers.
+    Vector* V0 = NewVector(N0 + 1);
+
+    srand(time(NULL));
+    for(; N1 <= N0; ++N1) {
+        R3 = R0 + R2 * (Real) rand() / RAND_MAX;
+        R4 = R0 + R2 * (Real) rand() / RAND_MAX;
+
+        V0->Cv0[N1] = C_RR_C(R3, R4);
+    }
+
+    #ifndef NVERBOSE
+    printf("Testing on a complex polynomial of degree %zu.\n", N0);
+    printf("Coefficients generated in [%.1f, %.1f] x [%.1f, %.1f].\n\n", R0, R1, R0, R1);
+    #endif
+
+    Vector* V1 = Roots(V0); // Roots.
+
+    if(V1 == NULL) {
+        printf("Could not compute the roots.\n");
+        FreeVector(V0);
+        return -1;
+    }
+
+    // Backward error, |p(z)| against the sum of |a_k| |z|^k, by Horner.
+    // Roots outside the unit disk go through the reversed polynomial in 1 / z.
+    register Complex C0, C1;
+    register Real R5, R6 = 0.0;
+    register bool B0;
+
+    for(N1 = 0; N1 < V1->N0; ++N1) {
+        B0 = N2_C_R(V1->Cv0[N1]) > 1.0;
+        C1 = B0 ? D_CC_C(C_R_C(1.0), V1->Cv0[N1]) : V1->Cv0[N1];
+
+        C0 = V0->Cv0[B0 ? 0 : N0];
+        R5 = N2_C_R(C0);
+
+        for(N2 = 1; N2 <= N0; ++N2) {
+            C0 = A_CC_C(M_CC_C(C0, C1), V0->Cv0[B0 ? N2 : N0 - N2]);
+            R5 = R5 * N2_C_R(C1) + N2_C_R(V0->Cv0[B0 ? N2 : N0 - N2]);
+        }
+
+        R6 = fmax(R6, N2_C_R(C0) / R5);
+    }
+
+    #ifndef NVERBOSE
+    if(argc > 4) {
+        printf("--- Roots\n");
+
+        for(N1 = 0; N1 < V1->N0; ++N1)
+            Pn_C_0(V1->Cv0[N1]);
+
+        printf("---\n");
+    }
+
+    printf("Roots: %zu, backward error: %.3e.\n", V1->N0, R6);
+    #endif
+
+    FreeVector(V0);
+    FreeVector(V1);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,63 @@
+/**
+ * @file Test_Single.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief QR Algorithm test on a complex matrix, single precision.
+ * @date 2024-12-04
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include "./Test.h"
+
+int main(int argc, char **argv) {
+    if(argc < 4) {
+        printf("Usage: %s N (Rows and Columns) R R (Range) * (Output, optional)\n", argv[0]);
+        return -1;
+    }
+
+    // Size.
+    const register Natural N0 = (Natural) atoi(argv[1]);
+
+    // Interval.
+    const register Real R0 = (Real) atof(argv[2]), R1 = (Real) atof(argv[3]);
+    const register Real R2 = R1 - R0;
+
+    // Single Complex Matrix.
+    Complexs* Csm0 = (Complexs*) malloc((N0 * N0) * sizeof(Complexs));
+
+    srand(time(NULL));
+    for(register Natural N1 = 0; N1 < N0 * N0; ++N1) { // Random filling.
+        const register Real R3 = R0 + R2 * (Real) rand() / RAND_MAX;
+        const register Real R4 = R0 + R2 * (Real) rand() / RAND_MAX;
+
+        Csm0[N1] = Dm_C_Cs(C_RR_C(R3, R4));
+    }
+
+    #ifndef NVERBOSE
+    printf("Testing on a complex %zu x %zu matrix, single precision.\n", N0, N0);
+    printf("Coefficients generated in [%.1f, %.1f] x [%.1f, %.1f].\n\n", R0, R1, R0, R1);
+    #endif
+
+    #ifndef NVERBOSE
+    if(argc > 4)
+        Pn_CsmNN_0(Csm0, N0, N0);
+    #endif
+
+    Hsn_CsqtN_0(Csm0, N0); // Hessenberg.
+
+    #ifndef NVERBOSE
+    if(argc > 4)
+        Pn_CsmNN_0(Csm0, N0, N0);
+    #endif
+
+    Eig_CshsnqtN_0(Csm0, N0); // Eigenvalues.
+
+    #ifndef NVERBOSE
+    if(argc > 4)
+        Pn_CsmNN_0(Csm0, N0, N0);
+    #endif
+
+    free(Csm0);
+    return 0;
+}
\ No newline at end of file
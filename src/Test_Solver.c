@@ -0,0 +1,86 @@
+/**
+ * @file Test_Solver.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Warm-started QR Algorithm test on a sequence of nearby complex matrices, against Eigenvalues.
+ * @date 2024-12-20
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include "./Test.h"
+
+#ifndef SLV0
+
+// Matrices in the sequence.
+#define SLV0 6
+#endif
+
+int main(int argc, char **argv) {
+    if(argc < 4) {
+        printf("Usage: %s N (Rows and Columns) R R (Range) * (Output, optional)\n", argv[0]);
+        return -1;
+    }
+
+    // Size.
+    const register Natural N0 = (Natural) atoi(argv[1]);
+
+    if(N0 == 0) {
+        printf("At least 1 row and column is needed.\n");
+        return -1;
+    }
+
+    // Interval.
+    const register Real R0 = (Real) atof(argv[2]), R1 = (Real) atof(argv[3]);
+    const register Real R2 = R1 - R0;
+
+    // Matrix and perturbation.
+    Matrix* M0 = NewMatrix(N0, N0);
+    Complex* Cm0 = (Complex*) malloc(N0 * N0 * sizeof(Complex));
+    Complex* Cm1 = (Complex*) malloc(N0 * N0 * sizeof(Complex));
+
+    srand(time(NULL));
+    for(register Natural N1 = 0; N1 < N0 * N0; ++N1) { // Random filling.
+        Cm0[N1] = C_RR_C(R0 + R2 * (Real) rand() / RAND_MAX, R0 + R2 * (Real) rand() / RAND_MAX);
+        Cm1[N1] = C_RR_C(R0 + R2 * (Real) rand() / RAND_MAX, R0 + R2 * (Real) rand() / RAND_MAX);
+    }
+
+    #ifndef NVERBOSE
+    printf("Testing on a sequence of %d complex %zu x %zu matrices, warm-started.\n", SLV0, N0, N0);
+    printf("Coefficients generated in [%.1f, %.1f] x [%.1f, %.1f].\n", R0, R1, R0, R1);
+    #endif
+
+    Solver* S0 = NewSolver(N0);
+    register bool B0 = true;
+
+    for(register Natural N1 = 0; N1 < SLV0; ++N1) {
+        const register Real R3 = 1.0E-3 * (Real) N1; // Step.
+
+        for(register Natural N2 = 0; N2 < N0 * N0; ++N2)
+            M0->Cm0[N2] = A_CC_C(Cm0[N2], M_CR_C(Cm1[N2], R3));
+
+        Natural N2 = STS_FAILED;
+        Vector* V0 = SolverEigenvalues(S0, M0, &N2);
+        Vector* V1 = Eigenvalues(M0); // Reference.
+
+        const register Real R4 = Dst_CvCvN_R(V0->Cv0, V1->Cv0, N0);
+
+        #ifndef NVERBOSE
+        printf("\nMatrix %zu, status: %zu, largest relative distance from Eigenvalues: %.2e.\n", N1, N2, R4);
+
+        if(argc > 4)
+            Pn_CcvN_0(V0->Cv0, N0);
+        #endif
+
+        B0 = B0 && N2 == STS_CONVERGED && R4 <= 1.0E-10;
+
+        FreeVector(V0);
+        FreeVector(V1);
+    }
+
+    FreeSolver(S0);
+    FreeMatrix(M0);
+    free(Cm0);
+    free(Cm1);
+    return B0 ? 0 : -1;
+}
\ No newline at end of file
@@ -0,0 +1,125 @@
+/**
+ * @file Test_Sparse.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Implicitly restarted Arnoldi test on a sparse matrix and on a matrix-free operator.
+ * @date 2024-12-12
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include "./Test.h"
+
+// Stored entries per row.
+#define ROW0 5
+
+/**
+ * @brief Laplacian mat-vec [Lpl], one-dimensional, matrix-free.
+ * 
+ * @param Cv0 Complex Vector [Cv].
+ * @param Cvt0 Complex Vector [Cv], Target [t].
+ * @param P0 Rows and Columns.
+ */
+static void Lpl_CvCvtP_0(const Complex* Cv0, Complex* Cvt0, void* P0) {
+    const register Natural N0 = *(const Natural*) P0;
+
+    for(register Natural N1 = 0; N1 < N0; ++N1) {
+        Cvt0[N1] = M_CR_C(Cv0[N1], 2.0);
+
+        if(N1 > 0) Cvt0[N1] = S_CC_C(Cvt0[N1], Cv0[N1 - 1]);
+        if(N1 + 1 < N0) Cvt0[N1] = S_CC_C(Cvt0[N1], Cv0[N1 + 1]);
+    }
+}
+
+int main(int argc, char **argv) {
+    if(argc < 4) {
+        printf("Usage: %s N (Rows and Columns) R R (Range) * (Output, optional)\n", argv[0]);
+        return -1;
+    }
+
+    // Size.
+    Natural N0 = (Natural) atoi(argv[1]);
+
+    // Wanted eigenvalues.
+    const register Natural N1 = N0 > 12 ? 6 : N0 / 2;
+
+    if(N1 == 0) {
+        printf("At least 2 rows and columns are needed.\n");
+        return -1;
+    }
+
+    // Indices.
+    register Natural N2 = 0, N3;
+
+    // Interval.
+    const register Real R0 = (Real) atof(argv[2]), R1 = (Real) atof(argv[3]);
+    const register Real R2 = R1 - R0;
+
+    // Random value.
+    register Real R3, R4;
+
+    // Status.
+    Natural N4, N5;
+
+    // Sparse Matrix, the diagonal and random columns on each row.
+    SparseMatrix* S0 = NewSparseMatrix(N0, ROW0 * N0);
+
+    srand(time(NULL));
+    for(; N2 < N0; ++N2) {
+        S0->Nv0[N2] = ROW0 * N2;
+
+        for(N3 = 0; N3 < ROW0; ++N3) {
+            R3 = R0 + R2 * (Real) rand() / RAND_MAX;
+            R4 = R0 + R2 * (Real) rand() / RAND_MAX;
+
+            S0->Cv0[ROW0 * N2 + N3] = C_RR_C(R3, R4);
+            S0->Nv1[ROW0 * N2 + N3] = N3 == 0 ? N2 : (Natural) rand() % N0;
+        }
+    }
+
+    S0->Nv0[N0] = ROW0 * N0;
+
+    #ifndef NVERBOSE
+    printf("Testing on a sparse %zu x %zu matrix, %d entries per row.\n", N0, N0, ROW0);
+    printf("Coefficients generated in [%.1f, %.1f] x [%.1f, %.1f].\n\n", R0, R1, R0, R1);
+    #endif
+
+    Vector* V0 = SparseEigenvalues(S0, N1, SRT_MAGNITUDE, &N4); // Eigenvalues.
+
+    #ifndef NVERBOSE
+    if(argc > 4) {
+        printf("--- Eigenvalues, largest magnitude\n");
+
+        for(N2 = 0; N2 < N1; ++N2)
+            Pn_C_0(V0->Cv0[N2]);
+
+        printf("---\n");
+    }
+
+    printf("Status: %zu.\n\n", N4);
+    #endif
+
+    #ifndef NVERBOSE
+    printf("Testing on a matrix-free %zu x %zu Laplacian.\n\n", N0, N0);
+    #endif
+
+    Vector* V1 = OperatorEigenvalues(Lpl_CvCvtP_0, &N0, N0, N1, SRT_REAL, &N5); // Eigenvalues.
+
+    #ifndef NVERBOSE
+    if(argc > 4) {
+        printf("--- Eigenvalues, largest real part\n");
+
+        for(N2 = 0; N2 < N1; ++N2)
+            Pn_C_0(V1->Cv0[N2]);
+
+        printf("---\n");
+    }
+
+    printf("Status: %zu.\n", N5);
+    #endif
+
+    FreeSparseMatrix(S0);
+    FreeVector(V0);
+    FreeVector(V1);
+    return N4 == STS_CONVERGED && N5 == STS_CONVERGED ? 0 : -1;
+}
\ No newline at end of file
@@ -0,0 +1,160 @@
+/**
+ * @file Test_Stream.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Streamed QR Algorithm test on a complex matrix and its Hessenberg part, against Eigenvalues.
+ * @date 2024-12-20
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include "./Test.h"
+
+// Streamed eigenvalues.
+typedef struct {
+
+    // Eigenvalues, by index.
+    Complex* Cv0;
+
+    // Deliveries, by index.
+    Natural* Nv0;
+
+    // Delivered.
+    Natural N0;
+
+    // Cancellation, after as many deliveries, 0 for none.
+    Natural N1;
+
+    // Iterations, last delivery.
+    Natural N2;
+
+    // Iterations never decreased.
+    bool B0;
+
+} Stream;
+
+/**
+ * @brief Deflation collector [Out], cancelling after the requested deliveries.
+ * 
+ * @param N0 Deflation index.
+ * @param C0 Eigenvalue.
+ * @param N1 Iterations so far.
+ * @param P0 Stream.
+ * @return bool False once the requested deliveries are reached.
+ */
+static bool Out_NCNP_B(const Natural N0, const Complex C0, const Natural N1, void* P0) {
+    Stream* St0 = (Stream*) P0;
+
+    St0->Cv0[N0] = C0;
+    ++St0->Nv0[N0];
+    ++St0->N0;
+
+    St0->B0 = St0->B0 && N1 >= St0->N2;
+    St0->N2 = N1;
+
+    return St0->N1 == 0 || St0->N0 < St0->N1;
+}
+
+/**
+ * @brief Stream check [Chk], every index delivered once, against the reference.
+ * 
+ * @param M0 Matrix.
+ * @param Cv0 Complex Vector [Cv], reference eigenvalues.
+ * @param N0 Cancellation [N], 0 for none.
+ * @param B0 Output.
+ * @return bool Passed.
+ */
+static bool Chk_MCvNB_B(const Matrix* M0, const Complex* Cv0, const Natural N0, const bool B0) {
+    const register Natural N1 = M0->N0;
+
+    Stream St0 = {.Cv0 = (Complex*) calloc(N1, sizeof(Complex)), .Nv0 = (Natural*) calloc(N1, sizeof(Natural)), .N1 = N0, .B0 = true};
+
+    const register Natural N2 = StreamEigenvalues(M0, Out_NCNP_B, &St0, NULL);
+    register bool B1 = St0.B0;
+
+    for(register Natural N3 = 0; N3 < N1; ++N3) // Deliveries, the latest indices first.
+        B1 = B1 && St0.Nv0[N3] == (N3 + St0.N0 >= N1);
+
+    if(N0 == 0) {
+        const register Real R0 = Dst_CvCvN_R(St0.Cv0, Cv0, N1);
+
+        #ifndef NVERBOSE
+        printf("Status: %zu, largest relative distance from Eigenvalues: %.2e.\n", N2, R0);
+
+        if(B0)
+            Pn_CcvN_0(St0.Cv0, N1);
+        #endif
+
+        B1 = B1 && N2 == STS_CONVERGED && St0.N0 == N1 && R0 <= 1.0E-10;
+    } else {
+        #ifndef NVERBOSE
+        printf("Status: %zu, %zu eigenvalues delivered before cancelling.\n", N2, St0.N0);
+        #endif
+
+        B1 = B1 && N2 == STS_CANCELLED && St0.N0 == N0;
+    }
+
+    free(St0.Cv0);
+    free(St0.Nv0);
+    return B1;
+}
+
+int main(int argc, char **argv) {
+    if(argc < 4) {
+        printf("Usage: %s N (Rows and Columns) R R (Range) * (Output, optional)\n", argv[0]);
+        return -1;
+    }
+
+    // Size.
+    const register Natural N0 = (Natural) atoi(argv[1]);
+
+    if(N0 == 0) {
+        printf("At least 1 row and column is needed.\n");
+        return -1;
+    }
+
+    // Interval.
+    const register Real R0 = (Real) atof(argv[2]), R1 = (Real) atof(argv[3]);
+    const register Real R2 = R1 - R0;
+
+    // Matrices, general and its Hessenberg part.
+    Matrix* M0 = NewMatrix(N0, N0);
+    Matrix* M1 = NewMatrix(N0, N0);
+
+    srand(time(NULL));
+    for(register Natural N1 = 0; N1 < N0 * N0; ++N1) { // Random filling.
+        M0->Cm0[N1] = C_RR_C(R0 + R2 * (Real) rand() / RAND_MAX, R0 + R2 * (Real) rand() / RAND_MAX);
+
+        if(N1 / N0 <= N1 % N0 + 1) // Row at most one below the column.
+            M1->Cm0[N1] = M0->Cm0[N1];
+    }
+
+    #ifndef NVERBOSE
+    printf("Testing on a complex %zu x %zu matrix and its Hessenberg part, streamed.\n", N0, N0);
+    printf("Coefficients generated in [%.1f, %.1f] x [%.1f, %.1f].\n", R0, R1, R0, R1);
+    #endif
+
+    Vector* V0 = Eigenvalues(M0); // References.
+    Vector* V1 = Eigenvalues(M1);
+    register bool B0 = true;
+
+    #ifndef NVERBOSE
+    printf("\nGeneral matrix.\n");
+    #endif
+
+    B0 = Chk_MCvNB_B(M0, V0->Cv0, 0, argc > 4) && B0;
+
+    if(N0 > 1) B0 = Chk_MCvNB_B(M0, V0->Cv0, N0 / 2, argc > 4) && B0;
+
+    #ifndef NVERBOSE
+    printf("\nHessenberg matrix.\n");
+    #endif
+
+    B0 = Chk_MCvNB_B(M1, V1->Cv0, 0, argc > 4) && B0;
+
+    FreeVector(V0);
+    FreeVector(V1);
+    FreeMatrix(M0);
+    FreeMatrix(M1);
+    return B0 ? 0 : -1;
+}
\ No newline at end of file
@@ -0,0 +1,99 @@
+/**
+ * @file Test_Structure.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Real QR test on zero-diagonal, large-norm matrices.
+ * @date 2024-12-13
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include "./Test.h"
+
+int main(int argc, char **argv) {
+    // Indices.
+    register Natural N1, N2, N3;
+
+    // Errors, cyclic and companion.
+    register Real R0 = 0.0, R1 = 0.0;
+    register Real R2, R3, R4;
+
+    // Cyclic matrices, zero diagonal, A[0][N - 1] = 1E12, eigenvalues on a circle of radius 1E12^(1 / N).
+    for(N1 = 4; N1 <= 8; ++N1) {
+        const register Real R5 = pow(1.0E12, 1.0 / (Real) N1); // Radius.
+
+        Matrix* M0 = NewMatrix(N1, N1);
+
+        for(N2 = 0; N2 + 1 < N1; ++N2)
+            M0->Cm0[N2 * N1 + N2 + 1] = C_R_C(1.0);
+
+        M0->Cm0[(N1 - 1) * N1] = C_R_C(1.0E12);
+
+        Vector* V0 = Eigenvalues(M0);
+
+        for(N2 = 0; N2 < N1; ++N2) { // Distance to the nearest root of unity, scaled.
+            R2 = fmod(atan2(vgetq_lane_f64(V0->Cv0[N2], 1), vgetq_lane_f64(V0->Cv0[N2], 0)) * (Real) N1 / (2.0 * M_PI) + (Real) N1, 1.0);
+            R2 = fmin(R2, 1.0 - R2) * 2.0 * M_PI / (Real) N1;
+            R0 = fmax(R0, fmax(fabs(N2_C_R(V0->Cv0[N2]) - R5) / R5, R2));
+        }
+
+        #ifndef NVERBOSE
+        if(argc > 1)
+            Pn_CcvN_0(V0->Cv0, N1);
+        #endif
+
+        FreeVector(V0);
+        FreeMatrix(M0);
+    }
+
+    // Wilkinson's polynomials, degrees 14 to 20, companion matrices.
+    for(N1 = 14; N1 <= 20; ++N1) {
+        Real* Rv0 = (Real*) calloc(N1 + 1, sizeof(Real)); // Coefficients, ascending powers.
+        Rv0[0] = 1.0;
+
+        for(N2 = 1; N2 <= N1; ++N2) { // Times (x - N2).
+            for(N3 = N2; N3 > 0; --N3)
+                Rv0[N3] = Rv0[N3 - 1] - (Real) N2 * Rv0[N3];
+
+            Rv0[0] *= -(Real) N2;
+        }
+
+        Matrix* M0 = NewMatrix(N1, N1);
+
+        for(N2 = 0; N2 < N1; ++N2) {
+            M0->Cm0[N2 * N1] = C_R_C(-Rv0[N1 - 1 - N2]);
+            if(N2 + 1 < N1) M0->Cm0[N2 * N1 + N2 + 1] = C_R_C(1.0);
+        }
+
+        Vector* V0 = Eigenvalues(M0);
+
+        for(N2 = 0; N2 < N1; ++N2) { // Backward error, |p(z)| against the sum of |a_k| |z|^k, by Horner.
+            register Complex C0 = C_R_C(1.0);
+            R3 = 1.0;
+            R4 = N2_C_R(V0->Cv0[N2]);
+
+            for(N3 = N1; N3 > 0; --N3) {
+                C0 = A_CC_C(M_CC_C(C0, V0->Cv0[N2]), C_R_C(Rv0[N3 - 1]));
+                R3 = R3 * R4 + fabs(Rv0[N3 - 1]);
+            }
+
+            R1 = fmax(R1, N2_C_R(C0) / R3);
+        }
+
+        #ifndef NVERBOSE
+        if(argc > 1)
+            Pn_CcvN_0(V0->Cv0, N1);
+        #endif
+
+        free(Rv0);
+        FreeVector(V0);
+        FreeMatrix(M0);
+    }
+
+    #ifndef NVERBOSE
+    printf("Cyclic matrices of sizes 4 to 8, largest relative error: %.2e.\n", R0);
+    printf("Wilkinson's companion matrices of sizes 14 to 20, largest backward error: %.2e.\n", R1);
+    #endif
+
+    return (R0 <= 1.0E-12 && R1 <= 1.0E-12) ? 0 : -1;
+}
\ No newline at end of file
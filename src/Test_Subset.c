@@ -0,0 +1,101 @@
+/**
+ * @file Test_Subset.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Subset eigenvalues test on a packed hermitian matrix, by index and by value.
+ * @date 2024-12-11
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include "./Test.h"
+
+int main(int argc, char **argv) {
+    if(argc < 4) {
+        printf("Usage: %s N (Rows and Columns) R R (Range) * (Output, optional)\n", argv[0]);
+        return -1;
+    }
+
+    // Size.
+    const register Natural N0 = (Natural) atoi(argv[1]);
+
+    // Indices.
+    register Natural N1 = 0, N2;
+
+    // Interval.
+    const register Real R0 = (Real) atof(argv[2]), R1 = (Real) atof(argv[3]);
+    const register Real R2 = R1 - R0;
+
+    // Random value.
+    register Real R3, R4;
+
+    // Complex Hermitian Packed Matrix, lower triangle.
+    Complex* Chp0 = (Complex*) malloc((N0 * (N0 + 1) / 2) * sizeof(Complex));
+
+    // Diagonal and off-diagonal.
+    Real* Rv0 = (Real*) malloc(N0 * sizeof(Real));
+    Real* Rv1 = (Real*) malloc(N0 * sizeof(Real));
+
+    // Eigenvalues.
+    Real* Rv2 = (Real*) malloc(N0 * sizeof(Real));
+
+    srand(time(NULL));
+    for(; N1 < N0; ++N1) {
+        R3 = R0 + R2 * (Real) rand() / RAND_MAX;
+
+        Chp0[Pk_NNN_N(N1, N1, N0)] = C_R_C(R3);
+
+        for(N2 = N1 + 1; N2 < N0; ++N2) {
+            R3 = R0 + R2 * (Real) rand() / RAND_MAX;
+            R4 = R0 + R2 * (Real) rand() / RAND_MAX;
+
+            Chp0[Pk_NNN_N(N2, N1, N0)] = C_RR_C(R3, R4);
+        }
+    }
+
+    #ifndef NVERBOSE
+    printf("Testing on a packed hermitian %zu x %zu matrix.\n", N0, N0);
+    printf("Coefficients generated in [%.1f, %.1f] x [%.1f, %.1f].\n\n", R0, R1, R0, R1);
+    #endif
+
+    Trd_ChptRvtRvtN_0(Chp0, Rv0, Rv1, N0); // Tridiagonal.
+
+    // By index, the middle half.
+    const register Natural N3 = N0 / 4, N4 = N0 - N0 / 4;
+
+    Sbs_RvRvRvtNNNN_0(Rv0, Rv1, Rv2, N0, N3, N4, Thr_0_N()); // Eigenvalues.
+
+    #ifndef NVERBOSE
+    if(argc > 4) {
+        printf("--- Eigenvalues, indices [%zu, %zu)\n", N3, N4);
+
+        for(N1 = 0; N1 < N4 - N3; ++N1)
+            Pn_C_0(C_R_C(Rv2[N1]));
+
+        printf("---\n");
+    }
+    #endif
+
+    // By value, the coefficients' interval.
+    const register Natural N5 = Stc_RvRvRN_N(Rv0, Rv1, R0, N0);
+    const register Natural N6 = Stc_RvRvRN_N(Rv0, Rv1, R1, N0);
+
+    if(N6 > N5) Sbs_RvRvRvtNNNN_0(Rv0, Rv1, Rv2, N0, N5, N6, Thr_0_N()); // Eigenvalues.
+
+    #ifndef NVERBOSE
+    if(argc > 4) {
+        printf("--- Eigenvalues, values [%.1f, %.1f)\n", R0, R1);
+
+        for(N1 = 0; N1 < N6 - N5; ++N1)
+            Pn_C_0(C_R_C(Rv2[N1]));
+
+        printf("---\n");
+    }
+    #endif
+
+    free(Chp0);
+    free(Rv0);
+    free(Rv1);
+    free(Rv2);
+    return 0;
+}
\ No newline at end of file
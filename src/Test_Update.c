@@ -0,0 +1,137 @@
+/**
+ * @file Test_Update.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Hermitian rank-one and low-rank updates test, against Eigenvalues.
+ * @date 2024-12-20
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include "./Test.h"
+
+#ifndef UPDT0
+
+// Columns of the low-rank update.
+#define UPDT0 3
+#endif
+
+/**
+ * @brief Reference [Rf], eigenvalues of the dense matrix A + V diag(weights) V^H.
+ * 
+ * @param H0 Hermitian matrix A.
+ * @param Rv0 Real Vector [Rv], weights.
+ * @param Cm0 Complex Matrix [Cm], V by column.
+ * @param N0 Columns [N].
+ * @return Vector* Vector, eigenvalues.
+ */
+static Vector* Rf_HRvCmN_V(const HermitianMatrix* H0, const Real* Rv0, const Complex* Cm0, const Natural N0) {
+    const register Natural N1 = H0->N0;
+    Matrix* M0 = NewMatrix(N1, N1);
+
+    for(register Natural N2 = 0; N2 < N1; ++N2)
+        for(register Natural N3 = 0; N3 < N1; ++N3) {
+            register Complex C0 = GetHermitianMatrixAt(H0, N2, N3);
+
+            for(register Natural N4 = 0; N4 < N0; ++N4) // Weighted outer products.
+                C0 = A_CC_C(C0, M_CR_C(M_CC_C(Cm0[N4 * N1 + N2], Cj_C_C(Cm0[N4 * N1 + N3])), Rv0[N4]));
+
+            M0->Cm0[N2 * N1 + N3] = C0;
+        }
+
+    Vector* V0 = Eigenvalues(M0);
+
+    FreeMatrix(M0);
+    return V0;
+}
+
+int main(int argc, char **argv) {
+    if(argc < 4) {
+        printf("Usage: %s N (Rows and Columns) R R (Range) * (Output, optional)\n", argv[0]);
+        return -1;
+    }
+
+    // Size.
+    const register Natural N0 = (Natural) atoi(argv[1]);
+
+    if(N0 == 0) {
+        printf("At least 1 row and column is needed.\n");
+        return -1;
+    }
+
+    // Interval.
+    const register Real R0 = (Real) atof(argv[2]), R1 = (Real) atof(argv[3]);
+    const register Real R2 = R1 - R0;
+
+    // Indices.
+    register Natural N1, N2;
+
+    // Hermitian matrix.
+    HermitianMatrix* H0 = NewHermitianMatrix(N0);
+
+    srand(time(NULL));
+    for(N1 = 0; N1 < N0; ++N1) { // Random filling.
+        SetHermitianMatrixAt(H0, N1, N1, C_R_C(R0 + R2 * (Real) rand() / RAND_MAX));
+
+        for(N2 = 0; N2 < N1; ++N2)
+            SetHermitianMatrixAt(H0, N1, N2, C_RR_C(R0 + R2 * (Real) rand() / RAND_MAX, R0 + R2 * (Real) rand() / RAND_MAX));
+    }
+
+    // Update, V by column, the last column being sparse for deflation.
+    Matrix* M0 = NewMatrix(N0, UPDT0);
+    const Real Rv0[UPDT0] = {1.5, -0.7, 0.3};
+
+    for(N1 = 0; N1 < UPDT0; ++N1)
+        for(N2 = 0; N2 < N0; ++N2)
+            if(N1 + 1 < UPDT0 || N2 % 3 == 0)
+                M0->Cm0[N1 * N0 + N2] = C_RR_C(R0 + R2 * (Real) rand() / RAND_MAX, R0 + R2 * (Real) rand() / RAND_MAX);
+
+    #ifndef NVERBOSE
+    printf("Testing on a hermitian %zu x %zu matrix, rank-one and rank-%d updates.\n", N0, N0, UPDT0);
+    printf("Coefficients generated in [%.1f, %.1f] x [%.1f, %.1f].\n", R0, R1, R0, R1);
+    #endif
+
+    HermitianDecomposition* D0 = NewHermitianDecomposition(H0);
+
+    // Rank-one, eigenvalues only.
+    Vector* V0 = NewVector(N0);
+    Cp_CvtCvN_0(V0->Cv0, M0->Cm0, N0);
+
+    Vector* V1 = UpdatedHermitianEigenvalues(D0, Rv0[0], V0);
+    Vector* V2 = Rf_HRvCmN_V(H0, Rv0, M0->Cm0, 1); // Reference.
+
+    const register Real R3 = Dst_CvCvN_R(V1->Cv0, V2->Cv0, N0);
+
+    #ifndef NVERBOSE
+    printf("\nRank-one, largest relative distance from Eigenvalues: %.2e.\n", R3);
+
+    if(argc > 4)
+        Pn_CcvN_0(V1->Cv0, N0);
+    #endif
+
+    FreeVector(V1);
+    FreeVector(V2);
+
+    // Low-rank, eigenvectors included.
+    LowRankUpdateHermitianDecomposition(D0, Rv0, M0);
+    V2 = Rf_HRvCmN_V(H0, Rv0, M0->Cm0, UPDT0); // Reference.
+
+    for(N1 = 0; N1 < N0; ++N1)
+        V0->Cv0[N1] = C_R_C(D0->Rv0[N1]);
+
+    const register Real R4 = Dst_CvCvN_R(V0->Cv0, V2->Cv0, N0);
+
+    #ifndef NVERBOSE
+    printf("Rank-%d, largest relative distance from Eigenvalues: %.2e.\n", UPDT0, R4);
+
+    if(argc > 4)
+        Pn_CcvN_0(V0->Cv0, N0);
+    #endif
+
+    FreeVector(V0);
+    FreeVector(V2);
+    FreeHermitianDecomposition(D0);
+    FreeMatrix(M0);
+    FreeHermitianMatrix(H0);
+    return R3 <= 1.0E-10 && R4 <= 1.0E-10 ? 0 : -1;
+}
\ No newline at end of file
@@ -0,0 +1,500 @@
+/**
+ * @file Tool_Daemon.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief naqra-daemon, serves eigenvalue requests over a Unix socket.
+ * @date 2024-12-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ * Each connection has a reader thread parsing its requests into a shared
+ * queue. A pool of workers takes the oldest request together with the queued
+ * requests of the same size, when at most DMN2, and solves them back to back
+ * on its own workspace, replying to each with its status and timings. Batches
+ * take a fair share of the queue, up to the batch limit, so that idle workers
+ * are left some. Larger requests are solved alone. Diagnostics go to stderr.
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE // Sockets and file seals.
+#endif
+
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "./Daemon.h"
+
+// Connection.
+typedef struct {
+
+    // Socket.
+    int I0;
+
+    // References, the reader's and the queued requests'.
+    atomic_size_t N0;
+
+    // Replies' lock.
+    pthread_mutex_t Mx0;
+
+} Connection;
+
+// Queued request.
+typedef struct Job {
+
+    // Connection.
+    Connection* Cn0;
+
+    // Entries, column-major.
+    Complex* Cm0;
+
+    // Rows and Columns.
+    Natural N0;
+
+    // Tag.
+    uint64_t N1;
+
+    // Receipt, seconds.
+    Real R0;
+
+    // Next request.
+    struct Job* Jb0;
+
+} Job;
+
+// Worker's workspace, grown to the largest request seen.
+typedef struct {
+
+    // Matrix, Hessenberg form and compact storage.
+    Complex* Cm0;
+
+    // Eigenvalues, by deflation index.
+    Complex* Cv0;
+
+    // Splits, for the structure probe.
+    Natural* Nv0;
+
+    // Capacity, rows and columns.
+    Natural N0;
+
+    // Converged eigenvalues.
+    Natural N1;
+
+} Workspace;
+
+// Queue.
+static pthread_mutex_t Mx0 = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t Cd0 = PTHREAD_COND_INITIALIZER;
+static Job* Jb0 = NULL; // Oldest.
+static Job* Jb1 = NULL; // Newest.
+static Natural N0 = DMN1; // Batch limit.
+static Natural N1 = 0; // Queued requests.
+static Natural N2 = 1; // Workers.
+
+// Stop flag.
+static volatile sig_atomic_t B0 = 0;
+
+/**
+ * @brief Stop [Stp], signal handler.
+ */
+static void Stp_I_0([[maybe_unused]] int I0) { B0 = 1; }
+
+/**
+ * @brief Nanoseconds [Ns].
+ * 
+ * @param R0 Real Number [R], seconds.
+ * @return uint64_t Nanoseconds.
+ */
+static inline uint64_t Ns_R_N(const Real R0) { return R0 > 0.0 ? (uint64_t) (R0 * 1.0E9) : 0; }
+
+/**
+ * @brief Release [Rl], closes the connection with its last reference.
+ * 
+ * @param Cn0 Connection [Cn].
+ */
+static void Rl_Cn_0(Connection* Cn0) {
+    if(atomic_fetch_sub(&Cn0->N0, 1) != 1) return;
+
+    close(Cn0->I0);
+    pthread_mutex_destroy(&Cn0->Mx0);
+    Fr_P_0(Cn0);
+}
+
+/**
+ * @brief Write [Wr], the whole buffer.
+ * 
+ * @param I0 Socket.
+ * @param P0 Buffer.
+ * @param N1 Bytes [N].
+ * @return bool Success [B].
+ */
+static bool Wr_IPN_B(const int I0, const void* P0, const Natural N1) {
+    register ssize_t I1;
+
+    for(register Natural N2 = 0; N2 < N1; N2 += (Natural) I1)
+        if((I1 = send(I0, (const char*) P0 + N2, N1 - N2, MSG_NOSIGNAL)) <= 0) return false;
+
+    return true;
+}
+
+/**
+ * @brief Reply [Rp].
+ * 
+ * Replies from different workers are serialized on the connection's lock, a
+ * closed peer being ignored.
+ * 
+ * @param Cn0 Connection [Cn].
+ * @param Rp0 Reply record [Rp].
+ * @param Cv0 Complex Vector [Cv], eigenvalues, Rp0->N2 of them.
+ */
+static void Rp_CnRpCv_0(Connection* Cn0, const Reply* Rp0, const Complex* Cv0) {
+    pthread_mutex_lock(&Cn0->Mx0);
+
+    if(Wr_IPN_B(Cn0->I0, Rp0, sizeof(Reply)) && Rp0->N2 > 0)
+        Wr_IPN_B(Cn0->I0, Cv0, (Natural) Rp0->N2 * sizeof(Complex));
+
+    pthread_mutex_unlock(&Cn0->Mx0);
+}
+
+/**
+ * @brief Receive [Rcv], a request record and its descriptor, if any.
+ * 
+ * @param I0 Socket.
+ * @param Rqt0 Request record [Rq], Target [t].
+ * @param It0 Descriptor, Target [t], -1 if none.
+ * @return bool Success [B].
+ */
+static bool Rcv_IRqtIt_B(const int I0, Request* Rqt0, int* It0) {
+    union { struct cmsghdr Cmh0; char S0[CMSG_SPACE(sizeof(int))]; } U0;
+    struct iovec Io0 = {.iov_base = Rqt0, .iov_len = sizeof(Request)};
+    struct msghdr Msh0 = {.msg_iov = &Io0, .msg_iovlen = 1, .msg_control = U0.S0, .msg_controllen = sizeof(U0.S0)};
+    register ssize_t I1 = recvmsg(I0, &Msh0, 0);
+    register Natural N1;
+
+    *It0 = -1;
+    if(I1 <= 0) return false;
+
+    for(struct cmsghdr* Cmh1 = CMSG_FIRSTHDR(&Msh0); Cmh1 != NULL; Cmh1 = CMSG_NXTHDR(&Msh0, Cmh1))
+        if(Cmh1->cmsg_level == SOL_SOCKET && Cmh1->cmsg_type == SCM_RIGHTS)
+            memcpy(It0, CMSG_DATA(Cmh1), sizeof(int));
+
+    for(N1 = (Natural) I1; N1 < sizeof(Request); N1 += (Natural) I1) // Remainder.
+        if((I1 = read(I0, (char*) Rqt0 + N1, sizeof(Request) - N1)) <= 0) break;
+
+    return N1 == sizeof(Request);
+}
+
+/**
+ * @brief Sealed [Sld], a shared memory file that can neither shrink nor change.
+ * 
+ * The mapping is used without copies, so that a file shrinking under it would
+ * fault the daemon and one being written would change the request mid-solve.
+ * 
+ * @param I0 Descriptor.
+ * @return bool F_SEAL_SHRINK and F_SEAL_WRITE both set [B].
+ */
+static bool Sld_I_B(const int I0) {
+    const register int I1 = fcntl(I0, F_GET_SEALS);
+    return I1 >= 0 && (I1 & (F_SEAL_SHRINK | F_SEAL_WRITE)) == (F_SEAL_SHRINK | F_SEAL_WRITE);
+}
+
+/**
+ * @brief Reader [Rd], parses a connection's requests into the queue.
+ * 
+ * Invalid shared requests, unsealed ones included, are answered with
+ * STS_FAILED. Invalid inline ones leave the stream out of step and close the
+ * connection.
+ * 
+ * @param P0 Connection.
+ * @return void* NULL.
+ */
+static void* Rd_P_P(void* P0) {
+    Connection* Cn0 = (Connection*) P0;
+    Request Rq0;
+    Format Fmt0;
+    int I0;
+
+    while(Rcv_IRqtIt_B(Cn0->I0, &Rq0, &I0)) {
+        const register Real R0 = Tm_0_R();
+        const register bool B1 = (Rq0.N1 & REQ_SHARED) != 0;
+        Complex* Cm0 = NULL;
+
+        if(B1 && I0 >= 0 && Sld_I_B(I0) && lseek(I0, 0, SEEK_SET) == 0) // Shared memory.
+            Cm0 = Ld_IFmtt_Cm(I0, &Fmt0);
+        else if(!B1)
+            Cm0 = Ld_IFmtt_Cm(Cn0->I0, &Fmt0);
+
+        if(I0 >= 0) close(I0);
+        if(Cm0 == NULL && !B1) break;
+
+        if(Cm0 == NULL || Fmt0.N4 != Fmt0.N5) { // Invalid.
+            const Reply Rp0 = {.N0 = Rq0.N0, .N1 = STS_FAILED, .N6 = Ns_R_N(Tm_0_R() - R0)};
+
+            Rp_CnRpCv_0(Cn0, &Rp0, NULL);
+            Fr_P_0(Cm0);
+            continue;
+        }
+
+        Job* Jb2 = (Job*) Alc_NN_P(1, sizeof(Job));
+
+        if(Jb2 == NULL) { // Out of memory.
+            const Reply Rp0 = {.N0 = Rq0.N0, .N1 = STS_FAILED, .N6 = Ns_R_N(Tm_0_R() - R0)};
+
+            Rp_CnRpCv_0(Cn0, &Rp0, NULL);
+            Fr_P_0(Cm0);
+            continue;
+        }
+
+        *Jb2 = (Job) {.Cn0 = Cn0, .Cm0 = Cm0, .N0 = (Natural) Fmt0.N4, .N1 = Rq0.N0, .R0 = R0, .Jb0 = NULL};
+        atomic_fetch_add(&Cn0->N0, 1);
+
+        pthread_mutex_lock(&Mx0);
+
+        if(Jb1 != NULL) Jb1->Jb0 = Jb2;
+        else Jb0 = Jb2;
+
+        Jb1 = Jb2;
+        ++N1;
+
+        pthread_cond_signal(&Cd0);
+        pthread_mutex_unlock(&Mx0);
+    }
+
+    Rl_Cn_0(Cn0);
+    return NULL;
+}
+
+/**
+ * @brief Collector [Cl], converged eigenvalues into the workspace.
+ * 
+ * @param N0 Index [N].
+ * @param C0 Eigenvalue [C].
+ * @param N1 Iterations [N].
+ * @param P0 Workspace.
+ * @return bool Always true.
+ */
+static bool Cl_NCNP_B(const Natural N0, const Complex C0, [[maybe_unused]] const Natural N1, void* P0) {
+    Workspace* Ws0 = (Workspace*) P0;
+
+    Ws0->Cv0[N0] = C0;
+    ++Ws0->N1;
+
+    return true;
+}
+
+/**
+ * @brief Solve [Slv], a request on the worker's workspace.
+ * 
+ * The workspace only grows, so that a batch allocates at most for its first
+ * request. A growth that cannot be allocated empties the workspace and fails
+ * the request alone. Hessenberg input, any matrix up to 2 x 2 included, skips
+ * the reduction.
+ * 
+ * @param Ws0 Workspace [Ws].
+ * @param Cm0 Complex Matrix [Cm], the request's entries.
+ * @param N0 Rows and Columns [N].
+ * @return Natural Status [N], STS_*, the converged eigenvalues being the last Ws0->N1 of the first N0.
+ */
+static Natural Slv_WsCmN_N(Workspace* Ws0, const Complex* Cm0, const Natural N0) {
+    if(N0 > Ws0->N0) { // Growth.
+        Fr_P_0(Ws0->Cm0);
+        Fr_P_0(Ws0->Cv0);
+        Fr_P_0(Ws0->Nv0);
+
+        Ws0->Cm0 = (Complex*) Alc_NN_P(N0 * N0, sizeof(Complex));
+        Ws0->Cv0 = (Complex*) Alc_NN_P(N0, sizeof(Complex));
+        Ws0->Nv0 = (Natural*) Alc_NN_P(N0, sizeof(Natural));
+        Ws0->N0 = N0;
+    }
+
+    Ws0->N1 = 0;
+
+    if(Ws0->Cm0 == NULL || Ws0->Cv0 == NULL || Ws0->Nv0 == NULL) { // Out of memory.
+        Fr_P_0(Ws0->Cm0);
+        Fr_P_0(Ws0->Cv0);
+        Fr_P_0(Ws0->Nv0);
+
+        *Ws0 = (Workspace) {.Cm0 = NULL, .Cv0 = NULL, .Nv0 = NULL, .N0 = 0, .N1 = 0};
+        return STS_FAILED;
+    }
+
+    Cp_CvtCvN_0(Ws0->Cm0, Cm0, N0 * N0);
+
+    if(N0 > 2 && !(Str_CqNvtN_N(Ws0->Cm0, Ws0->Nv0, N0) & STR_HESSENBERG)) Hsn_CqtN_0(Ws0->Cm0, N0); // Hessenberg.
+    Cpt_ChsnqtN_0(Ws0->Cm0, N0); // Compact storage.
+
+    return Eig_ChctDfPBgN_N(Ws0->Cm0, Cl_NCNP_B, Ws0, NULL, N0);
+}
+
+/**
+ * @brief Worker [Wrk], solves batches of same-sized requests.
+ * 
+ * @param P0 Batch, N0 job slots, allocated by the caller.
+ * @return void* NULL.
+ */
+static void* Wrk_P_P(void* P0) {
+    Job** Jbv0 = (Job**) P0; // Batch.
+    Workspace Ws0 = {.Cm0 = NULL, .Cv0 = NULL, .Nv0 = NULL, .N0 = 0, .N1 = 0};
+    register Natural N3, N4, N5, N6, N7;
+
+    for(;;) {
+        pthread_mutex_lock(&Mx0);
+
+        while(Jb0 == NULL)
+            pthread_cond_wait(&Cd0, &Mx0);
+
+        // Oldest request.
+
+        Jbv0[0] = Jb0;
+        Jb0 = Jb0->Jb0;
+        N3 = 1;
+        N4 = Jbv0[0]->N0;
+        N5 = N1 / N2 < N0 ? N1 / N2 + 1 : N0; // Fair share.
+
+        // Coalescing, the queue's order being kept for the rest.
+
+        Job** Jb2 = &Jb0;
+        Job* Jb3 = NULL; // Last kept.
+
+        while(*Jb2 != NULL) {
+            if(N4 <= DMN2 && N3 < N5 && (*Jb2)->N0 == N4) {
+                Jbv0[N3++] = *Jb2;
+                *Jb2 = (*Jb2)->Jb0;
+            } else {
+                Jb3 = *Jb2;
+                Jb2 = &(*Jb2)->Jb0;
+            }
+        }
+
+        Jb1 = Jb3;
+        N1 -= N3;
+
+        if(Jb0 != NULL) pthread_cond_signal(&Cd0);
+        pthread_mutex_unlock(&Mx0);
+
+        // Solution.
+
+        for(N6 = 0; N6 < N3; ++N6) {
+            Job* Jb4 = Jbv0[N6];
+
+            const register Real R0 = Tm_0_R();
+            N7 = Slv_WsCmN_N(&Ws0, Jb4->Cm0, N4);
+            const register Real R1 = Tm_0_R();
+
+            const Reply Rp0 = {.N0 = Jb4->N1, .N1 = N7, .N2 = Ws0.N1, .N3 = N3, .N4 = Ns_R_N(R0 - Jb4->R0), .N5 = Ns_R_N(R1 - R0), .N6 = Ns_R_N(R1 - Jb4->R0), .N7 = 0};
+            Rp_CnRpCv_0(Jb4->Cn0, &Rp0, Ws0.N1 > 0 ? Ws0.Cv0 + N4 - Ws0.N1 : NULL);
+
+            Fr_P_0(Jb4->Cm0);
+            Rl_Cn_0(Jb4->Cn0);
+            Fr_P_0(Jb4);
+        }
+    }
+
+    return NULL;
+}
+
+int main(int argc, char **argv) {
+    const char* S0 = Sck_0_S(); // Path.
+    struct sockaddr_un Sa0 = {.sun_family = AF_UNIX};
+    pthread_t Th0;
+    int I0;
+
+    N2 = Thr_0_N(); // Workers.
+
+    while((I0 = getopt(argc, argv, "s:w:b:h")) != -1)
+        switch(I0) {
+            case 's': S0 = optarg; break;
+            case 'w': N2 = (Natural) atoll(optarg); break;
+            case 'b': N0 = (Natural) atoll(optarg); break;
+            default:
+                fprintf(stderr, "Usage: %s [-s Socket, NAQRA_SOCKET or %s if omitted] [-w Workers] [-b Batch limit]\n", argv[0], DMN0);
+                return -1;
+        }
+
+    if(N2 == 0) N2 = 1;
+    if(N0 == 0) N0 = 1;
+
+    if(strlen(S0) >= sizeof(Sa0.sun_path)) {
+        fprintf(stderr, "Socket path too long: %s.\n", S0);
+        return -1;
+    }
+
+    strcpy(Sa0.sun_path, S0);
+
+    // Library output goes to stderr, as diagnostics.
+    dup2(STDERR_FILENO, STDOUT_FILENO);
+
+    // Signals, accept being interrupted on stop.
+
+    struct sigaction Sg0 = {.sa_handler = Stp_I_0};
+    sigemptyset(&Sg0.sa_mask);
+    sigaction(SIGINT, &Sg0, NULL);
+    sigaction(SIGTERM, &Sg0, NULL);
+
+    // Socket.
+
+    const register int I1 = socket(AF_UNIX, SOCK_STREAM, 0);
+    unlink(S0);
+
+    if(I1 < 0 || bind(I1, (struct sockaddr*) &Sa0, sizeof(Sa0)) != 0 || listen(I1, DMN3) != 0) {
+        fprintf(stderr, "Could not listen on %s: %s.\n", S0, strerror(errno));
+        return -1;
+    }
+
+    // Workers, each with its batch.
+
+    register Natural N3 = 0, N4 = 0;
+
+    for(; N3 < N2; ++N3) {
+        Job** Jbv0 = (Job**) Alc_NN_P(N0, sizeof(Job*));
+
+        if(Jbv0 != NULL && pthread_create(&Th0, NULL, Wrk_P_P, Jbv0) == 0) {
+            pthread_detach(Th0);
+            ++N4;
+        } else
+            Fr_P_0(Jbv0);
+    }
+
+    if(N4 == 0) { // Requests would be queued forever.
+        fprintf(stderr, "Could not start any worker.\n");
+
+        close(I1);
+        unlink(S0);
+        return -1;
+    }
+
+    N2 = N4; // Fair shares.
+    fprintf(stderr, "Serving on %s, %zu workers, batches of up to %zu.\n", S0, N2, N0);
+
+    while(!B0) {
+        const register int I2 = accept(I1, NULL, NULL);
+
+        if(I2 < 0) {
+            if(errno == EINTR || errno == ECONNABORTED) continue;
+            break;
+        }
+
+        Connection* Cn0 = (Connection*) Alc_NN_P(1, sizeof(Connection));
+
+        if(Cn0 == NULL) { // Out of memory.
+            close(I2);
+            continue;
+        }
+
+        Cn0->I0 = I2;
+        atomic_init(&Cn0->N0, 1);
+        pthread_mutex_init(&Cn0->Mx0, NULL);
+
+        if(pthread_create(&Th0, NULL, Rd_P_P, Cn0) == 0) pthread_detach(Th0);
+        else Rl_Cn_0(Cn0);
+    }
+
+    close(I1);
+    unlink(S0);
+
+    fprintf(stderr, "Stopped.\n");
+    return 0;
+}
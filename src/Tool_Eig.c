@@ -0,0 +1,92 @@
+/**
+ * @file Tool_Eig.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief naqra-eig, streams the eigenvalues of a binary or Matrix Market file.
+ * @date 2024-12-15
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ * Each eigenvalue is written as it deflates, either as a text line with its
+ * index, real and imaginary parts, or as a binary record of one uint64 and
+ * two float64. Diagnostics go to stderr.
+ * 
+ * With -m, binary files are reduced out-of-core within the given memory.
+ */
+
+#include <string.h>
+#include <unistd.h>
+#include "../include/Interface.h"
+
+/**
+ * @brief Output [Out], text.
+ */
+static bool Out_NCNP_B(const Natural N0, const Complex C0, [[maybe_unused]] const Natural N1, void* P0) {
+    fprintf((FILE*) P0, "%zu %.17g %.17g\n", N0, vgetq_lane_f64(C0, 0), vgetq_lane_f64(C0, 1));
+    return fflush((FILE*) P0) == 0;
+}
+
+/**
+ * @brief Output [Outb], binary.
+ */
+static bool Outb_NCNP_B(const Natural N0, const Complex C0, [[maybe_unused]] const Natural N1, void* P0) {
+    const uint64_t N2 = (uint64_t) N0;
+    const Real Rv0[2] = {vgetq_lane_f64(C0, 0), vgetq_lane_f64(C0, 1)};
+
+    if(fwrite(&N2, sizeof(N2), 1, (FILE*) P0) != 1 || fwrite(Rv0, sizeof(Real), 2, (FILE*) P0) != 2) return false;
+    return fflush((FILE*) P0) == 0;
+}
+
+int main(int argc, char **argv) {
+    const char* S0 = NULL; // Path.
+    Budget Bg0 = {.R0 = 0.0, .N0 = 0, .B0 = NULL};
+    bool B0 = false; // Binary.
+    size_t N2 = 0; // Out-of-core memory, MiB.
+    int I0;
+
+    while((I0 = getopt(argc, argv, "bt:i:m:h")) != -1)
+        switch(I0) {
+            case 'b': B0 = true; break;
+            case 't': Bg0.R0 = atof(optarg); break;
+            case 'i': Bg0.N0 = (Natural) atoll(optarg); break;
+            case 'm': N2 = (size_t) atoll(optarg); break;
+            default:
+                fprintf(stderr, "Usage: %s [-b (Binary)] [-t Seconds] [-i Iterations] [-m MiB (Out-of-core)] [File, .mtx or binary, stdin if omitted or -]\n", argv[0]);
+                return -1;
+        }
+
+    if(optind < argc) S0 = argv[optind];
+
+    // Eigenvalues go to the original stdout, everything else to stderr.
+    FILE* F0 = fdopen(dup(STDOUT_FILENO), "w");
+    dup2(STDERR_FILENO, STDOUT_FILENO);
+
+    if(N2 > 0) { // Out-of-core.
+        const register Natural N0 = OutOfCoreEigenvalues(S0, N2 << 20, B0 ? Outb_NCNP_B : Out_NCNP_B, F0, &Bg0);
+        fclose(F0);
+
+        if(N0 == STS_FAILED)
+            fprintf(stderr, "Could not reduce a square matrix from %s.\n", S0 != NULL ? S0 : "stdin");
+        else if(N0 != STS_CONVERGED)
+            fprintf(stderr, "Stopped early, status %zu.\n", N0);
+
+        return (int) N0;
+    }
+
+    const register size_t N1 = S0 != NULL ? strlen(S0) : 0;
+    Matrix* M0 = N1 > 4 && strcmp(S0 + N1 - 4, ".mtx") == 0 ? ReadMatrixMarket(S0, NULL) : LoadMatrix(S0, NULL);
+
+    if(M0 == NULL || M0->N0 != M0->N1) {
+        fprintf(stderr, "Could not read a square matrix from %s.\n", S0 != NULL ? S0 : "stdin");
+        return -1;
+    }
+
+    const register Natural N0 = StreamEigenvalues(M0, B0 ? Outb_NCNP_B : Out_NCNP_B, F0, &Bg0);
+
+    FreeMatrix(M0);
+    fclose(F0);
+
+    if(N0 != STS_CONVERGED)
+        fprintf(stderr, "Stopped early, status %zu.\n", N0);
+
+    return (int) N0;
+}
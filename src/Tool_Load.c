@@ -0,0 +1,301 @@
+/**
+ * @file Tool_Load.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief naqra-load, load generator for naqra-daemon.
+ * @date 2024-12-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ * Each connection keeps a fixed number of random requests in flight and
+ * records their round trips. Percentiles of the round trips are printed with
+ * the daemon's own mean timings and batch sizes.
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE // Sockets, memfd_create and file seals.
+#endif
+
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "./Daemon.h"
+
+// Load, a connection's settings and results.
+typedef struct {
+
+    // Socket path.
+    const char* S0;
+
+    // Rows and Columns.
+    Natural N0;
+
+    // Requests.
+    Natural N1;
+
+    // Requests in flight.
+    Natural N2;
+
+    // Index, seed.
+    Natural N3;
+
+    // Shared memory.
+    bool B0;
+
+    // Round trips, seconds.
+    Real* Rv0;
+
+    // Daemon's queueing, solution and service sums, seconds, and batch sizes' sum.
+    Real Rv1[4];
+
+    // Failed requests.
+    Natural N4;
+
+} Load;
+
+/**
+ * @brief Comparison [Cmp], ascending.
+ */
+static int Cmp_PP_I(const void* P0, const void* P1) {
+    const Real R0 = *(const Real*) P0, R1 = *(const Real*) P1;
+    return (R0 > R1) - (R0 < R1);
+}
+
+/**
+ * @brief Read [Rd], the whole buffer.
+ * 
+ * @param I0 Socket.
+ * @param P0 Buffer.
+ * @param N0 Bytes [N].
+ * @return bool Success [B].
+ */
+static bool Rd_IPN_B(const int I0, void* P0, const Natural N0) {
+    register ssize_t I1;
+
+    for(register Natural N1 = 0; N1 < N0; N1 += (Natural) I1)
+        if((I1 = read(I0, (char*) P0 + N1, N0 - N1)) <= 0) return false;
+
+    return true;
+}
+
+/**
+ * @brief Send [Snd], a request.
+ * 
+ * @param I0 Socket.
+ * @param P0 Message, the request record followed by the inline matrix, if any.
+ * @param N0 Bytes [N].
+ * @param I1 Shared memory descriptor, -1 if none.
+ * @return bool Success [B].
+ */
+static bool Snd_IPNI_B(const int I0, const void* P0, const Natural N0, const int I1) {
+    union { struct cmsghdr Cmh0; char S0[CMSG_SPACE(sizeof(int))]; } U0;
+    struct iovec Io0 = {.iov_base = (void*) P0, .iov_len = N0};
+    struct msghdr Msh0 = {.msg_iov = &Io0, .msg_iovlen = 1};
+    register ssize_t I2;
+    register Natural N1;
+
+    if(I1 >= 0) { // Descriptor.
+        memset(U0.S0, 0, sizeof(U0.S0));
+        Msh0.msg_control = U0.S0;
+        Msh0.msg_controllen = sizeof(U0.S0);
+
+        struct cmsghdr* Cmh1 = CMSG_FIRSTHDR(&Msh0);
+        Cmh1->cmsg_level = SOL_SOCKET;
+        Cmh1->cmsg_type = SCM_RIGHTS;
+        Cmh1->cmsg_len = CMSG_LEN(sizeof(int));
+        memcpy(CMSG_DATA(Cmh1), &I1, sizeof(int));
+    }
+
+    if((I2 = sendmsg(I0, &Msh0, MSG_NOSIGNAL)) <= 0) return false;
+
+    for(N1 = (Natural) I2; N1 < N0; N1 += (Natural) I2) // Remainder.
+        if((I2 = send(I0, (const char*) P0 + N1, N0 - N1, MSG_NOSIGNAL)) <= 0) return false;
+
+    return true;
+}
+
+/**
+ * @brief Shared memory [Shm], a sealed binary matrix file.
+ * 
+ * The daemon maps the file without copies and rejects it unless it can
+ * neither shrink nor change.
+ * 
+ * @param P0 Header and entries.
+ * @param N0 Bytes [N].
+ * @param N1 Index [N], for the name.
+ * @return int Descriptor, -1 on failure.
+ */
+static int Shm_PNN_I(const void* P0, const Natural N0, const Natural N1) {
+    char S0[64];
+    snprintf(S0, sizeof(S0), "naqra-load-%zu", N1);
+
+    const register int I0 = memfd_create(S0, MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    if(I0 < 0) return -1;
+
+    if(ftruncate(I0, (off_t) N0) != 0 || pwrite(I0, P0, N0, 0) != (ssize_t) N0 ||
+        fcntl(I0, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE | F_SEAL_SEAL) != 0) {
+        close(I0);
+        return -1;
+    }
+
+    return I0;
+}
+
+/**
+ * @brief Connection [Cn], a closed loop of requests.
+ * 
+ * @param P0 Load.
+ * @return void* NULL.
+ */
+static void* Cn_P_P(void* P0) {
+    Load* Ld0 = (Load*) P0;
+    const register Natural N0 = Ld0->N0, N1 = sizeof(Request) + FMT2 + N0 * N0 * sizeof(Complex);
+    struct sockaddr_un Sa0 = {.sun_family = AF_UNIX};
+    register Natural N2 = 0, N3 = 0, N4;
+    unsigned int U0 = (unsigned int) Ld0->N3 + 1;
+    Reply Rp0;
+
+    strncpy(Sa0.sun_path, Ld0->S0, sizeof(Sa0.sun_path) - 1);
+
+    const register int I0 = socket(AF_UNIX, SOCK_STREAM, 0);
+
+    if(I0 < 0 || connect(I0, (struct sockaddr*) &Sa0, sizeof(Sa0)) != 0) {
+        if(I0 >= 0) close(I0);
+        Ld0->N4 = Ld0->N1;
+        return NULL;
+    }
+
+    // Request, a random matrix.
+
+    char* S0 = (char*) Alc_NN_P(N1, 1);
+    Request* Rq0 = (Request*) S0;
+    Format Fmt0 = {.S0 = {0}, .N0 = FMT1, .N1 = ELM_COMPLEX, .N2 = ORD_COLUMN, .N3 = STR_GENERAL, .N4 = N0, .N5 = N0, .N6 = 0};
+    Real* Rv0 = (Real*) (S0 + sizeof(Request) + FMT2);
+
+    memcpy(Fmt0.S0, FMT0, 8);
+    memcpy(S0 + sizeof(Request), &Fmt0, FMT2);
+
+    for(N4 = 0; N4 < 2 * N0 * N0; ++N4)
+        Rv0[N4] = 2.0 * (Real) rand_r(&U0) / (Real) RAND_MAX - 1.0;
+
+    Rq0->N1 = Ld0->B0 ? REQ_SHARED : REQ_INLINE;
+
+    const register int I1 = Ld0->B0 ? Shm_PNN_I(S0 + sizeof(Request), N1 - sizeof(Request), Ld0->N3) : -1;
+    const register Natural N5 = Ld0->B0 ? sizeof(Request) : N1; // Message's bytes.
+
+    Real* Rv1 = (Real*) Alc_NN_P(Ld0->N1, sizeof(Real)); // Sending times.
+    Complex* Cv0 = (Complex*) Alc_NN_P(N0, sizeof(Complex)); // Eigenvalues.
+
+    if(Ld0->B0 && I1 < 0) N2 = N3 = Ld0->N1;
+
+    // Closed loop.
+
+    while(N3 < Ld0->N1) {
+        for(; N2 < Ld0->N1 && N2 < N3 + Ld0->N2; ++N2) {
+            Rq0->N0 = N2;
+            Rv1[N2] = Tm_0_R();
+
+            if(!Snd_IPNI_B(I0, S0, N5, I1)) break;
+        }
+
+        if(!Rd_IPN_B(I0, &Rp0, sizeof(Reply)) || Rp0.N2 > N0 || Rp0.N0 >= N2) break;
+        if(Rp0.N2 > 0 && !Rd_IPN_B(I0, Cv0, (Natural) Rp0.N2 * sizeof(Complex))) break;
+
+        Ld0->Rv0[N3++] = Tm_0_R() - Rv1[Rp0.N0];
+
+        if(Rp0.N1 != STS_CONVERGED) ++Ld0->N4;
+
+        Ld0->Rv1[0] += 1.0E-9 * (Real) Rp0.N4;
+        Ld0->Rv1[1] += 1.0E-9 * (Real) Rp0.N5;
+        Ld0->Rv1[2] += 1.0E-9 * (Real) Rp0.N6;
+        Ld0->Rv1[3] += (Real) Rp0.N3;
+    }
+
+    Ld0->N4 += Ld0->N1 - N3; // Unanswered.
+    Ld0->N1 = N3;
+
+    if(I1 >= 0) close(I1);
+    close(I0);
+
+    Fr_P_0(S0);
+    Fr_P_0(Rv1);
+    Fr_P_0(Cv0);
+
+    return NULL;
+}
+
+int main(int argc, char **argv) {
+    Load Ld0 = {.S0 = Sck_0_S(), .N0 = 32, .N1 = 1000, .N2 = 8, .B0 = false};
+    Natural N0 = 1, N1, N2 = 0, N3 = 0; // Connections.
+    Real Rv0[4] = {0.0, 0.0, 0.0, 0.0};
+    int I0;
+
+    while((I0 = getopt(argc, argv, "s:n:r:c:d:mh")) != -1)
+        switch(I0) {
+            case 's': Ld0.S0 = optarg; break;
+            case 'n': Ld0.N0 = (Natural) atoll(optarg); break;
+            case 'r': Ld0.N1 = (Natural) atoll(optarg); break;
+            case 'c': N0 = (Natural) atoll(optarg); break;
+            case 'd': Ld0.N2 = (Natural) atoll(optarg); break;
+            case 'm': Ld0.B0 = true; break;
+            default:
+                fprintf(stderr, "Usage: %s [-s Socket] [-n Size] [-r Requests per connection] [-c Connections] [-d Requests in flight] [-m (Shared memory)]\n", argv[0]);
+                return -1;
+        }
+
+    if(Ld0.N0 == 0 || Ld0.N1 == 0 || Ld0.N2 == 0 || N0 == 0) {
+        fprintf(stderr, "Sizes, requests, connections and requests in flight must be positive.\n");
+        return -1;
+    }
+
+    Load* Ldv0 = (Load*) Alc_NN_P(N0, sizeof(Load));
+    pthread_t* Thv0 = (pthread_t*) Alc_NN_P(N0, sizeof(pthread_t));
+    Real* Rv1 = (Real*) Alc_NN_P(N0 * Ld0.N1, sizeof(Real)); // Round trips.
+
+    const register Real R0 = Tm_0_R();
+
+    for(N1 = 0; N1 < N0; ++N1) {
+        Ldv0[N1] = Ld0;
+        Ldv0[N1].N3 = N1;
+        Ldv0[N1].Rv0 = Rv1 + N1 * Ld0.N1;
+
+        pthread_create(Thv0 + N1, NULL, Cn_P_P, Ldv0 + N1);
+    }
+
+    for(N1 = 0; N1 < N0; ++N1) {
+        pthread_join(Thv0[N1], NULL);
+
+        for(register Natural N4 = 0; N4 < Ldv0[N1].N1; ++N4) // Compaction.
+            Rv1[N2++] = Ldv0[N1].Rv0[N4];
+
+        for(register Natural N4 = 0; N4 < 4; ++N4)
+            Rv0[N4] += Ldv0[N1].Rv1[N4];
+
+        N3 += Ldv0[N1].N4;
+    }
+
+    const register Real R1 = Tm_0_R() - R0;
+
+    printf("Requests: %zu of size %zu, %zu connections, %zu in flight each, %s.\n", N2, Ld0.N0, N0, Ld0.N2, Ld0.B0 ? "shared memory" : "inline");
+
+    if(N2 > 0) {
+        qsort(Rv1, N2, sizeof(Real), Cmp_PP_I);
+
+        printf("Throughput: %.1f requests/s.\n", (Real) N2 / R1);
+        printf("Round trip: p50 %.1f us, p90 %.1f us, p99 %.1f us, max %.1f us.\n", 1.0E6 * Rv1[N2 / 2], 1.0E6 * Rv1[N2 * 9 / 10], 1.0E6 * Rv1[N2 * 99 / 100], 1.0E6 * Rv1[N2 - 1]);
+        printf("Daemon, mean: queueing %.1f us, solution %.1f us, service %.1f us, batch %.1f.\n", 1.0E6 * Rv0[0] / (Real) N2, 1.0E6 * Rv0[1] / (Real) N2, 1.0E6 * Rv0[2] / (Real) N2, Rv0[3] / (Real) N2);
+    }
+
+    if(N3 > 0)
+        printf("Failed: %zu.\n", N3);
+
+    Fr_P_0(Ldv0);
+    Fr_P_0(Thv0);
+    Fr_P_0(Rv1);
+
+    return N3 > 0 ? -1 : 0;
+}
@@ -0,0 +1,33 @@
+/**
+ * @file Tool_Tune.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Autotuning, writes the tuning profile.
+ * @date 2024-12-14
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include "../include/Interface.h"
+
+int main(int argc, char **argv) {
+    const char* S0 = argc > 1 ? argv[1] : NULL; // Profile path.
+
+    printf("Autotuning on %zu threads.\n", Thr_0_N());
+    const Tuning Tn0 = Atn_0_Tn();
+
+    printf("Short vectors' cutoff: %zu\n", Tn0.N0);
+    printf("Rotations per block: %zu\n", Tn0.N1);
+    printf("Multithreaded sweeps' threshold: %zu\n", Tn0.N2);
+    printf("Multithreaded sweeps' blocks: %zu\n", Tn0.N3);
+    printf("Bandwidth: %zu\n", Tn0.N4);
+    printf("Two-stage threshold: %zu\n", Tn0.N5);
+
+    if(Sv_S_N(S0) == 0) {
+        printf("Could not write the profile.\n");
+        return -1;
+    }
+
+    printf("Profile written to %s.\n", S0 != NULL ? S0 : getenv("NAQRA_TUNING") != NULL ? getenv("NAQRA_TUNING") : "~/.naqra");
+    return 0;
+}